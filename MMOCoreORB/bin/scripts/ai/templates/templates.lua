@@ -45,33 +45,35 @@ idle = {
 	{NONE, "idlewander"},
 }
 
-addAiBehavior("Composite")
-addAiBehavior("Wait")
-addAiBehavior("Wait10")
-addAiBehavior("Move")
-addAiBehavior("Walk")
-addAiBehavior("CombatMove")
-addAiBehavior("GeneratePatrol")
-addAiBehavior("GetTarget")
-addAiBehavior("SelectAttack")
-addAiBehavior("SelectWeapon")
+-- these run the C++ version of their base behavior, interrupts stay in lua
+-- addNativeAiBehavior(class, base behavior, class derives from DefaultInterrupt)
+addNativeAiBehavior("Composite", "Composite", false)
+addNativeAiBehavior("Wait", "Wait", false)
+addNativeAiBehavior("Wait10", "Wait10", false)
+addNativeAiBehavior("Move", "Move", false)
+addNativeAiBehavior("Walk", "Walk", false)
+addNativeAiBehavior("CombatMove", "CombatMove", false)
+addNativeAiBehavior("GeneratePatrol", "GeneratePatrol", false)
+addNativeAiBehavior("GetTarget", "GetTarget", false)
+addNativeAiBehavior("SelectAttack", "SelectAttack", false)
+addNativeAiBehavior("SelectWeapon", "SelectWeapon", false)
 
-addAiBehavior("CompositeDefault")
-addAiBehavior("WaitDefault")
-addAiBehavior("Wait10Default")
-addAiBehavior("MoveDefault")
-addAiBehavior("WalkDefault")
-addAiBehavior("GeneratePatrolDefault")
+addNativeAiBehavior("CompositeDefault", "Composite", true)
+addNativeAiBehavior("WaitDefault", "Wait", true)
+addNativeAiBehavior("Wait10Default", "Wait10", true)
+addNativeAiBehavior("MoveDefault", "Move", true)
+addNativeAiBehavior("WalkDefault", "Walk", true)
+addNativeAiBehavior("GeneratePatrolDefault", "GeneratePatrol", true)
 
-addAiBehavior("CompositePack")
-addAiBehavior("WaitPack")
-addAiBehavior("Wait10Pack")
-addAiBehavior("MovePack")
-addAiBehavior("WalkPack")
-addAiBehavior("GeneratePatrolPack")
+addNativeAiBehavior("CompositePack", "Composite", true)
+addNativeAiBehavior("WaitPack", "Wait", true)
+addNativeAiBehavior("Wait10Pack", "Wait10", true)
+addNativeAiBehavior("MovePack", "Move", true)
+addNativeAiBehavior("WalkPack", "Walk", true)
+addNativeAiBehavior("GeneratePatrolPack", "GeneratePatrol", true)
 
-addAiBehavior("CompositeCreaturePet")
-addAiBehavior("WaitCreaturePet")
+addNativeAiBehavior("CompositeCreaturePet", "Composite", true)
+addNativeAiBehavior("WaitCreaturePet", "Wait", true)
 addAiBehavior("Wait10CreaturePet")
 addAiBehavior("MoveCreaturePet")
 addAiBehavior("WalkCreaturePet")
@@ -80,8 +82,8 @@ addAiBehavior("GetTargetCreaturePet")
 addAiBehavior("SelectAttackCreaturePet")
 addAiBehavior("SelectWeaponCreaturePet")
 
-addAiBehavior("CompositeDroidPet")
-addAiBehavior("WaitDroidPet")
+addNativeAiBehavior("CompositeDroidPet", "Composite", true)
+addNativeAiBehavior("WaitDroidPet", "Wait", true)
 addAiBehavior("Wait10DroidPet")
 addAiBehavior("MoveDroidPet")
 addAiBehavior("WalkDroidPet")
@@ -90,8 +92,8 @@ addAiBehavior("GetTargetDroidPet")
 addAiBehavior("SelectAttackDroidPet")
 addAiBehavior("SelectWeaponDroidPet")
 
-addAiBehavior("CompositeFactionPet")
-addAiBehavior("WaitFactionPet")
+addNativeAiBehavior("CompositeFactionPet", "Composite", true)
+addNativeAiBehavior("WaitFactionPet", "Wait", true)
 addAiBehavior("Wait10FactionPet")
 addAiBehavior("MoveFactionPet")
 addAiBehavior("WalkFactionPet")
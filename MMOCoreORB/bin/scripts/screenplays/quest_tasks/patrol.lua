@@ -74,9 +74,7 @@ function Patrol:handleEnteredAreaEvent(pActiveArea, pCreature)
 	if ownerID == SceneObject(pCreature):getObjectID() then
 		local wpNum = readData(areaID .. self.taskName .. "waypointNum")
 		self:destroyWaypoint(pCreature, wpNum)
-		local wpDone = readData(ownerID .. ":patrolWaypointsReached") + 1
-
-		writeData(ownerID .. ":patrolWaypointsReached", wpDone)
+		incrementData(ownerID .. ":patrolWaypointsReached", 1)
 		self:onEnteredActiveArea(pCreature, pActiveArea)
 		SceneObject(pActiveArea):destroyObjectFromWorld()
 		return 1
@@ -26,6 +26,16 @@ function readStringData(key)
 	return readStringSharedMemory(string.format(key))
 end
 
+-- Adds delta to key in one step and returns the new value
+function incrementData(key, delta)
+	return incrementSharedMemory(string.format(key), delta)
+end
+
+-- Sets key to data if it still holds expected, returns true if it did
+function compareAndSwapData(key, expected, data)
+	return compareAndSwapSharedMemory(string.format(key), expected, data)
+end
+
 ScreenPlay = Object:new {
 	screenplayName = "",
 	numerOfActs = 0,
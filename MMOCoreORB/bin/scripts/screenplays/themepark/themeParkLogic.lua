@@ -1029,8 +1029,7 @@ function ThemeParkLogic:notifyItemLooted(pItem, pLooter)
 	local looterID = SceneObject(pLooter):getObjectID()
 
 	if self:lootedByCorrectPlayer(itemID, looterID) then
-		local currentLootCount = readData(looterID .. ":requiredItemsLooted") + 1
-		writeData(looterID, ":requiredItemsLooted", currentLootCount)
+		local currentLootCount = incrementData(looterID .. ":requiredItemsLooted", 1)
 
 		if currentLootCount == self:getMissionLootCount(pLooter) then
 			self:completeMission(pLooter)
@@ -1207,8 +1206,7 @@ function ThemeParkLogic:notifyDefeatedTarget(pVictim, pAttacker)
 		self:failMission(pOwner)
 		return 1
 	else
-		local currentKillCount = readData(ownerID .. ":killedMissionNpcs") + 1
-		writeData(ownerID .. ":killedMissionNpcs", currentKillCount)
+		local currentKillCount = incrementData(ownerID .. ":killedMissionNpcs", 1)
 
 		if currentKillCount == self:getMissionKillCount(pOwner) then
 			self:completeMission(pOwner)
@@ -58,6 +58,10 @@ ConfigManager::ConfigManager() {
 	purgeDeletedCharacters = 10; //Default is 10 minutes.
 
 	maxNavMeshJobs = 6;
+
+	terrainRasterSpacing = 4;
+
+	movementQueueRebalanceDepth = 50;
 }
 
 bool ConfigManager::loadConfigData() {
@@ -125,6 +129,14 @@ bool ConfigManager::loadConfigData() {
 
 	maxNavMeshJobs = getGlobalInt("MaxNavMeshJobs");
 
+	// negative disables the raster, missing keeps the default
+	int rasterSpacing = getGlobalInt("TerrainRasterSpacing");
+
+	if (rasterSpacing != 0)
+		terrainRasterSpacing = rasterSpacing;
+
+	loadMovementTaskQueues();
+
 	return true;
 }
 
@@ -151,6 +163,59 @@ void ConfigManager::loadEnabledZones() {
 	zones.pop();
 }
 
+void ConfigManager::loadMovementTaskQueues() {
+	movementTaskQueues.removeAll();
+	movementZones.removeAll();
+	movementZoneRegions.removeAll();
+
+	LuaObject queues = getGlobalObject("MovementTaskQueues");
+
+	if (queues.isValidTable()) {
+		for (int i = 1; i <= queues.getTableSize(); ++i)
+			movementTaskQueues.add(queues.getIntAt(i));
+	}
+
+	queues.pop();
+
+	if (movementTaskQueues.size() == 0) {
+		for (int i = 3; i <= 6; ++i)
+			movementTaskQueues.add(i);
+	}
+
+	LuaObject zones = getGlobalObject("MovementZoneRegions");
+	bool zonesConfigured = zones.isValidTable();
+
+	if (zonesConfigured) {
+		for (int i = 1; i <= zones.getTableSize(); ++i) {
+			LuaObject zone = zones.getObjectAt(i);
+
+			if (zone.isValidTable()) {
+				movementZones.add(zone.getStringAt(1));
+				movementZoneRegions.add(Math::max(1, zone.getIntAt(2)));
+			}
+
+			zone.pop();
+		}
+	}
+
+	zones.pop();
+
+	// the busiest planets keep the queues they always had, 4 to 6
+	if (!zonesConfigured) {
+		movementZones.add("corellia");
+		movementZones.add("tatooine");
+		movementZones.add("naboo");
+
+		for (int i = 0; i < movementZones.size(); ++i)
+			movementZoneRegions.add(1);
+	}
+
+	int depth = getGlobalInt("MovementQueueRebalanceDepth");
+
+	if (depth > 0)
+		movementQueueRebalanceDepth = depth;
+}
+
 void ConfigManager::loadMOTD() {
 	messageOfTheDay = "";
 
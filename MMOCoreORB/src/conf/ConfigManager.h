@@ -64,6 +64,15 @@ namespace conf {
 
 		int maxNavMeshJobs;
 
+		int terrainRasterSpacing;
+
+		Vector<int> movementTaskQueues;
+
+		// zones with dedicated movement queues in config order and the number of regions of each
+		Vector<String> movementZones;
+		Vector<int> movementZoneRegions;
+		int movementQueueRebalanceDepth;
+
 		String messageOfTheDay;
 
 		Vector<String> treFiles;
@@ -85,6 +94,7 @@ namespace conf {
 		void loadRevision();
 		void loadTreFileList();
 		void loadEnabledZones();
+		void loadMovementTaskQueues();
 
 		//getters
 
@@ -268,6 +278,26 @@ namespace conf {
 			return maxNavMeshJobs;
 		}
 
+		inline int getTerrainRasterSpacing() {
+			return terrainRasterSpacing;
+		}
+
+		inline Vector<int>* getMovementTaskQueues() {
+			return &movementTaskQueues;
+		}
+
+		inline Vector<String>* getMovementZones() {
+			return &movementZones;
+		}
+
+		inline Vector<int>* getMovementZoneRegions() {
+			return &movementZoneRegions;
+		}
+
+		inline int getMovementQueueRebalanceDepth() {
+			return movementQueueRebalanceDepth;
+		}
+
 		inline void setProgressMonitors(bool val) {
 			progressMonitors = val;
 		}
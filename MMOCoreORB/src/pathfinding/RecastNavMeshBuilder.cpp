@@ -71,7 +71,8 @@ RecastNavMeshBuilder::RecastNavMeshBuilder(Zone* zone, const String& name) :
 		m_maxPolysPerTile(0),
 		bounds(Vector3(0, 0, 0), Vector3(0, 0, 0)),
 		lastTileBounds(Vector3(0, 0, 0), Vector3(0, 0, 0)),
-		m_tileTriCount(0) {
+		m_tileTriCount(0),
+		maxTileWorkers(1) {
 	ProceduralTerrainAppearance* pta = zone->getPlanetManager()->getTerrainManager()->getProceduralTerrainAppearance();
 	if (pta->getUseGlobalWaterTable())
 		waterTableHeight = pta->getGlobalWaterTableHeight();
@@ -151,14 +152,14 @@ void RecastNavMeshBuilder::saveAll(const String& path) {
 }
 
 bool RecastNavMeshBuilder::rebuildArea(const AABB& buildArea, RecastNavMesh* existingMesh) {
-	destroyMesh = false;
-	float longest = buildArea.extents()[buildArea.longestAxis()];
-	longest = MAX(settings.m_tileSize * settings.m_cellSize * 2.25, longest);
+	Vector<AABB> areas;
+	areas.add(buildArea);
 
-	Vector3 center = buildArea.midPoint();
-	//un-fucking (or re-fucking) our coordinate system
-	AABB area = AABB(Vector3(center.getX() - longest, -100000, -center.getY() - longest),
-				Vector3(center.getX() + longest, 100000, -center.getY() + longest));
+	return rebuildAreas(areas, existingMesh);
+}
+
+bool RecastNavMeshBuilder::rebuildAreas(const Vector<AABB>& buildAreas, RecastNavMesh* existingMesh) {
+	destroyMesh = false;
 
 	m_navMesh = existingMesh->getNavMesh();
 	if (!m_navMesh)
@@ -194,7 +195,7 @@ bool RecastNavMeshBuilder::rebuildArea(const AABB& buildArea, RecastNavMesh* exi
 	if (!m_geom) return false;
 	if (!m_navMesh) return false;
 
-	buildAllTiles(existingMesh, area);
+	buildAllTiles(existingMesh, buildAreas);
 	return true;
 }
 
@@ -265,135 +266,144 @@ bool RecastNavMeshBuilder::build() {
 	return true;
 }
 
-void RecastNavMeshBuilder::buildAllTiles(RecastNavMesh* recastNavMesh, const AABB& area) {
-	if (!m_geom) return;
-	if (!m_navMesh) return;
-
-	const Vector <Vector3>* vertArray = m_geom->getVerts();
-	const Vector <MeshTriangle>* triArray = m_geom->getTriangles();
-
-	const int nverts = vertArray->size();
-	float* verts = new float[nverts * 3];//m_geom->getMesh()->getVerts();
-
-	int* tris = new int[triArray->size() * 3];
-	for (int i = 0; i < nverts; i++) {
-		const Vector3& vert = vertArray->get(i);
-		verts[i * 3 + 0] = vert.getX();
-		verts[i * 3 + 1] = vert.getY();
-		verts[i * 3 + 2] = vert.getZ();
-	}
-
-	for (int i = 0; i < triArray->size(); i++) {
-		memcpy(tris + (i * 3), triArray->get(i).getVerts(), sizeof(int) * 3);
-	}
+/**
+ * Tiles of one build, shared by the thread running the build and the helper
+ * tasks it dispatches. Every thread builds with its own RecastTileBuilder so
+ * the rcContext and the scratch heightfields are never shared, only adding a
+ * finished tile to the navmesh is serialized.
+ */
+class RecastTileBatch : public Object, public Logger {
+public:
+	// x, y pairs
+	Vector<int> tiles;
 
 	float bmin[3];
 	float bmax[3];
+	float tcs;
+	int tilesPerRow;
 
-	bmin[0] = bounds.getXMin();
-	bmin[1] = bounds.getYMin();
-	bmin[2] = bounds.getZMin();
-
+	rcChunkyTriMesh chunkyMesh;
+	Reference<MeshData*> geom;
+	Vector<Reference<RecastPolygon*> > water;
+	RecastSettings settings;
+	float waterTableHeight;
 
-	bmax[0] = bounds.getXMax();
-	bmax[1] = bounds.getYMax();
-	bmax[2] = bounds.getZMax();
-	int gw = 0, gh = 0;
-	rcCalcGridSize(bmin, bmax, settings.m_cellSize, &gw, &gh);
-	const int ts = (int) settings.m_tileSize;
-	int tw = (gw + ts - 1) / ts;
-	int th = (gh + ts - 1) / ts;
-	const float tcs = settings.m_tileSize * settings.m_cellSize;
+	dtNavMesh* navMesh;
+	ReadWriteLock* navMeshLock;
+	ReadWriteLock localLock;
 
-	rcChunkyTriMesh mesh;
-	rcCreateChunkyTriMesh(verts, tris, triArray->size(), 256, &mesh);
-	const rcChunkyTriMesh* chunkyMesh = &mesh;
-	// Start the build process.
+	AtomicInteger nextTile;
+	AtomicInteger finishedTiles;
 
-	AtomicInteger jobStatus;
-	AtomicInteger progress;
+	// signalled by whichever thread finishes the last tile
+	Mutex finishedMutex;
+	Condition finishedCondition;
 
-	delete[] tris;
-	delete[] verts;
-
-	RecastTileBuilder builder(waterTableHeight, 0, 0, lastTileBounds, chunkyMesh, settings);
-	builder.changeMesh(m_geom);
-	builder.setWater(water);
-
-	//info("Bounds: " + bounds.getMinBound()->toString() + " | " + bounds.getMaxBound()->toString() + "\n", true);
+	RecastTileBatch(const String& name) : Logger(name), tcs(0), tilesPerRow(1), waterTableHeight(0), navMesh(NULL), navMeshLock(&localLock) {
+	}
 
-	float zStart = (fabs(bounds.getZMin() - area.getZMin()) / tcs) - 1.0f;
-	float xStart = (fabs(bounds.getXMin() - area.getXMin()) / tcs) - 1.0f;
+	int size() const {
+		return tiles.size() / 2;
+	}
 
-	th = ceil((fabs(bounds.getZMin() - area.getZMax()) / tcs) + 1.0f);
-	tw = ceil((fabs(bounds.getXMin() - area.getXMax()) / tcs) + 1.0f);
+	bool isFinished() {
+		return (int) finishedTiles.get() >= size();
+	}
 
-	ReadWriteLock* rwLock = recastNavMesh->getLock();
+	/**
+	 * Blocks until every tile is built, helpers may still be on the last ones
+	 */
+	void waitFinished() {
+		finishedMutex.lock();
 
-	if (zStart < 0 || xStart < 0)
-		return;
+		while (!isFinished())
+			finishedCondition.wait(&finishedMutex);
 
-	for (int y = floor(zStart); y < th; ++y) {
-		float zTileStart = bmin[2] + ((y + 1) * tcs);
-		//info("zStart: " + String::valueOf(zTileStart), true);
-		if (zTileStart < area.getZMin() || zTileStart > area.getZMax())
-			continue;
+		finishedMutex.unlock();
+	}
 
-		for (int x = floor(xStart); x < tw; ++x) {
+	void buildTiles() {
+		// helpers that start after the last tile was taken have nothing to do
+		if ((int) nextTile.get() >= size())
+			return;
 
+		RecastTileBuilder builder(waterTableHeight, 0, 0, AABB(Vector3(0, 0, 0), Vector3(0, 0, 0)), &chunkyMesh, settings);
+		builder.changeMesh(geom);
+		builder.setWater(water);
 
-			float xTileStart = bmin[0] + ((x + 1) * tcs);
-			//info("xStart: " + String::valueOf(xTileStart), true);
-			if (xTileStart < area.getXMin() || xTileStart > area.getXMax())
-				continue;
-
+		int index = 0;
 
-			float minx = bmin[0] + x * tcs;
-			float miny = bmin[1];
-			float minz = bmin[2] + y * tcs;
+		while ((index = nextTile.increment() - 1) < size()) {
+			int x = tiles.get(index * 2);
+			int y = tiles.get(index * 2 + 1);
 
-			float maxx = bmin[0] + (x + 1) * tcs;
-			float maxy = bmax[1];
-			float maxz = bmin[2] + (y + 1) * tcs;
-			lastTileBounds = AABB(Vector3(minx, miny, minz), Vector3(maxx, maxy, maxz));
+			AABB tileBounds(Vector3(bmin[0] + x * tcs, bmin[1], bmin[2] + y * tcs),
+					Vector3(bmin[0] + (x + 1) * tcs, bmax[1], bmin[2] + (y + 1) * tcs));
 
-			info("BuiltTile : " + lastTileBounds.getMinBound()->toString() + " | " + lastTileBounds.getMaxBound()->toString() + "\n",
-				 false);
 			int dataSize = 0;
-
-			ReadLocker rLocker(rwLock);
-			unsigned char* data = builder.build(x, y, lastTileBounds, dataSize);
-			rLocker.release();
+			unsigned char* data = builder.build(x, y, tileBounds, dataSize);
 
 			if (data) {
-				Locker wLocker(rwLock);
+				Locker locker(navMeshLock);
 				// Remove any previous data (navmesh owns and deletes the data).
-				m_navMesh->removeTile(m_navMesh->getTileRefAt(x, y, 0), 0, 0);
+				navMesh->removeTile(navMesh->getTileRefAt(x, y, 0), 0, 0);
 				// Let the navmesh own the data.
-				dtStatus status = m_navMesh->addTile(data, dataSize, DT_TILE_FREE_DATA, 0, 0);
+				dtStatus status = navMesh->addTile(data, dataSize, DT_TILE_FREE_DATA, 0, 0);
 
 				if (dtStatusFailed(status)) {
 					info("dtStatusFailed", true);
 					dtFree(data);
 				}
 			}
+
+			int finished = finishedTiles.increment();
+
+			if (finished % tilesPerRow == 0 || finished == size())
+				info("Generating tiles: " + String::valueOf(finished * 100 / size()) + "% complete", true);
+
+			if (finished == size()) {
+				finishedMutex.lock();
+				finishedCondition.broadcast(&finishedMutex);
+				finishedMutex.unlock();
+			}
 		}
-		progress.add(tw);
-		info("Generating tiles: " + String::valueOf(progress.get() * 100 / (th * tw)) + "% complete", true);
+	}
+};
+
+void RecastNavMeshBuilder::buildTiles(RecastTileBatch* batch) {
+	if (batch->size() == 0)
+		return;
+
+	Reference<RecastTileBatch*> strongBatch = batch;
+
+	Time start;
 
+	// the build thread works on tiles too, helpers that never get a thread
+	// in time just find the batch drained
+	int helpers = tileQueue.isEmpty() ? 0 : MIN(maxTileWorkers, batch->size()) - 1;
+
+	for (int i = 0; i < helpers; ++i) {
+		Core::getTaskManager()->executeTask([=] {
+			strongBatch->buildTiles();
+		}, "buildNavMeshTiles", tileQueue.toCharArray());
 	}
-}
 
+	batch->buildTiles();
 
-void RecastNavMeshBuilder::buildAllTiles() {
-	if (!m_geom) return;
-	if (!m_navMesh) return;
+	batch->waitFinished();
 
+	uint64 elapsed = MAX(start.miliDifference(), 1);
+
+	info("Built " + String::valueOf(batch->size()) + " tiles in " + String::valueOf(elapsed) + " ms ("
+			+ String::valueOf(batch->size() * 1000.f / elapsed) + " tiles/s, " + String::valueOf(helpers + 1) + " threads)");
+}
+
+RecastTileBatch* RecastNavMeshBuilder::createTileBatch() {
 	const Vector <Vector3>* vertArray = m_geom->getVerts();
 	const Vector <MeshTriangle>* triArray = m_geom->getTriangles();
 
 	const int nverts = vertArray->size();
-	float* verts = new float[nverts * 3];//m_geom->getMesh()->getVerts();
+	float* verts = new float[nverts * 3];
 
 	int* tris = new int[triArray->size() * 3];
 	for (int i = 0; i < nverts; i++) {
@@ -407,70 +417,122 @@ void RecastNavMeshBuilder::buildAllTiles() {
 		memcpy(tris + (i * 3), triArray->get(i).getVerts(), sizeof(int) * 3);
 	}
 
-	float bmin[3];
-	float bmax[3];
-
-	bmin[0] = bounds.getXMin();
-	bmin[1] = bounds.getYMin();
-	bmin[2] = bounds.getZMin();
+	RecastTileBatch* batch = new RecastTileBatch(name);
 
+	batch->bmin[0] = bounds.getXMin();
+	batch->bmin[1] = bounds.getYMin();
+	batch->bmin[2] = bounds.getZMin();
 
-	bmax[0] = bounds.getXMax();
-	bmax[1] = bounds.getYMax();
-	bmax[2] = bounds.getZMax();
-	int gw = 0, gh = 0;
-	rcCalcGridSize(bmin, bmax, settings.m_cellSize, &gw, &gh);
-	const int ts = (int) settings.m_tileSize;
-	const int tw = (gw + ts - 1) / ts;
-	const int th = (gh + ts - 1) / ts;
-	const float tcs = settings.m_tileSize * settings.m_cellSize;
+	batch->bmax[0] = bounds.getXMax();
+	batch->bmax[1] = bounds.getYMax();
+	batch->bmax[2] = bounds.getZMax();
 
-	rcChunkyTriMesh mesh;
-	rcCreateChunkyTriMesh(verts, tris, triArray->size(), 256, &mesh);
-	const rcChunkyTriMesh* chunkyMesh = &mesh;
-	// Start the build process.
+	batch->tcs = settings.m_tileSize * settings.m_cellSize;
 
-	AtomicInteger jobStatus;
-	AtomicInteger progress;
+	rcCreateChunkyTriMesh(verts, tris, triArray->size(), 256, &batch->chunkyMesh);
 
 	delete[] tris;
 	delete[] verts;
 
-	RecastTileBuilder builder(waterTableHeight, 0, 0, lastTileBounds, chunkyMesh, settings);
-	builder.changeMesh(m_geom);
-	builder.setWater(water);
+	batch->geom = m_geom;
+	batch->water = water;
+	batch->settings = settings;
+	batch->waterTableHeight = waterTableHeight;
+	batch->navMesh = m_navMesh;
 
-	for (int y = 0; y < th; ++y) {
-		for (int x = 0; x < tw; ++x) {
+	return batch;
+}
 
-			float minx = bmin[0] + x * tcs;
-			float miny = bmin[1];
-			float minz = bmin[2] + y * tcs;
+void RecastNavMeshBuilder::getAreaTiles(const AABB& meshBounds, const RecastSettings& settings, const AABB& buildArea, SortedVector<uint32>& tiles) {
+	const float tcs = settings.m_tileSize * settings.m_cellSize;
 
-			float maxx = bmin[0] + (x + 1) * tcs;
-			float maxy = bmax[1];
-			float maxz = bmin[2] + (y + 1) * tcs;
-			lastTileBounds = AABB(Vector3(minx, miny, minz), Vector3(maxx, maxy, maxz));
+	float longest = buildArea.extents()[buildArea.longestAxis()];
+	longest = MAX(tcs * 2.25, longest);
 
-			int dataSize = 0;
-			unsigned char* data = builder.build(x, y, lastTileBounds, dataSize);
-			if (data) {
-				// Remove any previous data (navmesh owns and deletes the data).
-				m_navMesh->removeTile(m_navMesh->getTileRefAt(x, y, 0), 0, 0);
-				// Let the navmesh own the data.
-				dtStatus status = m_navMesh->addTile(data, dataSize, DT_TILE_FREE_DATA, 0, 0);
+	Vector3 center = buildArea.midPoint();
+	//un-fucking (or re-fucking) our coordinate system
+	AABB area = AABB(Vector3(center.getX() - longest, -100000, -center.getY() - longest),
+				Vector3(center.getX() + longest, 100000, -center.getY() + longest));
 
-				if (dtStatusFailed(status)) {
-					info("dtStatusFailed", true);
-					dtFree(data);
-				}
-			} else {
-				info("No data", true);
-			}
+	float zStart = (fabs(meshBounds.getZMin() - area.getZMin()) / tcs) - 1.0f;
+	float xStart = (fabs(meshBounds.getXMin() - area.getXMin()) / tcs) - 1.0f;
+
+	int th = ceil((fabs(meshBounds.getZMin() - area.getZMax()) / tcs) + 1.0f);
+	int tw = ceil((fabs(meshBounds.getXMin() - area.getXMax()) / tcs) + 1.0f);
+
+	if (zStart < 0 || xStart < 0)
+		return;
+
+	for (int y = floor(zStart); y < th; ++y) {
+		float zTileStart = meshBounds.getZMin() + ((y + 1) * tcs);
+		if (zTileStart < area.getZMin() || zTileStart > area.getZMax())
+			continue;
+
+		for (int x = floor(xStart); x < tw; ++x) {
+			float xTileStart = meshBounds.getXMin() + ((x + 1) * tcs);
+			if (xTileStart < area.getXMin() || xTileStart > area.getXMax())
+				continue;
+
+			tiles.put((uint32) x << 16 | (uint32) y);
+		}
+	}
+}
+
+void RecastNavMeshBuilder::buildAllTiles(RecastNavMesh* recastNavMesh, const Vector<AABB>& areas) {
+	if (!m_geom) return;
+	if (!m_navMesh) return;
+
+	// overlapping areas share most of their tiles, every tile is built once
+	SortedVector<uint32> tiles;
+	tiles.setNoDuplicateInsertPlan();
+
+	for (int i = 0; i < areas.size(); ++i)
+		getAreaTiles(bounds, settings, areas.get(i), tiles);
+
+	if (tiles.size() == 0)
+		return;
+
+	Reference<RecastTileBatch*> batch = createTileBatch();
+
+	for (int i = 0; i < tiles.size(); ++i) {
+		uint32 tile = tiles.get(i);
+
+		batch->tiles.add(tile >> 16);
+		batch->tiles.add(tile & 0xFFFF);
+	}
+
+	batch->tilesPerRow = MAX((int) Math::sqrt(tiles.size()), 1);
+	batch->navMeshLock = recastNavMesh->getLock();
+
+	if (areas.size() > 1)
+		info("Rebuilding " + String::valueOf(areas.size()) + " areas with " + String::valueOf(tiles.size()) + " tiles", true);
+
+	buildTiles(batch);
+}
+
+
+void RecastNavMeshBuilder::buildAllTiles() {
+	if (!m_geom) return;
+	if (!m_navMesh) return;
+
+	Reference<RecastTileBatch*> batch = createTileBatch();
+
+	int gw = 0, gh = 0;
+	rcCalcGridSize(batch->bmin, batch->bmax, settings.m_cellSize, &gw, &gh);
+	const int ts = (int) settings.m_tileSize;
+	const int tw = (gw + ts - 1) / ts;
+	const int th = (gh + ts - 1) / ts;
+
+	for (int y = 0; y < th; ++y) {
+		for (int x = 0; x < tw; ++x) {
+			batch->tiles.add(x);
+			batch->tiles.add(y);
 		}
-		progress.add(tw);
-		info("Generating tiles: " + String::valueOf(progress.get() * 100 / (th * tw)) + "% complete", true);
 	}
+
+	batch->tilesPerRow = MAX(tw, 1);
+
+	buildTiles(batch);
 }
 
 void
@@ -30,6 +30,8 @@
 
 class RecastNavMesh;
 
+class RecastTileBatch;
+
 class MeshData;
 
 class BoundaryPolygon;
@@ -75,6 +77,18 @@ protected:
 	float waterTableHeight;
 	bool destroyMesh;
 	NavMeshSetHeader header;
+
+	// custom task queue the tiles of a build are spread over
+	String tileQueue;
+	int maxTileWorkers;
+
+	RecastTileBatch* createTileBatch();
+
+	/**
+	 * Builds the tiles of batch on up to maxTileWorkers threads and returns
+	 * once all of them are in the navmesh
+	 */
+	void buildTiles(RecastTileBatch* batch);
 public:
 	void initialize(Vector <Reference<MeshData*>>& meshData, const AABB& bounds, float distanceBetweenHeights = 2);
 
@@ -102,9 +116,19 @@ public:
 
 	virtual bool rebuildArea(const AABB& area, RecastNavMesh* existingMesh);
 
+	/**
+	 * Rebuilds the union of the tiles touched by areas, each of them once
+	 */
+	virtual bool rebuildAreas(const Vector<AABB>& areas, RecastNavMesh* existingMesh);
+
 	void buildAllTiles();
 
-	void buildAllTiles(RecastNavMesh* mesh, const AABB& areaToRebuild);
+	void buildAllTiles(RecastNavMesh* mesh, const Vector<AABB>& areasToRebuild);
+
+	/**
+	 * Adds the tiles of a mesh covering meshBounds that a rebuild of buildArea touches to tiles, as x << 16 | y
+	 */
+	static void getAreaTiles(const AABB& meshBounds, const RecastSettings& settings, const AABB& buildArea, SortedVector<uint32>& tiles);
 
 	RecastSettings& getRecastConfig() {
 		return settings;
@@ -118,6 +142,15 @@ public:
 		settings = config;
 	}
 
+	/**
+	 * Lets tiles be built in parallel on up to workers threads, the calling
+	 * thread being one of them
+	 */
+	void setTileWorkers(const String& queue, int workers) {
+		tileQueue = queue;
+		maxTileWorkers = MAX(workers, 1);
+	}
+
 	const NavMeshSetHeader& getNavMeshHeader() {
 		return header;
 	}
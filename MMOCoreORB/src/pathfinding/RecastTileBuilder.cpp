@@ -88,6 +88,8 @@ RecastTileBuilder::RecastTileBuilder(float waterTableHeight, float x, float y, c
 		m_maxPolysPerTile(0),
 		bounds(Vector3(0, 0, 0), Vector3(0, 0, 0)),
 		m_tileTriCount(0),
+		m_verts(0),
+		m_nverts(0),
 		waterTableHeight(waterTableHeight),
 		lastTileBounds(bounds) {
 
@@ -120,6 +122,7 @@ RecastTileBuilder::RecastTileBuilder(float waterTableHeight, float x, float y, c
 RecastTileBuilder::~RecastTileBuilder() {
 	m_geom = NULL;
 	cleanup();
+	delete[] m_verts;
 	delete m_ctx;
 }
 
@@ -199,21 +202,9 @@ unsigned char* RecastTileBuilder::buildTileMesh(const int tx, const int ty, int&
 
 	cleanup();
 
-	const Vector <Vector3>* vertArray = m_geom->getVerts();
-	const Vector <MeshTriangle>* triArray = m_geom->getTriangles();
+	const float* verts = m_verts;
+	const int nverts = m_nverts;
 
-	const int nverts = vertArray->size();
-	float* verts = new float[nverts * 3];//m_geom->getMesh()->getVerts();
-
-	for (int i = 0; i < nverts; i++) {
-		const Vector3& vert = vertArray->get(i);
-		verts[i * 3 + 0] = vert.getX();
-		verts[i * 3 + 1] = vert.getY();
-		verts[i * 3 + 2] = vert.getZ();
-	}
-
-
-	const int ntris = triArray->size();
 	//const rcChunkyTriMesh* chunkyMesh = m_geom->getChunkyMesh();
 
 	// Expand the heighfield bounding box by border size to find the extents of geometry we need to build this tile.
@@ -531,7 +522,6 @@ unsigned char* RecastTileBuilder::buildTileMesh(const int tx, const int ty, int&
 	//m_ctx->log(RC_LOG_PROGRESS, ">> Polymesh: %d vertices  %d polygons", m_pmesh->nverts, m_pmesh->npolys);
 
 	//m_tileBuildTime = m_ctx->getAccumulatedTime(RC_TIMER_TOTAL)/1000.0f;
-	delete[] verts;
 
 	dataSize = navDataSize;
 	return navData;
@@ -542,4 +532,17 @@ void RecastTileBuilder::changeMesh(MeshData* geom) {
 
 	m_geom = geom;
 	bounds = geom->buildAABB();
+
+	const Vector <Vector3>* vertArray = geom->getVerts();
+
+	delete[] m_verts;
+	m_nverts = vertArray->size();
+	m_verts = new float[m_nverts * 3];
+
+	for (int i = 0; i < m_nverts; i++) {
+		const Vector3& vert = vertArray->get(i);
+		m_verts[i * 3 + 0] = vert.getX();
+		m_verts[i * 3 + 1] = vert.getY();
+		m_verts[i * 3 + 2] = vert.getZ();
+	}
 }
@@ -98,6 +98,10 @@ protected:
 	AABB bounds;
 	int m_tileTriCount;
 
+	// vertices of m_geom flattened once for every tile built by this builder
+	float* m_verts;
+	int m_nverts;
+
 	unsigned char* buildTileMesh(const int tx, const int ty, int& dataSize);
 
 	void cleanup();
@@ -50,6 +50,7 @@
 #include "server/chat/room/ChatRoomMap.h"
 #include "server/chat/SendMailTask.h"
 #include "server/zone/packets/chat/ChatSystemMessage.h"
+#include "server/zone/packets/BroadcastPacket.h"
 
 ChatManagerImplementation::ChatManagerImplementation(ZoneServer* serv, int initsize) : ManagedServiceImplementation() {
 	server = serv;
@@ -808,7 +809,7 @@ void ChatManagerImplementation::handleSocialInternalMessage(CreatureObject* send
 		if (object->isPlayerCreature()) {
 			CreatureObject* creature = cast<CreatureObject*>(object);
 
-			Reference<PlayerObject*> ghost = creature->getSlottedObject("ghost").castTo<PlayerObject*>();
+			Reference<PlayerObject*> ghost = creature->getKnownSlottedObject(SlotIndex::GHOST).castTo<PlayerObject*>();
 
 			if (ghost == NULL)
 				continue;
@@ -851,52 +852,39 @@ void ChatManagerImplementation::sendRoomList(CreatureObject* player) {
 }
 
 void ChatManagerImplementation::addPlayer(CreatureObject* player) {
-	Locker _locker(_this.getReferenceUnsafeStaticCast());
-
-	String name = player->getFirstName().toLowerCase();
-	playerMap->put(name, player, false);
+	// the player map has its own lock, tells and broadcasts don't wait for logins
+	playerMap->put(player->getFirstName(), player);
 }
 
 CreatureObject* ChatManagerImplementation::getPlayer(const String& name) {
-	Locker _locker(_this.getReferenceUnsafeStaticCast());
-
-	CreatureObject* player = NULL;
-
-	try {
-		String lName = name.toLowerCase();
-
-		player = playerMap->get(lName, false);
-	} catch (Exception& e) {
-		System::out << e.getMessage();
-		e.printStackTrace();
-	}
-
-	return player;
+	return playerMap->get(name);
 }
 
 CreatureObject* ChatManagerImplementation::removePlayer(const String& name) {
-	Locker _locker(_this.getReferenceUnsafeStaticCast());
-
-	String lName = name.toLowerCase();
-
-	CreatureObject* player = playerMap->remove(lName, false);
-
-	return player;
+	return playerMap->remove(name);
 }
 
 void ChatManagerImplementation::broadcastGalaxy(const String& message, const String& faction) {
-	Locker locker(_this.getReferenceUnsafeStaticCast());
-
-	playerMap->resetIterator(false);
+	Reference<PlayerMapSnapshot*> players = playerMap->getSnapshot();
 
 	uint32 factionCRC = faction.hashCode();
 
-	while (playerMap->hasNext(false)) {
-		ManagedReference<CreatureObject*> playerObject = playerMap->getNextValue(false);
+	UnicodeString text(message);
+	BroadcastPacket<ManagedReference<CreatureObject*> > broadcast(new ChatSystemMessage(text));
+
+	for (int i = 0; i < players->size(); ++i) {
+		const ManagedReference<CreatureObject*>& playerObject = players->get(i);
+
+		if (playerObject == NULL)
+			continue;
+
+		PlayerObject* ghost = playerObject->getPlayerObject();
 
-		if (playerObject->getFaction() == factionCRC || playerObject->getPlayerObject()->hasGodMode())
-			playerObject->sendSystemMessage(message);
+		if (playerObject->getFaction() == factionCRC || (ghost != NULL && ghost->hasGodMode()))
+			broadcast.sendTo(playerObject);
 	}
+
+	broadcast.flush();
 }
 
 void ChatManagerImplementation::broadcastGalaxy(CreatureObject* player, const String& message) {
@@ -908,33 +896,36 @@ void ChatManagerImplementation::broadcastGalaxy(CreatureObject* player, const St
 	StringBuffer fullMessage;
 	fullMessage << "[" << firstName << "] " << message;
 
-	Locker locker(_this.getReferenceUnsafeStaticCast());
-	//playerMap->lock();
+	Reference<PlayerMapSnapshot*> players = playerMap->getSnapshot();
 
-	playerMap->resetIterator(false);
+	UnicodeString text(fullMessage.toString());
+	BroadcastPacket<ManagedReference<CreatureObject*> > broadcast(new ChatSystemMessage(text));
 
-	while (playerMap->hasNext(false)) {
-		ManagedReference<CreatureObject*> playerObject = playerMap->getNextValue(false);
+	for (int i = 0; i < players->size(); ++i) {
+		const ManagedReference<CreatureObject*>& playerObject = players->get(i);
 
-		playerObject->sendSystemMessage(fullMessage.toString());
+		if (playerObject != NULL)
+			broadcast.sendTo(playerObject);
 	}
+
+	broadcast.flush();
 }
 
 void ChatManagerImplementation::broadcastMessage(BaseMessage* message) {
-	Locker _lock(_this.getReferenceUnsafeStaticCast());
+	Reference<PlayerMapSnapshot*> players = playerMap->getSnapshot();
 
-	playerMap->resetIterator(false);
+	BroadcastPacket<ManagedReference<CreatureObject*> > broadcast(message);
 
-	while (playerMap->hasNext(false)) {
-		ManagedReference<CreatureObject*> player = playerMap->getNextValue(false);
+	for (int i = 0; i < players->size(); ++i) {
+		const ManagedReference<CreatureObject*>& player = players->get(i);
 
 		if (player == NULL || !player->isOnline())
 			continue;
 
-		player->sendMessage(message->clone());
+		broadcast.sendTo(player);
 	}
 
-	delete message;
+	broadcast.flush();
 	message = NULL;
 }
 
@@ -12,6 +12,7 @@
 #include "server/zone/packets/chat/ChatRoomList.h"
 #include "server/zone/packets/chat/ChatOnDestroyRoom.h"
 #include "server/zone/packets/chat/ChatOnLeaveRoom.h"
+#include "server/zone/packets/BroadcastPacket.h"
 #include "server/zone/managers/player/PlayerManager.h"
 
 void ChatRoomImplementation::init(ZoneServer* serv, ChatRoom* parent, const String& roomName) {
@@ -97,14 +98,16 @@ void ChatRoomImplementation::removeAllPlayers() {
 void ChatRoomImplementation::broadcastMessage(BaseMessage* msg) {
 	Locker locker(_this.getReferenceUnsafeStaticCast());
 
+	BroadcastPacket<ManagedReference<CreatureObject*> > broadcast(msg);
+
 	for (int i = 0; i < playerList.size(); ++i) {
 		ManagedReference<CreatureObject*> player = playerList.get(i);
 
 		if (player != NULL)
-			player->sendMessage(msg->clone());
+			broadcast.sendTo(player);
 	}
 
-	delete msg;
+	broadcast.flush();
 }
 
 void ChatRoomImplementation::broadcastMessages(Vector<BaseMessage*>* messages) {
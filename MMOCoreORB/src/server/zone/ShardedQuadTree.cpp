@@ -0,0 +1,267 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#include "ShardedQuadTree.h"
+
+#include "engine/util/u3d/CloseObjectsVector.h"
+
+ShardedQuadTree::ShardedQuadTree(float minx, float miny, float maxx, float maxy) {
+	minX = minx;
+	minY = miny;
+	maxX = maxx;
+	maxY = maxy;
+
+	shardWidth = (maxX - minX) / SHARDSPERAXIS;
+	shardHeight = (maxY - minY) / SHARDSPERAXIS;
+
+	for (int row = 0; row < SHARDSPERAXIS; ++row) {
+		for (int column = 0; column < SHARDSPERAXIS; ++column) {
+			float shardMinX = minX + column * shardWidth;
+			float shardMinY = minY + row * shardHeight;
+
+			shards[row * SHARDSPERAXIS + column].tree = new QuadTree(shardMinX, shardMinY, shardMinX + shardWidth, shardMinY + shardHeight);
+		}
+	}
+}
+
+int ShardedQuadTree::getShardIndex(float x, float y) const {
+	int column = (int) ((x - minX) / shardWidth);
+	int row = (int) ((y - minY) / shardHeight);
+
+	column = Math::max(0, Math::min(SHARDSPERAXIS - 1, column));
+	row = Math::max(0, Math::min(SHARDSPERAXIS - 1, row));
+
+	return row * SHARDSPERAXIS + column;
+}
+
+void ShardedQuadTree::getShardRange(float x, float y, float range, int& firstColumn, int& firstRow, int& lastColumn, int& lastRow) const {
+	firstColumn = Math::max(0, (int) ((x - range - minX) / shardWidth));
+	firstRow = Math::max(0, (int) ((y - range - minY) / shardHeight));
+	lastColumn = Math::min(SHARDSPERAXIS - 1, (int) ((x + range - minX) / shardWidth));
+	lastRow = Math::min(SHARDSPERAXIS - 1, (int) ((y + range - minY) / shardHeight));
+}
+
+int ShardedQuadTree::getOwnerShard(QuadTreeEntry* entry) {
+	uint64 oid = entry->getObjectID();
+	OwnerStripe* stripe = getOwnerStripe(oid);
+
+	Locker locker(&stripe->lock);
+
+	if (!stripe->shards.containsKey(oid))
+		return -1;
+
+	return stripe->shards.get(oid);
+}
+
+void ShardedQuadTree::setOwnerShard(QuadTreeEntry* entry, int shard) {
+	uint64 oid = entry->getObjectID();
+	OwnerStripe* stripe = getOwnerStripe(oid);
+
+	Locker locker(&stripe->lock);
+
+	stripe->shards.put(oid, shard);
+}
+
+void ShardedQuadTree::removeOwnerShard(QuadTreeEntry* entry) {
+	uint64 oid = entry->getObjectID();
+	OwnerStripe* stripe = getOwnerStripe(oid);
+
+	Locker locker(&stripe->lock);
+
+	stripe->shards.remove(oid);
+}
+
+void ShardedQuadTree::insert(QuadTreeEntry* entry) {
+	int index = getShardIndex(entry->getPositionX(), entry->getPositionY());
+	Shard* shard = &shards[index];
+
+	Locker locker(&shard->lock);
+
+	shard->tree->insert(entry);
+
+	setOwnerShard(entry, index);
+}
+
+void ShardedQuadTree::remove(QuadTreeEntry* entry) {
+	while (true) {
+		int index = getOwnerShard(entry);
+
+		if (index < 0)
+			return;
+
+		Shard* shard = &shards[index];
+
+		Locker locker(&shard->lock);
+
+		// an update moved the entry to another shard before we got the lock
+		if (getOwnerShard(entry) != index)
+			continue;
+
+		if (entry->isInQuadTree())
+			shard->tree->remove(entry);
+
+		removeOwnerShard(entry);
+
+		return;
+	}
+}
+
+void ShardedQuadTree::update(QuadTreeEntry* entry) {
+	while (true) {
+		// an entry that isn't owned by a shard was removed, or not inserted yet, and is left to insert
+		int oldIndex = getOwnerShard(entry);
+
+		if (oldIndex < 0)
+			return;
+
+		int newIndex = getShardIndex(entry->getPositionX(), entry->getPositionY());
+
+		if (oldIndex == newIndex) {
+			Locker locker(&shards[oldIndex].lock);
+
+			if (updateLocked(entry, oldIndex, newIndex))
+				return;
+
+			continue;
+		}
+
+		// always lock the lower shard first so two objects crossing the same border in opposite directions can't deadlock
+		Locker firstLocker(&shards[Math::min(oldIndex, newIndex)].lock);
+		Locker secondLocker(&shards[Math::max(oldIndex, newIndex)].lock);
+
+		if (updateLocked(entry, oldIndex, newIndex))
+			return;
+	}
+}
+
+bool ShardedQuadTree::updateLocked(QuadTreeEntry* entry, int oldIndex, int newIndex) {
+	// removed or moved by another thread before we got the locks
+	if (getOwnerShard(entry) != oldIndex)
+		return false;
+
+	if (!entry->isInQuadTree())
+		return true;
+
+	if (oldIndex == newIndex) {
+		shards[oldIndex].tree->update(entry);
+
+		return true;
+	}
+
+	shards[oldIndex].tree->remove(entry);
+	shards[newIndex].tree->insert(entry);
+
+	setOwnerShard(entry, newIndex);
+
+	return true;
+}
+
+int ShardedQuadTree::inRange(float x, float y, float range, SortedVector<ManagedReference<QuadTreeEntry*> >& objects) {
+	int firstColumn, firstRow, lastColumn, lastRow;
+	getShardRange(x, y, range, firstColumn, firstRow, lastColumn, lastRow);
+
+	for (int row = firstRow; row <= lastRow; ++row) {
+		for (int column = firstColumn; column <= lastColumn; ++column) {
+			Shard* shard = &shards[row * SHARDSPERAXIS + column];
+
+			ReadLocker locker(&shard->lock);
+
+			shard->tree->inRange(x, y, range, objects);
+		}
+	}
+
+	return objects.size();
+}
+
+int ShardedQuadTree::inRange(float x, float y, float range, InRangeObjectsVector& objects) {
+	int firstColumn, firstRow, lastColumn, lastRow;
+	getShardRange(x, y, range, firstColumn, firstRow, lastColumn, lastRow);
+
+	for (int row = firstRow; row <= lastRow; ++row) {
+		for (int column = firstColumn; column <= lastColumn; ++column) {
+			Shard* shard = &shards[row * SHARDSPERAXIS + column];
+
+			ReadLocker locker(&shard->lock);
+
+			shard->tree->inRange(x, y, range, objects);
+		}
+	}
+
+	return objects.size();
+}
+
+int ShardedQuadTree::inRange(QuadTreeEntry* entry, float range) {
+	CloseObjectsVector* closeObjectsVector = (CloseObjectsVector*) entry->getCloseObjects();
+
+	float rangesq = range * range;
+
+	float x = entry->getPositionX();
+	float y = entry->getPositionY();
+
+	float oldx = entry->getPreviousPositionX();
+	float oldy = entry->getPreviousPositionY();
+
+	//remove old ones, the objects that left range may live in a shard we no longer overlap
+	if (closeObjectsVector != NULL) {
+		SortedVector<QuadTreeEntry*> closeObjects(closeObjectsVector->size(), 10);
+		closeObjectsVector->safeCopyTo(closeObjects);
+
+		for (int i = 0; i < closeObjects.size(); ++i) {
+			QuadTreeEntry* o = closeObjects.get(i);
+			QuadTreeEntry* objectToRemove = o;
+			ManagedReference<QuadTreeEntry*> rootParent = o->getRootParent();
+
+			if (rootParent != NULL)
+				o = rootParent;
+
+			if (o == entry)
+				continue;
+
+			float deltaX = x - o->getPositionX();
+			float deltaY = y - o->getPositionY();
+
+			if (deltaX * deltaX + deltaY * deltaY > rangesq) {
+				float oldDeltaX = oldx - o->getPositionX();
+				float oldDeltaY = oldy - o->getPositionY();
+
+				if (oldDeltaX * oldDeltaX + oldDeltaY * oldDeltaY <= rangesq) {
+					if (entry->getCloseObjects() != NULL)
+						entry->removeInRangeObject(objectToRemove);
+
+					if (objectToRemove->getCloseObjects() != NULL)
+						objectToRemove->removeInRangeObject(entry);
+				}
+			}
+		}
+	}
+
+	//insert new ones from every shard the range overlaps
+	InRangeObjectsVector inRangeObjects;
+	inRange(x, y, range, inRangeObjects);
+
+	int count = 0;
+
+	for (int i = 0; i < inRangeObjects.size(); ++i) {
+		QuadTreeEntry* o = inRangeObjects.get(i);
+
+		if (o == entry)
+			continue;
+
+		float deltaX = x - o->getPositionX();
+		float deltaY = y - o->getPositionY();
+
+		if (deltaX * deltaX + deltaY * deltaY > rangesq)
+			continue;
+
+		++count;
+
+		if (entry->getCloseObjects() != NULL)
+			entry->addInRangeObject(o, false);
+
+		if (o->getCloseObjects() != NULL)
+			o->addInRangeObject(entry, true);
+	}
+
+	return count;
+}
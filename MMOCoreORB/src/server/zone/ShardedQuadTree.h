@@ -0,0 +1,88 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#ifndef SHARDEDQUADTREE_H_
+#define SHARDEDQUADTREE_H_
+
+#include "engine/engine.h"
+
+#include "engine/util/u3d/QuadTree.h"
+#include "engine/util/u3d/QuadTreeEntry.h"
+
+#include "server/zone/InRangeObjectsVector.h"
+
+/**
+ * Spatial index for zone objects split into a fixed grid of independently
+ * locked quad trees, so movement in different areas of a planet does not
+ * contend on a single lock.
+ *
+ * Each entry lives in the shard that contains its position. Moving across a
+ * shard border write locks both shards in index order and migrates the entry.
+ * Range queries read lock every shard the query circle overlaps in turn.
+ *
+ * The owner shard of an entry is only changed with that shard locked, so
+ * insert, remove and update don't need the zone lock. Remove and update
+ * check the owner again once they hold the shard locks.
+ */
+class ShardedQuadTree : public Object {
+public:
+	const static int SHARDSPERAXIS = 16;
+	const static int SHARDCOUNT = SHARDSPERAXIS * SHARDSPERAXIS;
+	const static int OWNERSTRIPES = 64;
+
+protected:
+	class Shard {
+	public:
+		Reference<QuadTree*> tree;
+		ReadWriteLock lock;
+	};
+
+	class OwnerStripe {
+	public:
+		HashTable<uint64, int> shards;
+		Mutex lock;
+	};
+
+	float minX, minY, maxX, maxY;
+	float shardWidth, shardHeight;
+
+	Shard shards[SHARDCOUNT];
+	OwnerStripe owners[OWNERSTRIPES];
+
+public:
+	ShardedQuadTree(float minx, float miny, float maxx, float maxy);
+
+	void insert(QuadTreeEntry* entry);
+	void remove(QuadTreeEntry* entry);
+	void update(QuadTreeEntry* entry);
+
+	/**
+	 * Updates the close objects of entry against every shard in range,
+	 * notifying both sides of any object entering or leaving range.
+	 */
+	int inRange(QuadTreeEntry* entry, float range);
+
+	int inRange(float x, float y, float range, SortedVector<ManagedReference<QuadTreeEntry*> >& objects);
+	int inRange(float x, float y, float range, InRangeObjectsVector& objects);
+
+protected:
+	int getShardIndex(float x, float y) const;
+	void getShardRange(float x, float y, float range, int& firstColumn, int& firstRow, int& lastColumn, int& lastRow) const;
+
+	OwnerStripe* getOwnerStripe(uint64 objectID) {
+		return &owners[(objectID ^ (objectID >> 32)) % OWNERSTRIPES];
+	}
+
+	/**
+	 * Moves entry from shard oldIndex to newIndex with both shards locked
+	 * @return false if entry is no longer owned by oldIndex and the update needs to be retried
+	 */
+	bool updateLocked(QuadTreeEntry* entry, int oldIndex, int newIndex);
+
+	int getOwnerShard(QuadTreeEntry* entry);
+	void setOwnerShard(QuadTreeEntry* entry, int shard);
+	void removeOwnerShard(QuadTreeEntry* entry);
+};
+
+#endif /* SHARDEDQUADTREE_H_ */
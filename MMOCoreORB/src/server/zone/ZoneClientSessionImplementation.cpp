@@ -44,6 +44,10 @@ void ZoneClientSessionImplementation::sendMessage(BasePacket* msg) {
 	session->sendPacket(msg);
 }
 
+void ZoneClientSessionImplementation::sendSharedMessage(SharedPacket* packet) {
+	session->sendPacket(packet->createPacket());
+}
+
 
 //this needs to be run in a different thread
 void ZoneClientSessionImplementation::disconnect(bool doLock) {
@@ -69,7 +73,7 @@ void ZoneClientSessionImplementation::disconnect(bool doLock) {
 
 		closeConnection(true, false);
 	} else if (player != NULL) {
-		Reference<PlayerObject*> ghost = player->getSlottedObject("ghost").castTo<PlayerObject*>();
+		Reference<PlayerObject*> ghost = player->getKnownSlottedObject(SlotIndex::GHOST).castTo<PlayerObject*>();
 
 		if (ghost->isLoggingOut() && player->getClient() == _this.getReferenceUnsafeStaticCast()) {
 			//((CreatureObject*)player.get())->logout(true);
@@ -13,6 +13,7 @@
 #include "server/zone/objects/area/ActiveArea.h"
 #include "server/zone/objects/staticobject/StaticObject.h"
 #include "server/zone/managers/planet/PlanetManager.h"
+#include "server/zone/managers/planet/BuildabilityMap.h"
 #include "terrain/manager/TerrainManager.h"
 #include "templates/building/SharedBuildingObjectTemplate.h"
 #include "server/zone/objects/pathfinding/NavMeshRegion.h"
@@ -44,6 +45,9 @@ bool ZoneContainerComponent::insertActiveArea(Zone* newZone, ActiveArea* activeA
 
 	regionTree->insert(activeArea);
 
+	if (activeArea->isRegion() || activeArea->isMunicipalZone() || activeArea->isNoSpawnArea() || activeArea->isNoBuildArea())
+		newZone->getBuildabilityMap()->touch(activeArea->getPositionX(), activeArea->getPositionY(), activeArea->getRadius());
+
 	//regionTree->inRange(activeArea, 512);
 
 	// lets update area to the in range players
@@ -88,6 +92,9 @@ bool ZoneContainerComponent::removeActiveArea(Zone* zone, ActiveArea* activeArea
 
 	regionTree->remove(activeArea);
 
+	if (activeArea->isRegion() || activeArea->isMunicipalZone() || activeArea->isNoSpawnArea() || activeArea->isNoBuildArea())
+		zone->getBuildabilityMap()->touch(activeArea->getPositionX(), activeArea->getPositionY(), activeArea->getRadius());
+
 	// lets remove the in range active areas of players
 	SortedVector<QuadTreeEntry*> objects;
 	float range = activeArea->getRadius() + 64;
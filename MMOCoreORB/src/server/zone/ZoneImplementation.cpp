@@ -36,7 +36,9 @@ ZoneImplementation::ZoneImplementation(ZoneProcessServer* serv, const String& na
 	zoneCRC = name.hashCode();
 
 	regionTree = new QuadTree(-8192, -8192, 8192, 8192);
-	quadTree = new QuadTree(-8192, -8192, 8192, 8192);
+	quadTree = new ShardedQuadTree(-8192, -8192, 8192, 8192);
+	collisionTree = new StaticCollisionTree();
+	buildabilityMap = new BuildabilityMap();
 
 	objectMap = new ObjectMap();
 
@@ -112,6 +114,8 @@ void ZoneImplementation::stopManagers() {
 	mapLocations = NULL;
 	objectMap = NULL;
 	quadTree = NULL;
+	collisionTree = NULL;
+	buildabilityMap = NULL;
 	regionTree = NULL;
 }
 
@@ -166,41 +170,35 @@ float ZoneImplementation::getHeightNoCache(float x, float y) {
 	return 0;
 }
 
+// the sharded quad tree locks only the shards it touches, so these don't need the zone lock
 void ZoneImplementation::insert(QuadTreeEntry* entry) {
-	Locker locker(_this.getReferenceUnsafeStaticCast());
-
 	quadTree->insert(entry);
+
+	collisionTree->insert(static_cast<SceneObject*>(entry));
+	buildabilityMap->insert(static_cast<SceneObject*>(entry));
 }
 
 void ZoneImplementation::remove(QuadTreeEntry* entry) {
-	Locker locker(_this.getReferenceUnsafeStaticCast());
+	collisionTree->remove(static_cast<SceneObject*>(entry));
+	buildabilityMap->remove(static_cast<SceneObject*>(entry));
 
 	if (entry->isInQuadTree())
 		quadTree->remove(entry);
 }
 
 void ZoneImplementation::update(QuadTreeEntry* entry) {
-	Locker locker(_this.getReferenceUnsafeStaticCast());
-
 	quadTree->update(entry);
+
+	collisionTree->update(static_cast<SceneObject*>(entry));
+	buildabilityMap->update(static_cast<SceneObject*>(entry));
 }
 
 void ZoneImplementation::inRange(QuadTreeEntry* entry, float range) {
-	quadTree->safeInRange(entry, range);
+	quadTree->inRange(entry, range);
 }
 
 int ZoneImplementation::getInRangeSolidObjects(float x, float y, float range, SortedVector<ManagedReference<QuadTreeEntry*> >* objects, bool readLockZone) {
-	bool readlock = readLockZone && !_this.getReferenceUnsafeStaticCast()->isLockedByCurrentThread();
-
-	try {
-		_this.getReferenceUnsafeStaticCast()->rlock(readlock);
-
-		quadTree->inRange(x, y, range, *objects);
-
-		_this.getReferenceUnsafeStaticCast()->runlock(readlock);
-	} catch (...) {
-		_this.getReferenceUnsafeStaticCast()->runlock(readlock);
-	}
+	quadTree->inRange(x, y, range, *objects);
 
 	if (objects->size() > 0) {
 		for (int i = objects->size()-1; i >= 0; i--) {
@@ -238,19 +236,9 @@ int ZoneImplementation::getInRangeSolidObjects(float x, float y, float range, So
 }
 
 int ZoneImplementation::getInRangeObjects(float x, float y, float range, SortedVector<ManagedReference<QuadTreeEntry*> >* objects, bool readLockZone) {
-	bool readlock = readLockZone && !_this.getReferenceUnsafeStaticCast()->isLockedByCurrentThread();
-
 	Vector<ManagedReference<QuadTreeEntry*> > buildingObjects;
 
-	try {
-		_this.getReferenceUnsafeStaticCast()->rlock(readlock);
-
-		quadTree->inRange(x, y, range, *objects);
-
-		_this.getReferenceUnsafeStaticCast()->runlock(readlock);
-	} catch (...) {
-		_this.getReferenceUnsafeStaticCast()->runlock(readlock);
-	}
+	quadTree->inRange(x, y, range, *objects);
 
 	for (int i = 0; i < objects->size(); ++i) {
 		SceneObject* sceneObject = cast<SceneObject*>(objects->get(i).get());
@@ -276,15 +264,13 @@ int ZoneImplementation::getInRangeObjects(float x, float y, float range, SortedV
 				}
 			}
 		} else if (sceneObject != NULL && (sceneObject->isVehicleObject() || sceneObject->isMount())) {
-			ManagedReference<SceneObject*> rider = sceneObject->getSlottedObject("rider");
+			ManagedReference<SceneObject*> rider = sceneObject->getKnownSlottedObject(SlotIndex::RIDER);
 
 			if (rider != NULL)
 				buildingObjects.add(rider.get());
 		}
 	}
 
-	//_this.getReferenceUnsafeStaticCast()->runlock(readlock);
-
 	for (int i = 0; i < buildingObjects.size(); ++i)
 		objects->put(buildingObjects.get(i));
 
@@ -292,19 +278,9 @@ int ZoneImplementation::getInRangeObjects(float x, float y, float range, SortedV
 }
 
 int ZoneImplementation::getInRangeObjects(float x, float y, float range, InRangeObjectsVector* objects, bool readLockZone) {
-	bool readlock = readLockZone && !_this.getReferenceUnsafeStaticCast()->isLockedByCurrentThread();
-
 	Vector<QuadTreeEntry*> buildingObjects;
 
-	try {
-		_this.getReferenceUnsafeStaticCast()->rlock(readlock);
-
-		quadTree->inRange(x, y, range, *objects);
-
-		_this.getReferenceUnsafeStaticCast()->runlock(readlock);
-	} catch (...) {
-		_this.getReferenceUnsafeStaticCast()->runlock(readlock);
-	}
+	quadTree->inRange(x, y, range, *objects);
 
 	for (int i = 0; i < objects->size(); ++i) {
 		SceneObject* sceneObject = static_cast<SceneObject*>(objects->get(i));
@@ -331,7 +307,7 @@ int ZoneImplementation::getInRangeObjects(float x, float y, float range, InRange
 				}
 			}
 		} else if (sceneObject != NULL && (sceneObject->isVehicleObject() || sceneObject->isMount())) {
-			ManagedReference<SceneObject*> rider = sceneObject->getSlottedObject("rider");
+			ManagedReference<SceneObject*> rider = sceneObject->getKnownSlottedObject(SlotIndex::RIDER);
 
 			if (rider != NULL)
 				buildingObjects.add(rider.get());
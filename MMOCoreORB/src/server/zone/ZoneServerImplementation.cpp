@@ -38,6 +38,7 @@
 #include "server/zone/managers/director/DirectorManager.h"
 #include "server/zone/managers/city/CityManager.h"
 #include "server/zone/managers/structure/StructureManager.h"
+#include "terrain/manager/TerrainManager.h"
 
 #include "server/chat/ChatManager.h"
 #include "server/zone/objects/creature/CreatureObject.h"
@@ -209,6 +210,9 @@ void ZoneServerImplementation::startZones() {
 	StructureManager* structureManager = StructureManager::instance();
 	structureManager->setZoneServer(_this.getReferenceUnsafeStaticCast());
 
+	Core::getTaskManager()->initializeCustomQueue(TerrainManager::RasterQueue.toCharArray(), 2);
+	Core::getTaskManager()->initializeCustomQueue("SpawnPool", 1);
+
 	for (int i = 0; i < enabledZones->size(); ++i) {
 		String zoneName = enabledZones->get(i);
 
@@ -7,6 +7,7 @@
 
 #include "server/zone/managers/auction/AuctionManager.h"
 #include "server/zone/managers/auction/AuctionsMap.h"
+#include "server/zone/managers/auction/AuctionSearch.h"
 #include "server/zone/managers/object/ObjectManager.h"
 #include "templates/manager/TemplateManager.h"
 #include "server/zone/managers/planet/PlanetManager.h"
@@ -934,11 +935,11 @@ int AuctionManagerImplementation::checkRetrieve(CreatureObject* player, uint64 o
 
 	int size = item->getSize();
 	if(saleItem->isIntangibleObject()) {
-		ManagedReference<SceneObject*> datapad = player->getSlottedObject("datapad");
+		ManagedReference<SceneObject*> datapad = player->getKnownSlottedObject(SlotIndex::DATAPAD);
 		if (datapad->getCountableObjectsRecursive() + size > datapad->getContainerVolumeLimit())
 			return RetrieveAuctionItemResponseMessage::FULLINVENTORY;
 	} else {
-		ManagedReference<SceneObject*> inventory = player->getSlottedObject("inventory");
+		ManagedReference<SceneObject*> inventory = player->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 		if (inventory->getCountableObjectsRecursive() + size > inventory->getContainerVolumeLimit())
 			return RetrieveAuctionItemResponseMessage::FULLINVENTORY;
@@ -1067,9 +1068,9 @@ void AuctionManagerImplementation::retrieveItem(CreatureObject* player, uint64 o
 	ManagedReference<SceneObject*> destination = NULL;
 
 	if(objectToRetrieve->isIntangibleObject())
-		destination = player->getSlottedObject("datapad");
+		destination = player->getKnownSlottedObject(SlotIndex::DATAPAD);
 	else
-		destination = player->getSlottedObject("inventory");
+		destination = player->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 	if(destination->transferObject(objectToRetrieve, -1, false)) {
 		destination->broadcastObject(objectToRetrieve, true);
@@ -1088,144 +1089,136 @@ void AuctionManagerImplementation::retrieveItem(CreatureObject* player, uint64 o
 	}
 }
 bool AuctionManagerImplementation::checkItemCategory(int category, AuctionItem* item) {
-	if (category & 255) { // Searching a sub category
-		if (item->getItemType() == category) {
-			return true;
+	return TerminalItemList::isTypeInCategory(category, item->getItemType());
+}
+/**
+ * Matches of an auction screen, expired sales it comes across are expired on the way
+ */
+class AuctionScreenFilter : public AuctionSearchFilter {
+	AuctionManager* manager;
+	CreatureObject* player;
+	SceneObject* vendor;
+	int screen;
+	uint32 category;
+	String pname;
+	uint32 now;
+
+public:
+	AuctionScreenFilter(AuctionManager* manager, CreatureObject* player, SceneObject* vendor, int screen, uint32 category) :
+		manager(manager), player(player), vendor(vendor), screen(screen), category(category) {
+		pname = player->getFirstName().toLowerCase();
+		now = time(0);
+	}
+
+	/// Screens paging by offset filter by category, they only walk the item types it matches
+	inline bool isPaged() {
+		return screen != 4 && screen != 5;
+	}
+
+	bool matchesTerminal(TerminalItemList* items) {
+		/// Exclude non-searchable vendor Items
+		return !(vendor->isBazaarTerminal() && screen == 7 && !items->isSearchable());
+	}
+
+	bool matchesType(int itemType) {
+		return !isPaged() || TerminalItemList::isTypeInCategory(category, itemType);
+	}
+
+	bool matches(AuctionItem* item) {
+		if(!item->isAuction() && item->getExpireTime() <= now) {
+			auto chatManager = manager;
+			ManagedReference<AuctionItem*> expiredItem = item;
+			EXECUTE_TASK_2(chatManager, expiredItem, {
+					chatManager_p->expireSale(expiredItem_p);
+			});
+			return false;
+		}
+
+		switch(screen) {
+		case 7: // Vendor search Bazaar && Vendor
+
+			if(vendor->isVendor() && item->getVendorID() != vendor->getObjectID()) {
+				if(item->getOwnerID() != player->getObjectID())
+					return false;
+			}
+		case 2: // All Auctions (Bazaar)
+			return item->getStatus() == AuctionItem::FORSALE;
+		case 3: // My auctions/sales
+			return item->getStatus() == AuctionItem::FORSALE && (item->getOwnerID() == player->getObjectID());
+		case 4: // My Bids
+			return item->isAuction() && item->getStatus() == AuctionItem::FORSALE && (item->getBidderName() == pname);
+		case 5: // Retrieve items screen
+			return (item->getStatus() == AuctionItem::SOLD && item->getBuyerID() == player->getObjectID()) ||
+					(item->getStatus() == AuctionItem::EXPIRED && item->getOwnerID() == player->getObjectID());
+		case 6: // Offers to Vendor (vendor owner)
+			return item->getStatus() == AuctionItem::OFFERED && item->getOfferToID() == player->getObjectID();
+		case 8: // Stockroom
+			return (item->getStatus() == AuctionItem::EXPIRED && item->getOwnerID() == player->getObjectID()) ||
+					(item->getStatus() == AuctionItem::SOLD && item->getBuyerID() == player->getObjectID());
+		case 9: // Offers to vendor (browsing player)
+			return item->getStatus() == AuctionItem::OFFERED && item->getOwnerID() == player->getObjectID();
 		}
-	} else if (item->getItemType() & category) {
-		return true;
 
-	} else if ((category == 8192) && (item->getItemType() < 256)) {
-		return true;
-	} else if (category == 0) { // Searching all items
-		return true;
+		return false;
 	}
+};
 
-	return false;
-}
 AuctionQueryHeadersResponseMessage* AuctionManagerImplementation::fillAuctionQueryHeadersResponseMessage(CreatureObject* player, SceneObject* vendor, TerminalListVector* terminalList, int screen, uint32 category, int clientcounter, int offset) {
 	AuctionQueryHeadersResponseMessage* reply = new AuctionQueryHeadersResponseMessage(screen, clientcounter, player);
 
-	String pname = player->getFirstName().toLowerCase();
-	uint32 now = time(0);
-	int displaying = 0;
 	/*System::out << "Screen =" + String::valueOf(screen) << endl;
 	System::out << "Category =" + String::valueOf(category) << endl;
 	System::out << "VendorItemSize =" + String::valueOf(auctionMap->getVendorItemCount()) << endl;
 	System::out << "AuctionItemSize =" + String::valueOf(auctionMap->getAuctionCount()) << endl;
 	System::out << "______________________________" << endl;*/
 
-	for (int j = 0; (j < terminalList->size()) && (displaying < (offset + 100)); ++j) {
+	AuctionScreenFilter filter(_this.getReferenceUnsafeStaticCast(), player, vendor, screen, category);
+	bool paged = filter.isPaged();
 
-		Reference<TerminalItemList*> items = terminalList->get(j);
+	uint64 query = ((uint64) screen << 32) ^ category ^ (vendor->getObjectID() * 31);
 
-		if(items == NULL)
-			continue;
+	for (int j = 0; j < terminalList->size(); ++j)
+		query = query * 31 + (uint64) terminalList->get(j).get();
 
-		/// Exclude non-searchable vendor Items
-		if(vendor->isBazaarTerminal() && screen == 7 && !items->isSearchable())
-			continue;
+	AuctionSearchCursor cursor;
 
-		try {
-			items->rlock();
+	if (paged && offset > 0) {
+		Locker locker(&searchCursors);
 
-			for (int i = 0; (i < items->size()) && (displaying < (offset + 100)); i++) {
-				ManagedReference<AuctionItem*> item = items->get(i);
+		if (searchCursors.containsKey(player->getObjectID()))
+			cursor = searchCursors.get(player->getObjectID());
+	}
 
-				if(item == NULL)
-					continue;
+	if (cursor.query != query || cursor.offset != offset)
+		cursor = AuctionSearchCursor();
 
-				if(!item->isAuction() && item->getExpireTime() <= now) {
-					auto chatManager = _this.getReferenceUnsafeStaticCast();
-					EXECUTE_TASK_2(chatManager, item, {
-							chatManager_p->expireSale(item_p);
-					});
-					continue;
-				}
+	Vector<ManagedReference<AuctionItem*> > items;
+	int displaying = 0;
 
-				switch(screen) {
-				case 7: // Vendor search Bazaar && Vendor
-
-					if(vendor->isVendor() && item->getVendorID() != vendor->getObjectID()) {
-						if(item->getOwnerID() != player->getObjectID())
-							continue;
-					}
-				case 2: // All Auctions (Bazaar)
-					if (item->getStatus() == AuctionItem::FORSALE) {
-						if(checkItemCategory(category, item)) {
-							if (displaying >= offset) {
-								reply->addItemToList(item);
-							}
-							displaying++;
-						}
-					}
-					break;
-				case 3: // My auctions/sales
-					if (item->getStatus() == AuctionItem::FORSALE && (item->getOwnerID() == player->getObjectID())) {
-						if(checkItemCategory(category, item)) {
-							if (displaying >= offset) {
-								reply->addItemToList(item);
-							}
-
-							displaying++;
-						}
-					}
-					break;
-				case 4: // My Bids
-					if (item->isAuction() && item->getStatus() == AuctionItem::FORSALE && (item->getBidderName() == pname)) {
-						reply->addItemToList(item);
-					}
-					break;
-				case 5: // Retrieve items screen
-					if ((item->getStatus() == AuctionItem::SOLD && item->getBuyerID() == player->getObjectID()) ||
-							(item->getStatus() == AuctionItem::EXPIRED && item->getOwnerID() == player->getObjectID())) {
-						reply->addItemToList(item);
-					}
-					break;
-				case 6: // Offers to Vendor (vendor owner)
-					if (item->getStatus() == AuctionItem::OFFERED && item->getOfferToID() == player->getObjectID()) {
-						if(checkItemCategory(category, item)) {
-							if (displaying >= offset) {
-								reply->addItemToList(item);
-							}
-
-							displaying++;
-						}
-					}
-					break;
-				case 8: // Stockroom
-					if ((item->getStatus() == AuctionItem::EXPIRED && item->getOwnerID() == player->getObjectID()) ||
-							(item->getStatus() == AuctionItem::SOLD && item->getBuyerID() == player->getObjectID())) {
-						if(checkItemCategory(category, item)) {
-							if (displaying >= offset) {
-								reply->addItemToList(item);
-							}
-
-							displaying++;
-						}
-					}
-					break;
-				case 9: // Offers to vendor (browsing player)
-					if (item->getStatus() == AuctionItem::OFFERED && item->getOwnerID() == player->getObjectID()) {
-						if(checkItemCategory(category, item)) {
-							if (displaying >= offset) {
-								reply->addItemToList(item);
-							}
-
-							displaying++;
-						}
-					}
-					break;
-				}
-			}
-			items->runlock();
-		} catch(Exception& e) {
-			error(e.getMessage());
-			items->runlock();
+	try {
+		displaying = AuctionSearch::search(terminalList, &filter, paged ? offset : 0, paged ? ITEMSPERPAGE : -1, cursor, items);
+	} catch(Exception& e) {
+		error(e.getMessage());
+	}
+
+	for (int i = 0; i < items.size(); ++i)
+		reply->addItemToList(items.get(i));
+
+	bool morePages = paged && displaying == (offset + ITEMSPERPAGE);
+
+	if (paged) {
+		Locker locker(&searchCursors);
+
+		if (morePages) {
+			cursor.query = query;
+
+			searchCursors.putCursor(player->getObjectID(), cursor);
+		} else {
+			searchCursors.remove(player->getObjectID());
 		}
 	}
 
-	if (displaying == (offset + 100))
+	if (morePages)
 		reply->createMessage(offset, true);
 	else
 		reply->createMessage(offset);
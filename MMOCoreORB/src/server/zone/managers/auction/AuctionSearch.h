@@ -0,0 +1,113 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#ifndef AUCTIONSEARCH_H_
+#define AUCTIONSEARCH_H_
+
+#include "server/zone/managers/auction/TerminalListVector.h"
+#include "server/zone/managers/auction/AuctionSearchCursors.h"
+
+/**
+ * Which terminals, item types and items an auction search lists
+ */
+class AuctionSearchFilter {
+public:
+	virtual ~AuctionSearchFilter() {
+	}
+
+	virtual bool matchesTerminal(TerminalItemList* items) {
+		return true;
+	}
+
+	virtual bool matchesType(int itemType) {
+		return true;
+	}
+
+	virtual bool matches(AuctionItem* item) = 0;
+};
+
+class AuctionSearch {
+public:
+	/**
+	 * Lists the matches of filter in terminals from match number offset on
+	 * @param limit most matches to list, negative to list every match from offset on
+	 * @param cursor where the page before offset stopped, or a start cursor to count
+	 * the matches from the first one; set to where this page stopped when it is full
+	 * @return number of matches counted, including the ones before offset
+	 */
+	static int search(TerminalListVector* terminals, AuctionSearchFilter* filter, int offset, int limit, AuctionSearchCursor& cursor, Vector<ManagedReference<AuctionItem*> >& results) {
+		AuctionSearchCursor resume = cursor;
+		int firstTerminal = 0;
+		int displaying = 0;
+
+		cursor = AuctionSearchCursor();
+
+		if (!resume.isStart()) {
+			firstTerminal = -1;
+
+			for (int j = 0; j < terminals->size(); ++j) {
+				TerminalItemList* items = terminals->get(j);
+
+				if (items != NULL && items->getVendorID() == resume.terminalID) {
+					firstTerminal = j;
+					break;
+				}
+			}
+
+			// the terminal went away, count from the first match
+			if (firstTerminal == -1) {
+				resume = AuctionSearchCursor();
+				firstTerminal = 0;
+			} else {
+				displaying = resume.offset;
+			}
+		}
+
+		for (int j = firstTerminal; j < terminals->size() && (limit < 0 || displaying < offset + limit); ++j) {
+			Reference<TerminalItemList*> items = terminals->get(j);
+
+			if (items == NULL || !filter->matchesTerminal(items))
+				continue;
+
+			ReadLocker locker(items);
+
+			bool resuming = j == firstTerminal && !resume.isStart();
+			int firstType = resuming ? items->getTypeListIndex(resume.itemType) : 0;
+
+			for (int t = firstType; t < items->getTypeListCount() && (limit < 0 || displaying < offset + limit); ++t) {
+				int itemType = items->getTypeListType(t);
+
+				if (!filter->matchesType(itemType))
+					continue;
+
+				TerminalTypeList* typeList = items->getTypeList(t);
+
+				int firstItem = (resuming && t == firstType && itemType == resume.itemType) ? typeList->getIndexAfter(resume.itemID) : 0;
+
+				for (int i = firstItem; i < typeList->size() && (limit < 0 || displaying < offset + limit); ++i) {
+					ManagedReference<AuctionItem*> item = typeList->get(i);
+
+					if (item == NULL || !filter->matches(item))
+						continue;
+
+					if (displaying >= offset)
+						results.add(item);
+
+					++displaying;
+
+					if (limit >= 0 && displaying == offset + limit) {
+						cursor.offset = displaying;
+						cursor.terminalID = items->getVendorID();
+						cursor.itemType = itemType;
+						cursor.itemID = item->getObjectID();
+					}
+				}
+			}
+		}
+
+		return displaying;
+	}
+};
+
+#endif /* AUCTIONSEARCH_H_ */
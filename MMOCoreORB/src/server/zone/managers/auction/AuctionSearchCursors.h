@@ -0,0 +1,90 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#ifndef AUCTIONSEARCHCURSORS_H_
+#define AUCTIONSEARCHCURSORS_H_
+
+#include "engine/engine.h"
+
+/**
+ * Where the last full page of a player's auction search stopped, so asking
+ * for the next page continues from there instead of counting every earlier
+ * match again. It keeps the terminal, item type and item object ids rather
+ * than positions, items listed or removed in between don't shift it.
+ */
+class AuctionSearchCursor {
+public:
+	/// Screen, category, vendor and terminals of the search
+	uint64 query;
+
+	/// Matches before the cursor, the offset of the page it continues
+	int offset;
+
+	/// Last item listed, 0 terminalID for a cursor that starts at the first match
+	uint64 terminalID;
+	int itemType;
+	uint64 itemID;
+
+	Time lastUsed;
+
+	AuctionSearchCursor() : query(0), offset(-1), terminalID(0), itemType(0), itemID(0) {
+	}
+
+	inline bool isStart() const {
+		return terminalID == 0;
+	}
+};
+
+/**
+ * Cursors by player object id. Players that walk away from a terminal never
+ * ask for their next page, their cursors are dropped once they go unused
+ * for CURSORTIMEOUT
+ */
+class AuctionSearchCursors : public HashTable<uint64, AuctionSearchCursor>, public Mutex {
+protected:
+	Time lastExpiry;
+
+public:
+	const static int CURSORTIMEOUT = 300000;
+
+	/// Pre locked
+	void putCursor(uint64 playerID, AuctionSearchCursor& cursor) {
+		cursor.lastUsed.updateToCurrentTime();
+
+		put(playerID, cursor);
+
+		if (lastExpiry.miliDifference() > CURSORTIMEOUT) {
+			expireCursors(CURSORTIMEOUT);
+
+			lastExpiry.updateToCurrentTime();
+		}
+	}
+
+	/**
+	 * Pre locked, removes the cursors that went unused for longer than timeout msec
+	 * @return number of cursors removed
+	 */
+	int expireCursors(uint64 timeout) {
+		Vector<uint64> expired;
+
+		HashTableIterator<uint64, AuctionSearchCursor> iterator = this->iterator();
+
+		while (iterator.hasNext()) {
+			uint64 playerID;
+			AuctionSearchCursor cursor;
+
+			iterator.getNextKeyAndValue(playerID, cursor);
+
+			if (cursor.lastUsed.miliDifference() > timeout)
+				expired.add(playerID);
+		}
+
+		for (int i = 0; i < expired.size(); ++i)
+			remove(expired.get(i));
+
+		return expired.size();
+	}
+};
+
+#endif /* AUCTIONSEARCHCURSORS_H_ */
@@ -71,6 +71,8 @@ public:
 				itemList->setNoDuplicateInsertPlan();
 			}
 
+			itemList->setVendorID(vendor->getObjectID());
+
 			targetRegion->put(vendor->getObjectID(), itemList);
 			put(vendor->getObjectID(), itemList);
 		}
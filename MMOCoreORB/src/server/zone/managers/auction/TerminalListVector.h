@@ -9,18 +9,72 @@
 #define TERMINALLISTVECTOR_H_
 
 #include "engine/engine.h"
+#include "server/zone/objects/auction/AuctionItem.h"
+
+/**
+ * Items of one type on a terminal, by object id so a search can resume after the last item it listed
+ */
+class TerminalTypeList : public SortedVector<ManagedReference<AuctionItem*> > {
+public:
+	int compare(const ManagedReference<AuctionItem*>& o1, const ManagedReference<AuctionItem*>& o2) const {
+		uint64 id1 = o1->getObjectID();
+		uint64 id2 = o2->getObjectID();
+
+		if (id1 < id2)
+			return 1;
+		else if (id1 > id2)
+			return -1;
+
+		return 0;
+	}
+
+	/**
+	 * @return index of the first item with an object id above objectID
+	 */
+	int getIndexAfter(uint64 objectID) {
+		int l = 0, r = size();
+
+		while (l < r) {
+			int m = (l + r) / 2;
+
+			if (get(m)->getObjectID() <= objectID)
+				l = m + 1;
+			else
+				r = m;
+		}
+
+		return l;
+	}
+};
 
 class TerminalItemList : public SortedVector<ManagedReference<AuctionItem*> >, public ReadWriteLock {
 protected:
 	bool searchable;
 
+	/// Object id of the terminal or vendor the items are listed on
+	uint64 vendorID;
+
+	/// The same items by item type, category searches only walk the types they match
+	VectorMap<int, Reference<TerminalTypeList*> > typeLists;
+
 public:
 	TerminalItemList() {
 		searchable = false;
+		vendorID = 0;
+
+		typeLists.setNoDuplicateInsertPlan();
+		typeLists.setNullValue(NULL);
 	}
 
 	TerminalItemList(const TerminalItemList& list) : SortedVector<ManagedReference<AuctionItem*> >(list), ReadWriteLock() {
 		searchable = list.searchable;
+		vendorID = list.vendorID;
+
+		typeLists.setNoDuplicateInsertPlan();
+		typeLists.setNullValue(NULL);
+
+		for (int i = 0; i < size(); ++i)
+			addToTypeList(get(i));
 	}
 
 	TerminalItemList& operator=(const TerminalItemList& list) {
@@ -28,6 +82,7 @@ public:
 			return *this;
 
 		searchable = list.searchable;
+		vendorID = list.vendorID;
 
 		return *this;
 	}
@@ -40,18 +95,111 @@ public:
 		return searchable == true;
 	}
 
+	inline void setVendorID(uint64 id) {
+		vendorID = id;
+	}
+
+	inline uint64 getVendorID() {
+		return vendorID;
+	}
+
 	int put(const ManagedReference<AuctionItem*>& o) {
 		Locker locker(this);
 
-		return SortedVector<ManagedReference<AuctionItem*> >::put(o);
+		int result = SortedVector<ManagedReference<AuctionItem*> >::put(o);
+
+		if (result != -1)
+			addToTypeList(o);
+
+		return result;
 	}
 
 	bool drop(const ManagedReference<AuctionItem*>& o) {
 		Locker locker(this);
 
-		return SortedVector<ManagedReference<AuctionItem*> >::drop(o);
+		if (!SortedVector<ManagedReference<AuctionItem*> >::drop(o))
+			return false;
+
+		removeFromTypeList(o);
+
+		return true;
+	}
+
+	/// Read locked
+	inline int getTypeListCount() {
+		return typeLists.size();
 	}
 
+	/// Read locked
+	inline int getTypeListType(int index) {
+		return typeLists.elementAt(index).getKey();
+	}
+
+	/// Read locked
+	inline TerminalTypeList* getTypeList(int index) {
+		return typeLists.elementAt(index).getValue();
+	}
+
+	/// Read locked, index of the type list of itemType or of the one that would follow it
+	int getTypeListIndex(int itemType) {
+		int index = typeLists.lowerBound(VectorMapEntry<int, Reference<TerminalTypeList*> >(itemType));
+
+		return index < 0 ? typeLists.size() : index;
+	}
+
+	/**
+	 * Whether items of itemType show up in a search of category
+	 */
+	static bool isTypeInCategory(int category, int itemType) {
+		if (category & 255) // Searching a sub category
+			return itemType == category;
+
+		if (itemType & category)
+			return true;
+
+		if ((category == 8192) && (itemType < 256))
+			return true;
+
+		return category == 0; // Searching all items
+	}
+
+protected:
+	/// Pre Locked
+	void addToTypeList(const ManagedReference<AuctionItem*>& item) {
+		if (item == NULL)
+			return;
+
+		int itemType = item->getItemType();
+
+		Reference<TerminalTypeList*> typeList = typeLists.get(itemType);
+
+		if (typeList == NULL) {
+			typeList = new TerminalTypeList();
+			typeList->setNoDuplicateInsertPlan();
+
+			typeLists.put(itemType, typeList);
+		}
+
+		typeList->put(item);
+	}
+
+	/// Pre Locked
+	void removeFromTypeList(const ManagedReference<AuctionItem*>& item) {
+		if (item == NULL)
+			return;
+
+		int index = typeLists.find(item->getItemType());
+
+		if (index == -1)
+			return;
+
+		Reference<TerminalTypeList*> typeList = typeLists.elementAt(index).getValue();
+
+		typeList->drop(item);
+
+		if (typeList->isEmpty())
+			typeLists.remove(index);
+	}
 };
 
 class TerminalRegionList : public VectorMap<uint64, Reference<TerminalItemList*> >, public ReadWriteLock {
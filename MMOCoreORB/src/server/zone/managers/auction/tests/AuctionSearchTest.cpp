@@ -0,0 +1,252 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#include "gtest/gtest.h"
+
+#include "server/zone/managers/auction/AuctionSearch.h"
+
+static const int ITEMTYPES[] = { 1, 2, 3, 257, 258, 262, 8193, 8194, 8199, 8211, 16385, 16386, 131073, 262145, 262147 };
+
+static const int CATEGORIES[] = { 0, 256, 8192, 8193, 16384, 262144, 262147 };
+
+class ForSaleFilter : public AuctionSearchFilter {
+	int category;
+
+public:
+	ForSaleFilter(int category) : category(category) {
+	}
+
+	bool matchesType(int itemType) {
+		return TerminalItemList::isTypeInCategory(category, itemType);
+	}
+
+	bool matches(AuctionItem* item) {
+		EXPECT_TRUE(TerminalItemList::isTypeInCategory(category, item->getItemType()));
+
+		return item->getStatus() == AuctionItem::FORSALE;
+	}
+};
+
+class AuctionSearchTest : public ::testing::Test {
+public:
+	const static int TERMINALS = 50;
+	const static int ITEMSPERTERMINAL = 4000;
+
+	TerminalListVector terminals;
+
+	uint64 nextObjectID;
+
+	AuctionSearchTest() : nextObjectID(1) {
+	}
+
+	ManagedReference<AuctionItem*> addItem(TerminalItemList* items, int itemType) {
+		ManagedReference<AuctionItem*> item = new AuctionItem();
+		item->_setObjectID(nextObjectID++);
+		item->setItemType(itemType);
+		item->setStatus(System::random(3) == 0 ? AuctionItem::SOLD : AuctionItem::FORSALE);
+
+		items->put(item);
+
+		return item;
+	}
+
+	TerminalItemList* getTerminal(uint64 vendorID) {
+		for (int j = 0; j < terminals.size(); ++j) {
+			if (terminals.get(j)->getVendorID() == vendorID)
+				return terminals.get(j);
+		}
+
+		return NULL;
+	}
+
+	void populate(int terminalCount, int itemCount) {
+		int typeCount = sizeof(ITEMTYPES) / sizeof(int);
+
+		for (int i = 0; i < terminalCount; ++i) {
+			Reference<TerminalItemList*> items = new TerminalItemList();
+			items->setNoDuplicateInsertPlan();
+			items->setVendorID(1000000000 + terminals.size());
+
+			for (int j = 0; j < itemCount; ++j)
+				addItem(items, ITEMTYPES[System::random(typeCount - 1)]);
+
+			terminals.put(items);
+		}
+	}
+
+	// what a search did before the type lists
+	int countByScan(int category) {
+		int count = 0;
+
+		for (int j = 0; j < terminals.size(); ++j) {
+			TerminalItemList* items = terminals.get(j);
+
+			ReadLocker locker(items);
+
+			for (int i = 0; i < items->size(); ++i) {
+				AuctionItem* item = items->get(i);
+
+				if (TerminalItemList::isTypeInCategory(category, item->getItemType()) && item->getStatus() == AuctionItem::FORSALE)
+					++count;
+			}
+		}
+
+		return count;
+	}
+
+	int countBySearch(int category) {
+		ForSaleFilter filter(category);
+		AuctionSearchCursor cursor;
+		Vector<ManagedReference<AuctionItem*> > results;
+
+		int count = AuctionSearch::search(&terminals, &filter, 0, -1, cursor, results);
+
+		EXPECT_EQ(count, results.size());
+		EXPECT_TRUE(cursor.isStart());
+
+		return count;
+	}
+};
+
+TEST_F(AuctionSearchTest, TypeListsFollowPutAndDrop) {
+	populate(1, 500);
+
+	TerminalItemList* items = terminals.get(0);
+
+	int total = 0;
+
+	for (int t = 0; t < items->getTypeListCount(); ++t)
+		total += items->getTypeList(t)->size();
+
+	EXPECT_EQ(items->size(), total);
+
+	while (items->size() > 0) {
+		ManagedReference<AuctionItem*> item = items->get(System::random(items->size() - 1));
+
+		ASSERT_TRUE(items->drop(item));
+		ASSERT_FALSE(items->drop(item));
+	}
+
+	EXPECT_EQ(0, items->getTypeListCount());
+}
+
+TEST_F(AuctionSearchTest, CategorySearchMatchesFullScan) {
+	populate(TERMINALS, ITEMSPERTERMINAL);
+
+	for (int category : CATEGORIES) {
+		Time start;
+
+		int scanned = countByScan(category);
+
+		uint64 scanTime = start.miliDifference();
+
+		start.updateToCurrentTime();
+
+		int indexed = countBySearch(category);
+
+		uint64 indexTime = start.miliDifference();
+
+		EXPECT_EQ(scanned, indexed) << "category " << category;
+
+		RecordProperty(("scan_ms_" + String::valueOf(category)).toCharArray(), (int) scanTime);
+		RecordProperty(("index_ms_" + String::valueOf(category)).toCharArray(), (int) indexTime);
+	}
+}
+
+TEST_F(AuctionSearchTest, PagesListEveryItemOnceWhileTypesComeAndGo) {
+	populate(3, 300);
+
+	uint64 firstNewObjectID = nextObjectID;
+
+	ForSaleFilter filter(0);
+	AuctionSearchCursor cursor;
+	VectorMap<uint64, int> listed;
+
+	for (int offset = 0, page = 0; ; offset += 100, ++page) {
+		Vector<ManagedReference<AuctionItem*> > results;
+
+		int displaying = AuctionSearch::search(&terminals, &filter, offset, 100, cursor, results);
+
+		for (int i = 0; i < results.size(); ++i) {
+			uint64 objectID = results.get(i)->getObjectID();
+
+			EXPECT_FALSE(listed.contains(objectID)) << "item " << objectID << " listed twice";
+
+			listed.put(objectID, page);
+		}
+
+		if (displaying != offset + 100) {
+			EXPECT_TRUE(cursor.isStart());
+			break;
+		}
+
+		ASSERT_FALSE(cursor.isStart());
+		ASSERT_EQ(offset + 100, cursor.offset);
+
+		TerminalItemList* items = getTerminal(cursor.terminalID);
+		ASSERT_TRUE(items != NULL);
+
+		if (page == 0) {
+			// the type the page stopped in goes away
+			for (int i = items->size() - 1; i >= 0; --i) {
+				ManagedReference<AuctionItem*> item = items->get(i);
+
+				if (item->getItemType() == cursor.itemType)
+					items->drop(item);
+			}
+
+			int index = items->getTypeListIndex(cursor.itemType);
+
+			EXPECT_TRUE(index == items->getTypeListCount() || items->getTypeListType(index) > cursor.itemType);
+		} else if (page == 1) {
+			// new types before and after the one the page stopped in, on every terminal
+			for (int j = 0; j < terminals.size(); ++j) {
+				for (int i = 0; i < 20; ++i) {
+					addItem(terminals.get(j), 0);
+					addItem(terminals.get(j), 1048576);
+				}
+			}
+		} else if (page == 2) {
+			// items on both sides of the last one listed go away
+			ManagedReference<AuctionItem*> first = items->get(0);
+			ManagedReference<AuctionItem*> last = items->get(items->size() - 1);
+
+			items->drop(first);
+			items->drop(last);
+		}
+	}
+
+	for (int j = 0; j < terminals.size(); ++j) {
+		TerminalItemList* items = terminals.get(j);
+
+		for (int i = 0; i < items->size(); ++i) {
+			AuctionItem* item = items->get(i);
+
+			if (item->getStatus() == AuctionItem::FORSALE && item->getObjectID() < firstNewObjectID)
+				EXPECT_TRUE(listed.contains(item->getObjectID())) << "item " << item->getObjectID() << " never listed";
+		}
+	}
+}
+
+TEST_F(AuctionSearchTest, UnusedCursorsExpire) {
+	AuctionSearchCursors cursors;
+
+	Locker locker(&cursors);
+
+	AuctionSearchCursor cursor;
+	cursor.terminalID = 1;
+
+	cursors.putCursor(1, cursor);
+	cursors.putCursor(2, cursor);
+
+	EXPECT_EQ(0, cursors.expireCursors(60000));
+
+	Thread::sleep(20);
+
+	cursors.putCursor(2, cursor);
+
+	EXPECT_EQ(1, cursors.expireCursors(10));
+	EXPECT_FALSE(cursors.containsKey(1));
+	EXPECT_TRUE(cursors.containsKey(2));
+}
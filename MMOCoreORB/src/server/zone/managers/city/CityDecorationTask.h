@@ -146,7 +146,7 @@ public:
 		if (zone == NULL)
 			return;
 
-		ManagedReference<SceneObject*> inv = mayor->getSlottedObject("inventory");
+		ManagedReference<SceneObject*> inv = mayor->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 		if(inv == NULL)
 			return;
@@ -751,7 +751,7 @@ void CityManagerImplementation::processCityUpdate(CityRegion* city) {
 		ManagedReference<SceneObject*> mayor = zoneServer->getObject(city->getMayorID());
 
 		if (mayor != NULL && mayor->isPlayerCreature()) {
-			Reference<PlayerObject*> ghost = mayor->getSlottedObject("ghost").castTo<PlayerObject*> ();
+			Reference<PlayerObject*> ghost = mayor->getKnownSlottedObject(SlotIndex::GHOST).castTo<PlayerObject*> ();
 
 			if (ghost != NULL) {
 				ghost->addExperience("political", 750, true);
@@ -1145,7 +1145,7 @@ void CityManagerImplementation::updateCityVoting(CityRegion* city, bool override
 				continue;
 			}
 
-			Reference<PlayerObject*> ghost = mayorObject->getSlottedObject("ghost").castTo<PlayerObject*>();
+			Reference<PlayerObject*> ghost = mayorObject->getKnownSlottedObject(SlotIndex::GHOST).castTo<PlayerObject*>();
 
 			if (ghost != NULL) {
 				ghost->addExperience("political", votes * 300, true);
@@ -18,6 +18,7 @@
 #include "terrain/manager/TerrainManager.h"
 #include "server/zone/managers/planet/PlanetManager.h"
 #include "server/zone/managers/collision/PathFinderManager.h"
+#include "server/zone/managers/collision/StaticCollisionTree.h"
 #include "server/zone/objects/ship/ShipObject.h"
 #include "server/zone/objects/area/ActiveArea.h"
 
@@ -85,8 +86,8 @@ const AppearanceTemplate* CollisionManager::getCollisionAppearance(SceneObject*
 bool CollisionManager::checkSphereCollision(const Vector3& origin, float radius, Zone* zone) {
 	Vector3 sphereOrigin(origin.getX(), origin.getZ(), origin.getY());
 
-	SortedVector<ManagedReference<QuadTreeEntry*> > objects(512, 512);
-	zone->getInRangeObjects(origin.getX(), origin.getY(), 512, &objects, true);
+	Vector<Reference<SceneObject*> > objects;
+	zone->getCollisionTree()->getSphereCandidates(sphereOrigin, radius, objects);
 
 	for (int i = 0; i < objects.size(); ++i) {
 
@@ -266,8 +267,8 @@ Vector<float>* CollisionManager::getCellFloorCollision(float x, float y, CellObj
 }
 
 float CollisionManager::getWorldFloorCollision(float x, float y, Zone* zone, bool testWater) {
-	SortedVector<ManagedReference<QuadTreeEntry*> > closeObjects;
-	zone->getInRangeObjects(x, y, 128, &closeObjects, true);
+	Vector<Reference<SceneObject*> > closeObjects;
+	zone->getCollisionTree()->getColumnCandidates(x, y, closeObjects);
 
 	PlanetManager* planetManager = zone->getPlanetManager();
 
@@ -337,21 +338,24 @@ float CollisionManager::getWorldFloorCollision(float x, float y, Zone* zone, boo
 	return height;
 }
 
-void CollisionManager::getWorldFloorCollisions(float x, float y, Zone* zone, SortedVector<IntersectionResult>* result, CloseObjectsVector* closeObjectsVector) {
-	if (closeObjectsVector != NULL) {
-		Vector<QuadTreeEntry*> closeObjects(closeObjectsVector->size(), 10);
-		closeObjectsVector->safeCopyTo(closeObjects);
+void CollisionManager::getWorldFloorCollisions(float x, float y, Zone* zone, SortedVector<IntersectionResult>* result) {
+	// the zone collision tree already knows which objects are above x, y
+	Vector<Reference<SceneObject*> > objects;
+	zone->getCollisionTree()->getColumnCandidates(x, y, objects);
 
-		getWorldFloorCollisions(x, y, zone, result, closeObjects);
-	} else {
-#ifdef COV_DEBUG
-		zone->info("Null closeobjects vector in CollisionManager::getWorldFloorCollisions", true);
-#endif
-		SortedVector<ManagedReference<QuadTreeEntry*> > closeObjects;
+	Vector3 rayStart(x, 16384.f, y);
+	Vector3 rayEnd(x, -16384.f, y);
 
-		zone->getInRangeObjects(x, y, 128, &closeObjects, true);
+	for (int i = 0; i < objects.size(); ++i) {
+		SceneObject* sceno = objects.get(i);
+
+		const AppearanceTemplate* app = getCollisionAppearance(sceno, 255);
 
-		getWorldFloorCollisions(x, y, zone, result, closeObjects);
+		if (app != NULL) {
+			Ray ray = convertToModelSpace(rayStart, rayEnd, sceno);
+
+			app->intersects(ray, 16384 * 2, *result);
+		}
 	}
 }
 
@@ -421,25 +425,6 @@ bool CollisionManager::checkLineOfSight(SceneObject* object1, SceneObject* objec
 	float heightOrigin = 1.f;
 	float heightEnd = 1.f;
 
-	Reference<SortedVector<QuadTreeEntry*>* > closeObjectsNonReference = NULL;/* new SortedVector<QuadTreeEntry* >();*/
-	Reference<SortedVector<ManagedReference<QuadTreeEntry*> >*> closeObjects = NULL;/*new SortedVector<ManagedReference<QuadTreeEntry*> >();*/
-
-	int maxInRangeObjectCount = 0;
-
-	if (object1->getCloseObjects() == NULL) {
-#ifdef COV_DEBUG
-		object1->info("Null closeobjects vector in CollisionManager::checkLineOfSight for " + object1->getDisplayedName(), true);
-#endif
-
-		closeObjects = new SortedVector<ManagedReference<QuadTreeEntry*> >();
-		zone->getInRangeObjects(object1->getPositionX(), object1->getPositionY(), 512, closeObjects, true);
-	} else {
-		closeObjectsNonReference = new SortedVector<QuadTreeEntry* >();
-
-		CloseObjectsVector* vec = (CloseObjectsVector*) object1->getCloseObjects();
-		vec->safeCopyTo(*closeObjectsNonReference.get());
-	}
-
 	if (object1->isCreatureObject())
 		heightOrigin = getRayOriginPoint(object1->asCreatureObject());
 
@@ -455,17 +440,19 @@ bool CollisionManager::checkLineOfSight(SceneObject* object1, SceneObject* objec
 	float intersectionDistance;
 	Triangle* triangle = NULL;
 
+	// the collision tree and the model transforms both take (x, height, y)
+	Vector3 treeOrigin = StaticCollisionTree::getTreePosition(rayOrigin);
+	Vector3 treeEnd = StaticCollisionTree::getTreePosition(rayEnd);
+
+	// only the objects whose bounds the ray crosses
+	Vector<Reference<SceneObject*> > objects;
+	zone->getCollisionTree()->getSegmentCandidates(treeOrigin, treeEnd, objects);
+
 	try {
-		for (int i = 0; i < (closeObjects != NULL ? closeObjects->size() : closeObjectsNonReference->size()); ++i) {
+		for (int i = 0; i < objects.size(); ++i) {
 			const AppearanceTemplate* app = NULL;
 
-			SceneObject* scno;
-
-			if (closeObjects != NULL) {
-				scno = static_cast<SceneObject*>(closeObjects->get(i).get());
-			} else {
-				scno = static_cast<SceneObject*>(closeObjectsNonReference->get(i));
-			}
+			SceneObject* scno = objects.get(i);
 
 			try {
 				app = getCollisionAppearance(scno, 255);
@@ -479,7 +466,7 @@ bool CollisionManager::checkLineOfSight(SceneObject* object1, SceneObject* objec
 
 			if (app != NULL) {
 				//moving ray to model space
-				Ray ray = convertToModelSpace(rayOrigin, rayEnd, scno);
+				Ray ray = convertToModelSpace(treeOrigin, treeEnd, scno);
 
 				//structure->info("checking ray with building dir" + String::valueOf(structure->getDirectionAngle()), true);
 
@@ -508,7 +495,7 @@ bool CollisionManager::checkLineOfSight(SceneObject* object1, SceneObject* objec
 		}
 
 		if (cell != NULL) {
-			return checkLineOfSightWorldToCell(rayOrigin, rayEnd, dist, cell);
+			return checkLineOfSightWorldToCell(treeOrigin, treeEnd, dist, cell);
 		}
 	}
 
@@ -516,6 +503,179 @@ bool CollisionManager::checkLineOfSight(SceneObject* object1, SceneObject* objec
 }
 
 
+int CollisionManager::checkLineOfSight(const Vector<SceneObject*>& objects, SceneObject* target, Vector<bool>& visible) {
+	visible.removeAll(objects.size(), 1);
+
+	for (int i = 0; i < objects.size(); ++i)
+		visible.add(false);
+
+	Zone* zone = target->getZone();
+
+	if (zone == NULL)
+		return 0;
+
+	bool targetInBuilding = target->getRootParent() != NULL;
+
+	Vector3 rayEnd = target->getWorldPosition();
+	rayEnd.setZ(rayEnd.getZ() + (target->isCreatureObject() ? getRayOriginPoint(target->asCreatureObject()) : 1.f));
+
+	// the collision tree and the model transforms both take (x, height, y)
+	rayEnd = StaticCollisionTree::getTreePosition(rayEnd);
+
+	// world to world rays, anything involving a building goes through the single ray path
+	Vector<int> rays(objects.size(), 1);
+	Vector<Vector3> rayOrigins(objects.size(), 1);
+
+	int visibleCount = 0;
+
+	for (int i = 0; i < objects.size(); ++i) {
+		SceneObject* object = objects.get(i);
+
+		if (object->getZone() != zone)
+			continue;
+
+		if (targetInBuilding || object->getRootParent() != NULL) {
+			if (checkLineOfSight(object, target)) {
+				visible.set(i, true);
+				++visibleCount;
+			}
+
+			continue;
+		}
+
+		Vector3 rayOrigin = object->getWorldPosition();
+		rayOrigin.setZ(rayOrigin.getZ() + (object->isCreatureObject() ? getRayOriginPoint(object->asCreatureObject()) : 1.f));
+
+		rays.add(i);
+		rayOrigins.add(StaticCollisionTree::getTreePosition(rayOrigin));
+	}
+
+	int rayCount = rays.size();
+
+	if (rayCount == 0)
+		return visibleCount;
+
+	Vector<Reference<SceneObject*> > obstacles;
+	zone->getCollisionTree()->getSegmentsCandidates(rayOrigins, rayEnd, obstacles);
+
+	// structure of arrays so the slab test below runs over all rays in one vectorizable loop
+	Vector<float> rayData(rayCount * 7, 1);
+	Vector<float> rayDistance(rayCount, 1);
+	Vector<int> blocked(rayCount, 1);
+
+	for (int i = 0; i < rayCount * 7; ++i)
+		rayData.add(0.f);
+
+	for (int i = 0; i < rayCount; ++i) {
+		rayDistance.add(rayEnd.distanceTo(rayOrigins.get(i)));
+		blocked.add(0);
+	}
+
+	float* originX = &rayData.get(0);
+	float* originY = originX + rayCount;
+	float* originZ = originY + rayCount;
+	float* directionX = originZ + rayCount;
+	float* directionY = directionX + rayCount;
+	float* directionZ = directionY + rayCount;
+	float* boxHit = directionZ + rayCount;
+
+	float intersectionDistance;
+	Triangle* triangle = NULL;
+
+	for (int j = 0; j < obstacles.size(); ++j) {
+		SceneObject* scno = obstacles.get(j);
+
+		const AppearanceTemplate* app = NULL;
+
+		try {
+			app = getCollisionAppearance(scno, 255);
+		} catch (Exception& e) {
+			app = NULL;
+		}
+
+		if (app == NULL)
+			continue;
+
+		Matrix4 modelMatrix = getTransformMatrix(scno);
+		Vector3 modelEnd = rayEnd * modelMatrix;
+
+		for (int i = 0; i < rayCount; ++i) {
+			Vector3 modelOrigin = rayOrigins.get(i) * modelMatrix;
+
+			originX[i] = modelOrigin.getX();
+			originY[i] = modelOrigin.getY();
+			originZ[i] = modelOrigin.getZ();
+			directionX[i] = modelEnd.getX() - originX[i];
+			directionY[i] = modelEnd.getY() - originY[i];
+			directionZ[i] = modelEnd.getZ() - originZ[i];
+		}
+
+		const BaseBoundingVolume* volume = app->getBoundingVolume();
+
+		if (volume != NULL)
+			intersectSegmentsWithBox(volume->getBoundingBox(), rayCount, originX, originY, originZ, directionX, directionY, directionZ, boxHit);
+		else
+			for (int i = 0; i < rayCount; ++i)
+				boxHit[i] = 1.f;
+
+		for (int i = 0; i < rayCount; ++i) {
+			if (blocked.get(i) || boxHit[i] == 0.f)
+				continue;
+
+			Vector3 direction(directionX[i], directionY[i], directionZ[i]);
+			direction.normalize();
+
+			Ray ray(Vector3(originX[i], originY[i], originZ[i]), direction);
+
+			try {
+				if (app->intersects(ray, rayDistance.get(i), intersectionDistance, triangle, true))
+					blocked.set(i, 1);
+			} catch (Exception& e) {
+				Logger::console.error("unreported exception caught in CollisionManager::checkLineOfSight(const Vector<SceneObject*>&, SceneObject*, Vector<bool>&)");
+				Logger::console.error(e.getMessage());
+			}
+		}
+	}
+
+	for (int i = 0; i < rayCount; ++i) {
+		if (!blocked.get(i)) {
+			visible.set(rays.get(i), true);
+			++visibleCount;
+		}
+	}
+
+	return visibleCount;
+}
+
+void CollisionManager::intersectSegmentsWithBox(const AABB& box, int count, const float* originX, const float* originY, const float* originZ,
+		const float* directionX, const float* directionY, const float* directionZ, float* hit) {
+	// appearance meshes may stick out of their bounding volume by a little
+	const float padding = 1.f;
+
+	const Vector3* boxMin = box.getMinBound();
+	const Vector3* boxMax = box.getMaxBound();
+
+	const float minX = boxMin->getX() - padding, minY = boxMin->getY() - padding, minZ = boxMin->getZ() - padding;
+	const float maxX = boxMax->getX() + padding, maxY = boxMax->getY() + padding, maxZ = boxMax->getZ() + padding;
+
+	// branch free so the compiler can vectorize it, axis parallel segments get a tiny direction
+	// instead of an infinite inverse
+	for (int i = 0; i < count; ++i) {
+		float inverseX = 1.f / (fabs(directionX[i]) < 1e-6f ? 1e-6f : directionX[i]);
+		float inverseY = 1.f / (fabs(directionY[i]) < 1e-6f ? 1e-6f : directionY[i]);
+		float inverseZ = 1.f / (fabs(directionZ[i]) < 1e-6f ? 1e-6f : directionZ[i]);
+
+		float x1 = (minX - originX[i]) * inverseX, x2 = (maxX - originX[i]) * inverseX;
+		float y1 = (minY - originY[i]) * inverseY, y2 = (maxY - originY[i]) * inverseY;
+		float z1 = (minZ - originZ[i]) * inverseZ, z2 = (maxZ - originZ[i]) * inverseZ;
+
+		float tmin = MAX(MAX(0.f, MIN(x1, x2)), MAX(MIN(y1, y2), MIN(z1, z2)));
+		float tmax = MIN(MIN(1.f, MAX(x1, x2)), MIN(MAX(y1, y2), MAX(z1, z2)));
+
+		hit[i] = tmin <= tmax ? 1.f : 0.f;
+	}
+}
+
 TriangleNode* CollisionManager::getTriangle(const Vector3& point, FloorMesh* floor) {
 	/*PathGraph* graph = node->getPathGraph();
 	FloorMesh* floor = graph->getFloorMesh();*/
@@ -547,53 +707,55 @@ TriangleNode* CollisionManager::getTriangle(const Vector3& point, FloorMesh* flo
 }
 
 Vector3 CollisionManager::convertToModelSpace(const Vector3& point, SceneObject* model) {
-	Reference<Matrix4*> modelMatrix = getTransformMatrix(model);
+	Matrix4 modelMatrix = getTransformMatrix(model);
 
-	Vector3 transformedPoint = point * *modelMatrix;
+	Vector3 transformedPoint = point * modelMatrix;
 
 	return transformedPoint;
 }
 
-Reference<Matrix4*> CollisionManager::getTransformMatrix(SceneObject* model) {
-	//this can be optimized by storing the matrix on the model and update it when needed
-	//Reference
+Matrix4 CollisionManager::getTransformMatrix(SceneObject* model) {
+	Quaternion* direction = model->getDirection();
 
-	Reference<Matrix4*> modelMatrix = model->getTransformForCollisionMatrix();
+	float key[CollisionTransform::KEYSIZE] = { model->getPositionX(), model->getPositionZ(), model->getPositionY(),
+			direction->getW(), direction->getX(), direction->getY(), direction->getZ() };
 
-	if (modelMatrix == NULL) {
-		//modelMatrix = new Matrix4();
+	CollisionTransform* transform = model->getCollisionTransform();
 
-		Matrix4 translationMatrix;
-		translationMatrix.setTranslation(-model->getPositionX(), -model->getPositionZ(), -model->getPositionY());
+	Matrix4 modelMatrix;
 
-		float rad = -model->getDirection()->getRadians();
-		float cosRad = cos(rad);
-		float sinRad = sin(rad);
+	if (transform->read(key, modelMatrix))
+		return modelMatrix;
 
-		Matrix3 rot;
-		rot[0][0] = cosRad;
-		rot[0][2] = -sinRad;
-		rot[1][1] = 1;
-		rot[2][0] = sinRad;
-		rot[2][2] = cosRad;
+	Matrix4 translationMatrix;
+	translationMatrix.setTranslation(-key[0], -key[1], -key[2]);
 
-		Matrix4 rotateMatrix;
-		rotateMatrix.setRotationMatrix(rot);
+	float rad = -direction->getRadians();
+	float cosRad = cos(rad);
+	float sinRad = sin(rad);
 
-		//Matrix4 modelMatrix;
-		modelMatrix = new Matrix4(translationMatrix * rotateMatrix);
+	Matrix3 rot;
+	rot[0][0] = cosRad;
+	rot[0][2] = -sinRad;
+	rot[1][1] = 1;
+	rot[2][0] = sinRad;
+	rot[2][2] = cosRad;
 
-		model->setTransformForCollisionMatrixIfNull(modelMatrix);
-	}
+	Matrix4 rotateMatrix;
+	rotateMatrix.setRotationMatrix(rot);
+
+	modelMatrix = translationMatrix * rotateMatrix;
+
+	transform->write(key, modelMatrix);
 
 	return modelMatrix;
 }
 
 Ray CollisionManager::convertToModelSpace(const Vector3& rayOrigin, const Vector3& rayEnd, SceneObject* model) {
-	Reference<Matrix4*> modelMatrix = getTransformMatrix(model);
+	Matrix4 modelMatrix = getTransformMatrix(model);
 
-	Vector3 transformedOrigin = rayOrigin * *modelMatrix;
-	Vector3 transformedEnd = rayEnd * *modelMatrix;
+	Vector3 transformedOrigin = rayOrigin * modelMatrix;
+	Vector3 transformedEnd = rayEnd * modelMatrix;
 
 	Vector3 norm = transformedEnd - transformedOrigin;
 	norm.normalize();
@@ -638,13 +800,16 @@ bool CollisionManager::checkShipCollision(ShipObject* ship, const Vector3& targe
 	float intersectionDistance;
 	Triangle* triangle = NULL;
 
-	SortedVector<ManagedReference<QuadTreeEntry*> > objects(512, 512);
-	zone->getInRangeObjects(targetPosition.getX(), targetPosition.getY(), 512, &objects, true);
+	Vector3 treeOrigin = StaticCollisionTree::getTreePosition(rayOrigin);
+	Vector3 treeEnd = StaticCollisionTree::getTreePosition(rayEnd);
+
+	Vector<Reference<SceneObject*> > objects;
+	zone->getCollisionTree()->getSegmentCandidates(treeOrigin, treeEnd, objects);
 
 	for (int i = 0; i < objects.size(); ++i) {
 		const AppearanceTemplate *app = NULL;
 
-		SceneObject* scno = static_cast<SceneObject*>(objects.get(i).get());
+		SceneObject* scno = objects.get(i);
 
 		try {
 			app = getCollisionAppearance(scno, -1);
@@ -662,7 +827,7 @@ bool CollisionManager::checkShipCollision(ShipObject* ship, const Vector3& targe
 			//moving ray to model space
 
 			try {
-				Ray ray = convertToModelSpace(rayOrigin, rayEnd, scno);
+				Ray ray = convertToModelSpace(treeOrigin, treeEnd, scno);
 
 				//structure->info("checking ray with building dir" + String::valueOf(structure->getDirectionAngle()), true);
 
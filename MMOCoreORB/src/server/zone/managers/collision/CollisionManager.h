@@ -49,7 +49,10 @@ public:
 	static Ray convertToModelSpace(const Vector3& rayOrigin, const Vector3& rayEnd, SceneObject* model);
 	static Vector3 convertToModelSpace(const Vector3& point, SceneObject* model);
 	static TriangleNode* getTriangle(const Vector3& point, FloorMesh* floor);
-	static Reference<Matrix4*> getTransformMatrix(SceneObject* model);
+	/**
+	 * @return world to model space matrix of model, cached on model until it moves or turns
+	 */
+	static Matrix4 getTransformMatrix(SceneObject* model);
 	/**
 	 * @returns nearest available path node int the floor path graph with the lowest distance from triangle to final target
 	 */
@@ -57,12 +60,27 @@ public:
 
 	static bool checkLineOfSightInBuilding(SceneObject* object1, SceneObject* object2, SceneObject* building);
 	static bool checkLineOfSight(SceneObject* object1, SceneObject* object2);
+
+	/**
+	 * Casts the rays checkLineOfSight(objects[i], target) would for every object, gathering the obstacles
+	 * and transforming into each obstacle's model space once for all of them
+	 * @post { visible[i] is true if objects[i] has line of sight to target }
+	 * @return number of objects with line of sight
+	 */
+	static int checkLineOfSight(const Vector<SceneObject*>& objects, SceneObject* target, Vector<bool>& visible);
+	/**
+	 * @param rayOrigin world position in tree space (x, height, y), see StaticCollisionTree::getTreePosition
+	 * @param rayEnd world position in tree space (x, height, y)
+	 */
 	static bool checkLineOfSightWorldToCell(const Vector3& rayOrigin, const Vector3& rayEnd, float distance, CellObject* cell);
 	static bool checkMovementCollision(CreatureObject* creature, float x, float z, float y, Zone* zone);
 	static float getRayOriginPoint(CreatureObject* creature);
 
 	static float getWorldFloorCollision(float x, float y, Zone* zone, bool testWater);
-	static void getWorldFloorCollisions(float x, float y, Zone* zone, SortedVector<IntersectionResult>* result, CloseObjectsVector* closeObjectsVector = NULL);
+	/**
+	 * Collects the floor intersections of every object above x, y using the zone collision tree
+	 */
+	static void getWorldFloorCollisions(float x, float y, Zone* zone, SortedVector<IntersectionResult>* result);
 
 	static void getWorldFloorCollisions(float x, float y, Zone* zone, SortedVector<IntersectionResult>* result, const SortedVector<ManagedReference<QuadTreeEntry*> >& inRangeObjects);
 	static void getWorldFloorCollisions(float x, float y, Zone* zone, SortedVector<IntersectionResult>* result, const Vector<QuadTreeEntry* >& inRangeObjects);
@@ -77,6 +95,14 @@ public:
 
 	static bool checkLineOfSightInParentCell(SceneObject* object, Vector3& endPoint);
 
+protected:
+	/**
+	 * Slab tests count segments origin + t * direction, t in [0, 1], against box at once
+	 * @post { hit[i] is 1 if segment i overlaps box, 0 otherwise }
+	 */
+	static void intersectSegmentsWithBox(const AABB& box, int count, const float* originX, const float* originY, const float* originZ,
+			const float* directionX, const float* directionY, const float* directionZ, float* hit);
+
 };
 
 #endif /* COLLISIONMANAGER_H_ */
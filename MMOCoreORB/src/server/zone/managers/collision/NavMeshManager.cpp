@@ -11,69 +11,66 @@ const String NavMeshManager::TileQueue = "NavMeshWorker";
 // Higher thread count, used for building large static cities during initialization
 const String NavMeshManager::MeshQueue = "NavMeshBuilder";
 
+// Tiles of the jobs running in the other two queues
+const String NavMeshManager::TileBuildQueue = "NavMeshTileBuilder";
+
 NavMeshManager::NavMeshManager() {
-    maxConcurrentJobs = 4;
+    maxConcurrentJobs = MAX(ConfigManager::instance()->getMaxNavMeshJobs(), 1);
     Core::getTaskManager()->initializeCustomQueue(TileQueue.toCharArray(), maxConcurrentJobs);
     Core::getTaskManager()->initializeCustomQueue(MeshQueue.toCharArray(), maxConcurrentJobs*2);
+    Core::getTaskManager()->initializeCustomQueue(TileBuildQueue.toCharArray(), maxConcurrentJobs);
 }
 
 void NavMeshManager::enqueueJob(Zone* zone, NavMeshRegion* region, AABB areaToBuild, const RecastSettings& recastConfig, const String& queue) {
     Locker locker(&jobQueueMutex);
 
     const String& name = region->getMeshName();
-    Reference<NavMeshJob*> job = runningJobs.get(name);
-    if (job) {
+    Reference<NavMeshJob*> job = jobs.get(name);
+
+    if (job != NULL) {
+        // picked up as soon as the build in progress finishes
         job->addArea(areaToBuild);
-        info("Adding area to running job " + name);
+        info("Adding area to existing job " + name);
         return;
     }
 
-    job = jobs.get(name);
-    if (job == NULL) {
-        job = new NavMeshJob(region, zone, recastConfig, queue);
-        info("Creating new job for " + name);
-    } else {
-        info("Adding area to existing job " + name);
-    }
+    job = new NavMeshJob(region, zone, recastConfig, queue);
+    info("Creating new job for " + name);
 
     job->addArea(areaToBuild);
     jobs.put(name, job);
 
-    Core::getTaskManager()->scheduleTask([=]{
-        checkJobs();
-    }, "checkJobs", 750, TileQueue.toCharArray());
-
+    executeJob(job);
 }
 
-void NavMeshManager::checkJobs() {
-
-    Locker locker(&jobQueueMutex);
+void NavMeshManager::executeJob(Reference<NavMeshJob*> job) {
+    const String& name = job->getRegion()->getMeshName();
 
-    while (jobs.size() > 0) {
+    Core::getTaskManager()->executeTask([=]{
+        info("Starting job task for: " + name, true);
+        startJob(job);
+    }, "updateNavMesh", MeshQueue.toCharArray());
+}
 
-        info("Popping job - CurrentSize: " + String::valueOf(jobs.size()), true);
-        Reference<NavMeshJob*> job = jobs.get(0);
-        const String& name = job->getRegion()->getMeshName();
-        jobs.drop(name);
-        if(runningJobs.contains(name)) {
-            jobs.put(name, job); // push it to the back;
-            return;
-        }
-        runningJobs.put(name, job);
+bool NavMeshManager::finishJob(Reference<NavMeshJob*> job) {
+    Locker locker(&jobQueueMutex);
 
-        Core::getTaskManager()->executeTask([=]{
-            info("Starting job task for: " + name, true);
-            startJob(job);
+    const String& name = job->getRegion()->getMeshName();
 
+    Locker areaLocker(job->getMutex());
+    bool dirty = job->getAreas().size() > 0;
+    areaLocker.release();
 
-            Locker locker(&jobQueueMutex);
-            runningJobs.drop(name);
-        }, "updateNavMesh", MeshQueue.toCharArray());
+    if (dirty && job->getZone() != NULL) {
+        // everything that changed while this build ran goes into one rebuild
+        info("Restarting job for " + name);
+        return true;
     }
 
-    locker.release();
-}
+    jobs.drop(name);
 
+    return false;
+}
 
 void NavMeshManager::startJob(Reference<NavMeshJob*> job) {
 
@@ -81,109 +78,102 @@ void NavMeshManager::startJob(Reference<NavMeshJob*> job) {
         return;
     }
 
+    do {
+        buildJob(job);
+    } while (finishJob(job));
+}
+
+void NavMeshManager::buildJob(Reference<NavMeshJob*> job) {
     Reference<Zone*> zone = job->getZone();
     if (!zone) {
-        Locker locker(&jobQueueMutex);
-        jobs.put(job->getRegion()->getMeshName(), job);
         return;
     }
 
-    Locker areaLocker(job->getMutex());
-    //copy and clear this vector otherwise our scene data may not be correct if a zone was added during the build process
-    Vector <AABB> dirtyZones = Vector<AABB>(job->getAreas());
-    job->getAreas().removeAll();
-    areaLocker.release();
+    RecastNavMeshBuilder *builder = NULL;
 
-    NavMeshRegion *region = job->getRegion();
+    // the job has to finish whatever happens, or later areas of the region queue up behind it forever
+    try {
+        Locker areaLocker(job->getMutex());
+        //copy and clear this vector otherwise our scene data may not be correct if a zone was added during the build process
+        Vector <AABB> dirtyZones = Vector<AABB>(job->getAreas());
+        job->getAreas().removeAll();
+        areaLocker.release();
 
-    const AABB& bBox = region->getBoundingBox();
+        NavMeshRegion *region = job->getRegion();
 
-    float range = bBox.extents()[bBox.longestAxis()];
-    const Vector3& center = bBox.center();
+        const AABB& bBox = region->getBoundingBox();
 
-    String filename = region->getMeshName();
+        float range = bBox.extents()[bBox.longestAxis()];
+        const Vector3& center = bBox.center();
 
-    SortedVector <ManagedReference<QuadTreeEntry *>> closeObjects;
-    zone->getInRangeSolidObjects(center.getX(), center.getZ(), range, &closeObjects, true);
+        String filename = region->getMeshName();
 
-    Vector <Reference<MeshData *>> meshData;
+        SortedVector <ManagedReference<QuadTreeEntry *>> closeObjects;
+        zone->getInRangeSolidObjects(center.getX(), center.getZ(), range, &closeObjects, true);
 
-    for (int i = 0; i < closeObjects.size(); i++) {
-        SceneObject *sceno = closeObjects.get(i).castTo<SceneObject *>();
-        if (sceno) {
-            // TODO: Figure out why we need this
-            // Example: v 1393.67 3.09307e+06 -3217
-            // mos entha pristine wall
-            const float height = sceno->getPosition().getZ();
-            if(height > 10000 || height < -10000)
-                continue;
+        Vector <Reference<MeshData *>> meshData;
 
-            static const Matrix4 identity;
+        for (int i = 0; i < closeObjects.size(); i++) {
+            SceneObject *sceno = closeObjects.get(i).castTo<SceneObject *>();
+            if (sceno) {
+                // TODO: Figure out why we need this
+                // Example: v 1393.67 3.09307e+06 -3217
+                // mos entha pristine wall
+                const float height = sceno->getPosition().getZ();
+                if(height > 10000 || height < -10000)
+                    continue;
 
-            meshData.addAll(sceno->getTransformedMeshData(&identity));
-        }
-    }
+                static const Matrix4 identity;
 
-    RecastNavMeshBuilder *builder = NULL;
+                meshData.addAll(sceno->getTransformedMeshData(&identity));
+            }
+        }
 
-    builder = new RecastNavMeshBuilder(zone, filename);
+        builder = new RecastNavMeshBuilder(zone, filename);
 
-	builder->setRecastConfig(job->getRecastConfig());
+        builder->setRecastConfig(job->getRecastConfig());
+        builder->setTileWorkers(TileBuildQueue, maxConcurrentJobs);
 
-    float poleDist = job->getRecastConfig().distanceBetweenPoles;
+        float poleDist = job->getRecastConfig().distanceBetweenPoles;
 
-    if(poleDist < 1.0f)
-        poleDist = zone->getPlanetManager()->getTerrainManager()->getProceduralTerrainAppearance()->getDistanceBetweenPoles();
+        if(poleDist < 1.0f)
+            poleDist = zone->getPlanetManager()->getTerrainManager()->getProceduralTerrainAppearance()->getDistanceBetweenPoles();
 
-    builder->initialize(meshData, bBox, poleDist);
-    meshData.removeAll();
-    // This will take a very long time to complete
-    Reference<RecastNavMesh*> navmesh = region->getNavMesh();
-    bool initialBuild = (navmesh == NULL || !navmesh->isLoaded());
-    if (initialBuild) {
-        info("Rebuilding Base Mesh", true);
-        builder->build();
-    } else if (dirtyZones.size() > 0) {
-        info("Rebuilding area", true);
-        for (int i = dirtyZones.size() - 1; i >= 0; i--) {
-            const AABB &area = dirtyZones.get(i);
-            builder->rebuildArea(area, navmesh);
+        builder->initialize(meshData, bBox, poleDist);
+        meshData.removeAll();
+        // This will take a very long time to complete
+        Reference<RecastNavMesh*> navmesh = region->getNavMesh();
+        bool initialBuild = (navmesh == NULL || !navmesh->isLoaded());
+        if (initialBuild) {
+            info("Rebuilding Base Mesh", true);
+            builder->build();
+        } else if (dirtyZones.size() > 0) {
+            info("Rebuilding " + String::valueOf(dirtyZones.size()) + " areas", true);
+            builder->rebuildAreas(dirtyZones, navmesh);
         }
-    }
-
-    info("Region->name: " + filename);
 
-    builder->saveAll(filename);
+        info("Region->name: " + filename);
 
-    if(initialBuild) {
-        if(navmesh == NULL)
-            navmesh = new RecastNavMesh();
+        builder->saveAll(filename);
 
-        navmesh->setFileName(filename);
-        navmesh->setDetourNavMesh(builder->getNavMesh());
-        navmesh->setDetourNavMeshHeader(builder->getNavMeshHeader());
-
-        Locker locker(region);
-        region->setNavMesh(navmesh);
-    }
+        if(initialBuild) {
+            if(navmesh == NULL)
+                navmesh = new RecastNavMesh();
 
-    Locker locker(&jobQueueMutex);
-    if(job->getAreas().size() > 0) {
+            navmesh->setFileName(filename);
+            navmesh->setDetourNavMesh(builder->getNavMesh());
+            navmesh->setDetourNavMeshHeader(builder->getNavMeshHeader());
 
-        jobs.put(filename, job);
-    } else {
-        jobs.drop(filename);
-        runningJobs.drop(filename);
+            Locker locker(region);
+            region->setNavMesh(navmesh);
+        }
+    } catch (Exception& e) {
+        error("navmesh job for " + job->getRegion()->getMeshName() + " failed: " + e.getMessage());
+    } catch (...) {
+        error("navmesh job for " + job->getRegion()->getMeshName() + " failed");
     }
 
-    locker.release();
-
     delete builder;
-
-    //TODO: Fixme
-    Core::getTaskManager()->scheduleTask([=]{
-        checkJobs();
-    }, "checkNavJobs", 1000);
 }
 
 bool NavMeshManager::AABBEncompasessAABB(const AABB& lhs, const AABB& rhs) {
@@ -20,13 +20,24 @@ class NavMeshManager : public Singleton<NavMeshManager>, public Logger, public O
 
 protected:
 	int maxConcurrentJobs;
+	// queued or running jobs by mesh name, at most one per region
 	VectorMap<String, Reference<NavMeshJob*> > jobs;
-	VectorMap<String, Reference<NavMeshJob*> > runningJobs;
 	Mutex jobQueueMutex;
 
-
+	void executeJob(Reference<NavMeshJob*> job);
 	void startJob(Reference<NavMeshJob*> job);
-    void checkJobs();
+
+	/**
+	 * Builds the areas queued on job so far, areas added while it runs are
+	 * left for the next build
+	 */
+	virtual void buildJob(Reference<NavMeshJob*> job);
+
+	/**
+	 * Called by the task that ran job, returns true if areas were added in the
+	 * meantime and the task has to build it again
+	 */
+	bool finishJob(Reference<NavMeshJob*> job);
 public:
 	NavMeshManager();
 
@@ -43,5 +54,7 @@ public:
     // Higher thread count, used for building large static cities during initialization
     static const String MeshQueue; //"NavMeshBuilder";
 
+    // Sized by MaxNavMeshJobs, spreads the tiles of a single job over several threads
+    static const String TileBuildQueue; //"NavMeshTileBuilder";
 };
 #endif
@@ -0,0 +1,648 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#include "StaticCollisionTree.h"
+
+#include "server/zone/objects/scene/SceneObject.h"
+#include "templates/SharedObjectTemplate.h"
+#include "templates/appearance/PortalLayout.h"
+
+// appearance meshes may stick out of their bounding volume by a little
+#define BOUNDS_PADDING 1.f
+
+StaticCollisionTree::StaticCollisionTree() : nodes(64, 64) {
+	root = -1;
+	freeList = -1;
+}
+
+bool StaticCollisionTree::isCollisionCandidate(SceneObject* object) {
+	if (object == NULL || object->isCreatureObject())
+		return false;
+
+	SharedObjectTemplate* templateObject = object->getObjectTemplate();
+
+	if (templateObject == NULL)
+		return false;
+
+	return templateObject->getCollisionActionBlockFlags() != 0 || templateObject->getPortalLayout() != NULL;
+}
+
+bool StaticCollisionTree::getInstanceBounds(SceneObject* object, float* min, float* max) {
+	SharedObjectTemplate* templateObject = object->getObjectTemplate();
+
+	if (templateObject == NULL)
+		return false;
+
+	PortalLayout* portalLayout = templateObject->getPortalLayout();
+
+	const AppearanceTemplate* appearance = NULL;
+
+	if (portalLayout != NULL) {
+		if (portalLayout->getAppearanceTemplatesSize() > 0)
+			appearance = portalLayout->getAppearanceTemplate(0);
+	} else {
+		appearance = templateObject->getAppearanceTemplate();
+	}
+
+	if (appearance == NULL || appearance->getBoundingVolume() == NULL)
+		return false;
+
+	getInstanceBounds(object, appearance->getBoundingVolume()->getBoundingBox(), min, max);
+
+	return true;
+}
+
+void StaticCollisionTree::getInstanceBounds(SceneObject* object, const AABB& box, float* min, float* max) {
+	const Vector3* boxMin = box.getMinBound();
+	const Vector3* boxMax = box.getMaxBound();
+
+	// model space is y up and the object only rotates around y, so the horizontal
+	// extent is a circle around the object position
+	float extentX = MAX(fabs(boxMin->getX()), fabs(boxMax->getX()));
+	float extentZ = MAX(fabs(boxMin->getZ()), fabs(boxMax->getZ()));
+	float radius = Math::sqrt(extentX * extentX + extentZ * extentZ) + BOUNDS_PADDING;
+
+	min[0] = object->getPositionX() - radius;
+	max[0] = object->getPositionX() + radius;
+	min[1] = object->getPositionZ() + boxMin->getY() - BOUNDS_PADDING;
+	max[1] = object->getPositionZ() + boxMax->getY() + BOUNDS_PADDING;
+	min[2] = object->getPositionY() - radius;
+	max[2] = object->getPositionY() + radius;
+}
+
+Vector3 StaticCollisionTree::getTreePosition(const Vector3& worldPosition) {
+	return Vector3(worldPosition.getX(), worldPosition.getZ(), worldPosition.getY());
+}
+
+void StaticCollisionTree::insert(SceneObject* object) {
+	if (!isCollisionCandidate(object))
+		return;
+
+	float min[3], max[3];
+
+	if (getInstanceBounds(object, min, max)) {
+		insert(object, min, max);
+
+		return;
+	}
+
+	Locker locker(&lock);
+
+	if (!leaves.containsKey(object->getObjectID()) && !unboundedObjects.contains(object))
+		unboundedObjects.put(object);
+}
+
+void StaticCollisionTree::insert(SceneObject* object, const float* min, const float* max) {
+	Locker locker(&lock);
+
+	uint64 oid = object->getObjectID();
+
+	if (leaves.containsKey(oid) || unboundedObjects.contains(object))
+		return;
+
+	int leaf = allocateNode();
+	Node& node = getNode(leaf);
+
+	for (int i = 0; i < 3; ++i) {
+		node.min[i] = min[i];
+		node.max[i] = max[i];
+	}
+
+	node.height = 0;
+	node.object = object;
+
+	insertLeaf(leaf);
+
+	leaves.put(oid, leaf);
+}
+
+void StaticCollisionTree::remove(SceneObject* object) {
+	if (object == NULL || object->isCreatureObject())
+		return;
+
+	Locker locker(&lock);
+
+	uint64 oid = object->getObjectID();
+
+	if (!leaves.containsKey(oid)) {
+		unboundedObjects.drop(object);
+
+		return;
+	}
+
+	int leaf = leaves.get(oid);
+
+	leaves.remove(oid);
+
+	removeLeaf(leaf);
+	freeNode(leaf);
+}
+
+void StaticCollisionTree::update(SceneObject* object) {
+	// most objects that move never make it into the tree
+	if (!isCollisionCandidate(object))
+		return;
+
+	float min[3], max[3];
+
+	if (!getInstanceBounds(object, min, max))
+		return;
+
+	Locker locker(&lock);
+
+	uint64 oid = object->getObjectID();
+
+	if (!leaves.containsKey(oid))
+		return;
+
+	int leaf = leaves.get(oid);
+
+	Node& node = getNode(leaf);
+
+	bool moved = false;
+
+	for (int i = 0; i < 3; ++i) {
+		if (min[i] != node.min[i] || max[i] != node.max[i])
+			moved = true;
+	}
+
+	if (!moved)
+		return;
+
+	removeLeaf(leaf);
+
+	Node& refitted = getNode(leaf);
+
+	for (int i = 0; i < 3; ++i) {
+		refitted.min[i] = min[i];
+		refitted.max[i] = max[i];
+	}
+
+	insertLeaf(leaf);
+}
+
+/**
+ * Overlap tests of the queries, in tree space
+ */
+class SegmentQuery {
+	float origin[3];
+	float direction[3];
+
+public:
+	SegmentQuery(const Vector3& from, const Vector3& to) {
+		origin[0] = from.getX();
+		origin[1] = from.getY();
+		origin[2] = from.getZ();
+		direction[0] = to.getX() - origin[0];
+		direction[1] = to.getY() - origin[1];
+		direction[2] = to.getZ() - origin[2];
+	}
+
+	bool overlaps(const float* min, const float* max) const {
+		float tmin = 0.f;
+		float tmax = 1.f;
+
+		for (int i = 0; i < 3; ++i) {
+			if (fabs(direction[i]) < 1e-6f) {
+				if (origin[i] < min[i] || origin[i] > max[i])
+					return false;
+
+				continue;
+			}
+
+			float inverse = 1.f / direction[i];
+			float t1 = (min[i] - origin[i]) * inverse;
+			float t2 = (max[i] - origin[i]) * inverse;
+
+			if (t1 > t2) {
+				float t = t1;
+				t1 = t2;
+				t2 = t;
+			}
+
+			tmin = MAX(tmin, t1);
+			tmax = MIN(tmax, t2);
+
+			if (tmin > tmax)
+				return false;
+		}
+
+		return true;
+	}
+};
+
+class ColumnQuery {
+	float x, y;
+
+public:
+	ColumnQuery(float x, float y) : x(x), y(y) {
+	}
+
+	bool overlaps(const float* min, const float* max) const {
+		return x >= min[0] && x <= max[0] && y >= min[2] && y <= max[2];
+	}
+};
+
+class SphereQuery {
+	float center[3];
+	float squaredRadius;
+
+public:
+	SphereQuery(const Vector3& point, float radius) {
+		center[0] = point.getX();
+		center[1] = point.getY();
+		center[2] = point.getZ();
+		squaredRadius = radius * radius;
+	}
+
+	bool overlaps(const float* min, const float* max) const {
+		float squaredDistance = 0;
+
+		for (int i = 0; i < 3; ++i) {
+			if (center[i] < min[i])
+				squaredDistance += (min[i] - center[i]) * (min[i] - center[i]);
+			else if (center[i] > max[i])
+				squaredDistance += (center[i] - max[i]) * (center[i] - max[i]);
+		}
+
+		return squaredDistance <= squaredRadius;
+	}
+};
+
+class BoxQuery {
+	const float* boxMin;
+	const float* boxMax;
+
+public:
+	BoxQuery(const float* min, const float* max) : boxMin(min), boxMax(max) {
+	}
+
+	bool overlaps(const float* min, const float* max) const {
+		for (int i = 0; i < 3; ++i) {
+			if (boxMin[i] > max[i] || boxMax[i] < min[i])
+				return false;
+		}
+
+		return true;
+	}
+};
+
+template<class Query>
+int StaticCollisionTree::query(const Query& test, Vector<Reference<SceneObject*> >& objects) {
+	ReadLocker locker(&lock);
+
+	addUnboundedObjects(objects);
+
+	// walks the tree through the parent links, so there is no stack that could run out
+	int index = root;
+	int previous = -1;
+
+	while (index != -1) {
+		const Node& node = getNode(index);
+
+		int next = node.parent;
+
+		if (previous == node.parent) {
+			if (test.overlaps(node.min, node.max)) {
+				if (node.isLeaf())
+					objects.add(node.object);
+				else
+					next = node.left;
+			}
+		} else if (previous == node.left) {
+			next = node.right;
+		}
+
+		previous = index;
+		index = next;
+	}
+
+	return objects.size();
+}
+
+int StaticCollisionTree::getSegmentCandidates(const Vector3& from, const Vector3& to, Vector<Reference<SceneObject*> >& objects) {
+	return query(SegmentQuery(from, to), objects);
+}
+
+int StaticCollisionTree::getSegmentsCandidates(const Vector<Vector3>& origins, const Vector3& end, Vector<Reference<SceneObject*> >& objects) {
+	float min[3] = { end.getX(), end.getY(), end.getZ() };
+	float max[3] = { end.getX(), end.getY(), end.getZ() };
+
+	for (int i = 0; i < origins.size(); ++i) {
+		const Vector3& origin = origins.get(i);
+		float point[3] = { origin.getX(), origin.getY(), origin.getZ() };
+
+		for (int j = 0; j < 3; ++j) {
+			min[j] = MIN(min[j], point[j]);
+			max[j] = MAX(max[j], point[j]);
+		}
+	}
+
+	return query(BoxQuery(min, max), objects);
+}
+
+int StaticCollisionTree::getColumnCandidates(float x, float y, Vector<Reference<SceneObject*> >& objects) {
+	return query(ColumnQuery(x, y), objects);
+}
+
+int StaticCollisionTree::getSphereCandidates(const Vector3& center, float radius, Vector<Reference<SceneObject*> >& objects) {
+	return query(SphereQuery(center, radius), objects);
+}
+
+int StaticCollisionTree::getBoxCandidates(const float* min, const float* max, Vector<Reference<SceneObject*> >& objects) {
+	return query(BoxQuery(min, max), objects);
+}
+
+void StaticCollisionTree::addUnboundedObjects(Vector<Reference<SceneObject*> >& objects) {
+	for (int i = 0; i < unboundedObjects.size(); ++i)
+		objects.add(unboundedObjects.get(i));
+}
+
+int StaticCollisionTree::allocateNode() {
+	if (freeList == -1) {
+		nodes.add(Node());
+
+		return nodes.size() - 1;
+	}
+
+	int index = freeList;
+	freeList = getNode(index).parent;
+
+	getNode(index) = Node();
+
+	return index;
+}
+
+void StaticCollisionTree::freeNode(int index) {
+	Node& node = getNode(index);
+
+	node.parent = freeList;
+	node.left = -1;
+	node.right = -1;
+	node.height = -1;
+	node.object = NULL;
+
+	freeList = index;
+}
+
+float StaticCollisionTree::getSurfaceArea(const float* min, const float* max) {
+	float dx = max[0] - min[0];
+	float dy = max[1] - min[1];
+	float dz = max[2] - min[2];
+
+	return 2.f * (dx * dy + dy * dz + dz * dx);
+}
+
+float StaticCollisionTree::getUnionSurfaceArea(const Node& first, const Node& second) {
+	float min[3], max[3];
+
+	for (int i = 0; i < 3; ++i) {
+		min[i] = MIN(first.min[i], second.min[i]);
+		max[i] = MAX(first.max[i], second.max[i]);
+	}
+
+	return getSurfaceArea(min, max);
+}
+
+void StaticCollisionTree::setUnion(int index, int first, int second) {
+	Node& node = getNode(index);
+	const Node& a = getNode(first);
+	const Node& b = getNode(second);
+
+	for (int i = 0; i < 3; ++i) {
+		node.min[i] = MIN(a.min[i], b.min[i]);
+		node.max[i] = MAX(a.max[i], b.max[i]);
+	}
+}
+
+void StaticCollisionTree::insertLeaf(int leaf) {
+	if (root == -1) {
+		root = leaf;
+		getNode(root).parent = -1;
+
+		return;
+	}
+
+	// pick the sibling that grows the total surface area the least
+	int index = root;
+
+	while (!getNode(index).isLeaf()) {
+		const Node& node = getNode(index);
+		const Node& leafNode = getNode(leaf);
+
+		float area = getSurfaceArea(node.min, node.max);
+		float combinedArea = getUnionSurfaceArea(node, leafNode);
+
+		float cost = 2.f * combinedArea;
+		float inheritanceCost = 2.f * (combinedArea - area);
+
+		const Node& left = getNode(node.left);
+		float costLeft = getUnionSurfaceArea(left, leafNode) + inheritanceCost;
+
+		if (!left.isLeaf())
+			costLeft -= getSurfaceArea(left.min, left.max);
+
+		const Node& right = getNode(node.right);
+		float costRight = getUnionSurfaceArea(right, leafNode) + inheritanceCost;
+
+		if (!right.isLeaf())
+			costRight -= getSurfaceArea(right.min, right.max);
+
+		if (cost < costLeft && cost < costRight)
+			break;
+
+		index = costLeft < costRight ? node.left : node.right;
+	}
+
+	int sibling = index;
+	int oldParent = getNode(sibling).parent;
+
+	// allocateNode can grow nodes, don't hold references across it
+	int newParent = allocateNode();
+
+	Node& parentNode = getNode(newParent);
+	parentNode.parent = oldParent;
+	parentNode.object = NULL;
+	parentNode.height = getNode(sibling).height + 1;
+	parentNode.left = sibling;
+	parentNode.right = leaf;
+
+	setUnion(newParent, sibling, leaf);
+
+	if (oldParent != -1) {
+		Node& oldParentNode = getNode(oldParent);
+
+		if (oldParentNode.left == sibling)
+			oldParentNode.left = newParent;
+		else
+			oldParentNode.right = newParent;
+	} else {
+		root = newParent;
+	}
+
+	getNode(sibling).parent = newParent;
+	getNode(leaf).parent = newParent;
+
+	refitAncestors(newParent);
+}
+
+void StaticCollisionTree::removeLeaf(int leaf) {
+	if (leaf == root) {
+		root = -1;
+
+		return;
+	}
+
+	int parent = getNode(leaf).parent;
+	int grandParent = getNode(parent).parent;
+	int sibling = getNode(parent).left == leaf ? getNode(parent).right : getNode(parent).left;
+
+	if (grandParent != -1) {
+		Node& grandParentNode = getNode(grandParent);
+
+		if (grandParentNode.left == parent)
+			grandParentNode.left = sibling;
+		else
+			grandParentNode.right = sibling;
+
+		getNode(sibling).parent = grandParent;
+
+		freeNode(parent);
+
+		refitAncestors(grandParent);
+	} else {
+		root = sibling;
+		getNode(sibling).parent = -1;
+
+		freeNode(parent);
+	}
+
+	getNode(leaf).parent = -1;
+}
+
+void StaticCollisionTree::refitAncestors(int index) {
+	while (index != -1) {
+		index = balance(index);
+
+		Node& node = getNode(index);
+
+		node.height = 1 + MAX(getNode(node.left).height, getNode(node.right).height);
+		setUnion(index, node.left, node.right);
+
+		index = node.parent;
+	}
+}
+
+int StaticCollisionTree::balance(int iA) {
+	Node& A = getNode(iA);
+
+	if (A.isLeaf() || A.height < 2)
+		return iA;
+
+	int iB = A.left;
+	int iC = A.right;
+
+	Node& B = getNode(iB);
+	Node& C = getNode(iC);
+
+	int heightDifference = C.height - B.height;
+
+	// rotate C up
+	if (heightDifference > 1) {
+		int iF = C.left;
+		int iG = C.right;
+
+		Node& F = getNode(iF);
+		Node& G = getNode(iG);
+
+		C.left = iA;
+		C.parent = A.parent;
+		A.parent = iC;
+
+		if (C.parent != -1) {
+			Node& parent = getNode(C.parent);
+
+			if (parent.left == iA)
+				parent.left = iC;
+			else
+				parent.right = iC;
+		} else {
+			root = iC;
+		}
+
+		if (F.height > G.height) {
+			C.right = iF;
+			A.right = iG;
+			G.parent = iA;
+
+			setUnion(iA, iB, iG);
+			setUnion(iC, iA, iF);
+
+			A.height = 1 + MAX(B.height, G.height);
+			C.height = 1 + MAX(A.height, F.height);
+		} else {
+			C.right = iG;
+			A.right = iF;
+			F.parent = iA;
+
+			setUnion(iA, iB, iF);
+			setUnion(iC, iA, iG);
+
+			A.height = 1 + MAX(B.height, F.height);
+			C.height = 1 + MAX(A.height, G.height);
+		}
+
+		return iC;
+	}
+
+	// rotate B up
+	if (heightDifference < -1) {
+		int iD = B.left;
+		int iE = B.right;
+
+		Node& D = getNode(iD);
+		Node& E = getNode(iE);
+
+		B.left = iA;
+		B.parent = A.parent;
+		A.parent = iB;
+
+		if (B.parent != -1) {
+			Node& parent = getNode(B.parent);
+
+			if (parent.left == iA)
+				parent.left = iB;
+			else
+				parent.right = iB;
+		} else {
+			root = iB;
+		}
+
+		if (D.height > E.height) {
+			B.right = iD;
+			A.left = iE;
+			E.parent = iA;
+
+			setUnion(iA, iC, iE);
+			setUnion(iB, iA, iD);
+
+			A.height = 1 + MAX(C.height, E.height);
+			B.height = 1 + MAX(A.height, D.height);
+		} else {
+			B.right = iE;
+			A.left = iD;
+			D.parent = iA;
+
+			setUnion(iA, iC, iD);
+			setUnion(iB, iA, iE);
+
+			A.height = 1 + MAX(C.height, D.height);
+			B.height = 1 + MAX(A.height, E.height);
+		}
+
+		return iB;
+	}
+
+	return iA;
+}
@@ -0,0 +1,172 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#ifndef STATICCOLLISIONTREE_H_
+#define STATICCOLLISIONTREE_H_
+
+#include "engine/engine.h"
+
+namespace server {
+namespace zone {
+namespace objects {
+namespace scene {
+	class SceneObject;
+}
+}
+}
+}
+
+using namespace server::zone::objects::scene;
+
+/**
+ * Top level of the zone collision hierarchy: a balanced dynamic AABB tree
+ * over the bounds of every world object that has a collision appearance or
+ * a portal layout. The appearance AABB trees are the bottom level.
+ *
+ * Bounds are kept in the frame CollisionManager::convertToModelSpace expects
+ * its input in (x, height, y) and cover every rotation of the object, so
+ * rotating an object never requires an update. Queries take their positions
+ * in that same tree space, see getTreePosition.
+ */
+class StaticCollisionTree : public Object {
+protected:
+	class Node {
+	public:
+		float min[3];
+		float max[3];
+
+		// next free node while the node is unused
+		int parent;
+		int left;
+		int right;
+
+		// -1 when the node is unused
+		int height;
+
+		SceneObject* object;
+
+		Node() : parent(-1), left(-1), right(-1), height(-1), object(NULL) {
+			for (int i = 0; i < 3; ++i) {
+				min[i] = 0;
+				max[i] = 0;
+			}
+		}
+
+		bool isLeaf() const {
+			return left == -1;
+		}
+	};
+
+	Vector<Node> nodes;
+	int root;
+	int freeList;
+
+	// object id -> leaf node
+	HashTable<uint64, int> leaves;
+
+	// objects whose appearance has no bounding volume, returned by every query
+	SortedVector<SceneObject*> unboundedObjects;
+
+	ReadWriteLock lock;
+
+public:
+	StaticCollisionTree();
+
+	/**
+	 * Adds object if it is a world object that can block collision queries
+	 */
+	void insert(SceneObject* object);
+	void remove(SceneObject* object);
+
+	/**
+	 * Refits the leaf of object after it moved
+	 */
+	void update(SceneObject* object);
+
+	/**
+	 * Collects the objects whose bounds the segment from-to crosses
+	 * @param from position in tree space (x, height, y)
+	 * @param to position in tree space (x, height, y)
+	 */
+	int getSegmentCandidates(const Vector3& from, const Vector3& to, Vector<Reference<SceneObject*> >& objects);
+
+	/**
+	 * Collects the objects whose bounds overlap the box around the segments from each of origins to end
+	 * @param origins positions in tree space (x, height, y)
+	 * @param end position in tree space (x, height, y)
+	 */
+	int getSegmentsCandidates(const Vector<Vector3>& origins, const Vector3& end, Vector<Reference<SceneObject*> >& objects);
+
+	/**
+	 * Collects the objects whose bounds contain the vertical line at x, y,
+	 * the horizontal axes of both world and tree space
+	 */
+	int getColumnCandidates(float x, float y, Vector<Reference<SceneObject*> >& objects);
+
+	/**
+	 * @param center position in tree space (x, height, y)
+	 */
+	int getSphereCandidates(const Vector3& center, float radius, Vector<Reference<SceneObject*> >& objects);
+
+	/**
+	 * Collects the objects whose bounds overlap the box min-max, in tree space (x, height, y)
+	 */
+	int getBoxCandidates(const float* min, const float* max, Vector<Reference<SceneObject*> >& objects);
+
+	int size() {
+		ReadLocker locker(&lock);
+
+		return leaves.size() + unboundedObjects.size();
+	}
+
+	static bool isCollisionCandidate(SceneObject* object);
+
+	/**
+	 * @return worldPosition (x, y, z up) in the tree space (x, height, y)
+	 */
+	static Vector3 getTreePosition(const Vector3& worldPosition);
+
+protected:
+	/**
+	 * @return false if the appearance of object has no bounding volume
+	 */
+	static bool getInstanceBounds(SceneObject* object, float* min, float* max);
+
+	/**
+	 * Bounds of object for its appearance bounding box
+	 */
+	static void getInstanceBounds(SceneObject* object, const AABB& box, float* min, float* max);
+
+	/**
+	 * Adds a leaf with the bounds min-max for object
+	 */
+	void insert(SceneObject* object, const float* min, const float* max);
+
+	/**
+	 * Collects the objects whose bounds overlap test, see the query classes in StaticCollisionTree.cpp
+	 */
+	template<class Query>
+	int query(const Query& test, Vector<Reference<SceneObject*> >& objects);
+
+	int allocateNode();
+	void freeNode(int index);
+
+	void insertLeaf(int leaf);
+	void removeLeaf(int leaf);
+	void refitAncestors(int index);
+	int balance(int index);
+
+	void setUnion(int index, int first, int second);
+
+	static float getSurfaceArea(const float* min, const float* max);
+	static float getUnionSurfaceArea(const Node& first, const Node& second);
+
+	void addUnboundedObjects(Vector<Reference<SceneObject*> >& objects);
+
+	Node& getNode(int index) {
+		return nodes.get(index);
+	}
+};
+
+#endif /* STATICCOLLISIONTREE_H_ */
@@ -0,0 +1,194 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#include "gtest/gtest.h"
+
+#include "server/zone/Zone.h"
+#include "server/zone/ZoneProcessServer.h"
+#include "server/zone/objects/scene/SceneObject.h"
+#include "server/zone/managers/collision/CollisionManager.h"
+#include "server/zone/managers/collision/StaticCollisionTree.h"
+#include "templates/manager/TemplateManager.h"
+#include "templates/manager/DataArchiveStore.h"
+#include "conf/ConfigManager.h"
+
+class CollisionManagerTest : public ::testing::Test {
+protected:
+	Reference<ZoneServer*> zoneServer;
+	Reference<ZoneProcessServer*> processServer;
+	Reference<Zone*> zone;
+	AtomicLong nextObjectId;
+
+	Vector<Reference<SceneObject*> > objects;
+
+public:
+	const static String BUILDINGTEMPLATE;
+
+	CollisionManagerTest() {
+		nextObjectId = 1;
+	}
+
+	void SetUp() {
+		ConfigManager::instance()->loadConfigData();
+		ConfigManager::instance()->setProgressMonitors(false);
+		DataArchiveStore::instance()->loadTres(ConfigManager::instance()->getTrePath(), ConfigManager::instance()->getTreFiles());
+
+		if (TemplateManager::instance()->loadedTemplatesCount == 0)
+			TemplateManager::instance()->loadLuaTemplates();
+
+		zoneServer = new ZoneServer(ConfigManager::instance());
+		processServer = new ZoneProcessServer(zoneServer);
+		zone = new Zone(processServer, "test_zone");
+		zone->createContainerComponent();
+		zone->_setObjectID(1);
+	}
+
+	void TearDown() {
+		for (int i = 0; i < objects.size(); ++i) {
+			SceneObject* object = objects.get(i);
+
+			Locker locker(object);
+
+			object->destroyObjectFromWorld(false);
+		}
+
+		objects.removeAll();
+
+		zone = NULL;
+		processServer = NULL;
+		zoneServer = NULL;
+	}
+
+	/**
+	 * Object at x, y with its feet at z, line of sight rays start 1m above that
+	 */
+	SceneObject* createObject(float x, float z, float y, const String& templateName = "", float heading = 0) {
+		Reference<SceneObject*> object = new SceneObject();
+		object->setContainerComponent("ContainerComponent");
+		object->setZoneComponent("ZoneComponent");
+		object->_setObjectID(nextObjectId.increment());
+
+		if (!templateName.isEmpty())
+			object->loadTemplateData(TemplateManager::instance()->getTemplate(templateName.hashCode()));
+
+		Locker locker(object);
+
+		object->initializePosition(x, z, y);
+		object->setDirection(heading);
+
+		zone->transferObject(object, -1);
+
+		objects.add(object);
+
+		return object;
+	}
+
+	SceneObject* createBuilding(float x, float y, float heading = 0) {
+		SceneObject* building = createObject(x, 0, y, BUILDINGTEMPLATE, heading);
+
+		EXPECT_TRUE(CollisionManager::getCollisionAppearance(building, 255) != NULL);
+
+		return building;
+	}
+
+	/**
+	 * Whether the collision tree hands building to the narrow phase for the ray between first and second
+	 */
+	bool isCandidate(SceneObject* first, SceneObject* second, SceneObject* building) {
+		Vector3 from = first->getWorldPosition();
+		from.setZ(from.getZ() + 1.f);
+
+		Vector3 to = second->getWorldPosition();
+		to.setZ(to.getZ() + 1.f);
+
+		Vector<Reference<SceneObject*> > candidates;
+		zone->getCollisionTree()->getSegmentCandidates(StaticCollisionTree::getTreePosition(from), StaticCollisionTree::getTreePosition(to), candidates);
+
+		for (int i = 0; i < candidates.size(); ++i) {
+			if (candidates.get(i) == building)
+				return true;
+		}
+
+		return false;
+	}
+};
+
+const String CollisionManagerTest::BUILDINGTEMPLATE = "object/building/player/player_house_tatooine_small_style_01.iff";
+
+TEST_F(CollisionManagerTest, KnownObstacleBlocksLineOfSight) {
+	// far from the origin on both axes so a ray in the wrong frame misses it
+	SceneObject* building = createBuilding(3000, -2000);
+
+	SceneObject* west = createObject(2960, 2, -2000);
+	SceneObject* east = createObject(3040, 2, -2000);
+
+	ASSERT_TRUE(isCandidate(west, east, building));
+
+	EXPECT_FALSE(CollisionManager::checkLineOfSight(west, east));
+	EXPECT_FALSE(CollisionManager::checkLineOfSight(east, west));
+
+	// well over the roof
+	SceneObject* highWest = createObject(2960, 100, -2000);
+	SceneObject* highEast = createObject(3040, 100, -2000);
+
+	EXPECT_FALSE(isCandidate(highWest, highEast, building));
+	EXPECT_TRUE(CollisionManager::checkLineOfSight(highWest, highEast));
+
+	// beside it
+	SceneObject* northWest = createObject(2960, 2, -1900);
+	SceneObject* northEast = createObject(3040, 2, -1900);
+
+	EXPECT_TRUE(CollisionManager::checkLineOfSight(northWest, northEast));
+}
+
+TEST_F(CollisionManagerTest, RotatedObstacleBlocksLineOfSight) {
+	SceneObject* building = createBuilding(-2500, 3500, M_PI / 2);
+
+	SceneObject* south = createObject(-2500, 2, 3460);
+	SceneObject* north = createObject(-2500, 2, 3540);
+
+	ASSERT_TRUE(isCandidate(south, north, building));
+
+	EXPECT_FALSE(CollisionManager::checkLineOfSight(south, north));
+}
+
+TEST_F(CollisionManagerTest, AreaLineOfSightMatchesSingleChecks) {
+	createBuilding(1000, 1500);
+	createBuilding(1000, 1560, M_PI / 2);
+
+	SceneObject* target = createObject(1040, 2, 1500);
+
+	// attackers behind the buildings, beside them and above them
+	Vector<SceneObject*> attackers;
+
+	for (int i = 0; i < 5; ++i) {
+		attackers.add(createObject(960, 2, 1490 + i * 5));
+		attackers.add(createObject(955 + i * 3, 2, 1565));
+		attackers.add(createObject(960 + i * 10, 2, 1430));
+	}
+
+	attackers.add(createObject(960, 100, 1500));
+
+	Vector<bool> visible;
+	int visibleCount = CollisionManager::checkLineOfSight(attackers, target, visible);
+
+	ASSERT_EQ(attackers.size(), visible.size());
+
+	int singleCount = 0;
+
+	for (int i = 0; i < attackers.size(); ++i) {
+		bool single = CollisionManager::checkLineOfSight(attackers.get(i), target);
+
+		EXPECT_EQ(single, visible.get(i)) << "attacker at " << attackers.get(i)->getPositionX() << " " << attackers.get(i)->getPositionY();
+
+		if (single)
+			++singleCount;
+	}
+
+	EXPECT_EQ(singleCount, visibleCount);
+
+	// some of them have to be blocked and some not for the comparison to mean anything
+	EXPECT_GT(visibleCount, 0);
+	EXPECT_LT(visibleCount, attackers.size());
+}
@@ -0,0 +1,105 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#include "gtest/gtest.h"
+#include "server/zone/managers/collision/NavMeshJob.h"
+#include "server/zone/managers/collision/NavMeshManager.h"
+#include "pathfinding/RecastNavMeshBuilder.h"
+
+namespace server {
+namespace zone {
+namespace managers {
+namespace collision {
+namespace test {
+
+class NavMeshJobTest : public ::testing::Test {
+public:
+	// recast frame: x, height, -y
+	AABB meshBounds;
+	RecastSettings settings;
+
+	NavMeshJobTest() : meshBounds(Vector3(-256, -50, -256), Vector3(256, 50, 256)) {
+	}
+
+	AABB getStructureArea(float x, float y, float extent) {
+		Vector3 position(x, y, 0);
+		Vector3 extents(extent, extent, extent);
+
+		return AABB(position - extents, position + extents);
+	}
+
+	int countAreaTiles(const AABB& area) {
+		SortedVector<uint32> tiles;
+		tiles.setNoDuplicateInsertPlan();
+
+		RecastNavMeshBuilder::getAreaTiles(meshBounds, settings, area, tiles);
+
+		return tiles.size();
+	}
+};
+
+TEST_F(NavMeshJobTest, AreaTilesContainTheTileOfTheAreaCenter) {
+	SortedVector<uint32> tiles;
+	tiles.setNoDuplicateInsertPlan();
+
+	RecastNavMeshBuilder::getAreaTiles(meshBounds, settings, getStructureArea(0, 0, 8), tiles);
+
+	const float tcs = settings.m_tileSize * settings.m_cellSize;
+	uint32 tile = (uint32) (256 / tcs);
+
+	EXPECT_TRUE(tiles.contains(tile << 16 | tile));
+}
+
+TEST_F(NavMeshJobTest, RepeatedAreaDoesNotAddTiles) {
+	AABB area = getStructureArea(20, -30, 8);
+
+	SortedVector<uint32> tiles;
+	tiles.setNoDuplicateInsertPlan();
+
+	RecastNavMeshBuilder::getAreaTiles(meshBounds, settings, area, tiles);
+	int once = tiles.size();
+
+	RecastNavMeshBuilder::getAreaTiles(meshBounds, settings, area, tiles);
+
+	EXPECT_GT(once, 0);
+	EXPECT_EQ(tiles.size(), once);
+}
+
+TEST_F(NavMeshJobTest, StructurePlacementBurstBuildsEachTileOnce) {
+	SortedVector<uint32> tiles;
+	tiles.setNoDuplicateInsertPlan();
+
+	int separateBuilds = 0;
+
+	// a row of houses placed one after the other
+	for (int i = 0; i < 10; ++i) {
+		AABB area = getStructureArea(i * 10.f, 0, 8);
+
+		separateBuilds += countAreaTiles(area);
+		RecastNavMeshBuilder::getAreaTiles(meshBounds, settings, area, tiles);
+	}
+
+	EXPECT_GT(tiles.size(), 0);
+	EXPECT_LT(tiles.size() * 3, separateBuilds);
+}
+
+TEST_F(NavMeshJobTest, AddAreaDropsEncompassedAreas) {
+	Reference<NavMeshJob*> job = new NavMeshJob(NULL, NULL, settings, NavMeshManager::TileQueue);
+
+	job->addArea(getStructureArea(0, 0, 8));
+	job->addArea(getStructureArea(4, 4, 2));
+	EXPECT_EQ(job->getAreas().size(), 1);
+
+	job->addArea(getStructureArea(0, 0, 64));
+	EXPECT_EQ(job->getAreas().size(), 1);
+
+	job->addArea(getStructureArea(200, 200, 8));
+	EXPECT_EQ(job->getAreas().size(), 2);
+}
+
+}
+}
+}
+}
+}
@@ -0,0 +1,220 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#include "gtest/gtest.h"
+
+#include "server/zone/Zone.h"
+#include "server/zone/ZoneProcessServer.h"
+#include "server/zone/managers/collision/NavMeshManager.h"
+#include "conf/ConfigManager.h"
+
+namespace server {
+namespace zone {
+namespace managers {
+namespace collision {
+namespace test {
+
+/**
+ * Runs jobs through the real queue and task, but only records the builds
+ */
+class RecordingNavMeshManager : public NavMeshManager {
+	Mutex buildMutex;
+	Time firstEnqueue;
+	Vector<uint64> buildStarts;
+	Vector<int> buildAreas;
+	int buildTime;
+
+protected:
+	void buildJob(Reference<NavMeshJob*> job) {
+		Locker locker(&buildMutex);
+		buildStarts.add(firstEnqueue.miliDifference());
+
+		Locker areaLocker(job->getMutex());
+		buildAreas.add(job->getAreas().size());
+		job->getAreas().removeAll();
+		areaLocker.release();
+
+		int sleepTime = buildTime;
+		locker.release();
+
+		Thread::sleep(sleepTime);
+	}
+
+public:
+	RecordingNavMeshManager() {
+		buildTime = 0;
+	}
+
+	void reset(int buildTime) {
+		Locker locker(&buildMutex);
+
+		this->buildTime = buildTime;
+		buildStarts.removeAll();
+		buildAreas.removeAll();
+		firstEnqueue.updateToCurrentTime();
+	}
+
+	bool waitForJobs(int timeout) {
+		Time start;
+
+		while (start.miliDifference() < (uint64) timeout) {
+			Locker locker(&jobQueueMutex);
+
+			if (jobs.size() == 0)
+				return true;
+
+			locker.release();
+
+			Thread::sleep(10);
+		}
+
+		return false;
+	}
+
+	int getBuildCount() {
+		Locker locker(&buildMutex);
+		return buildStarts.size();
+	}
+
+	uint64 getBuildStart(int build) {
+		Locker locker(&buildMutex);
+		return buildStarts.get(build);
+	}
+
+	int getBuiltAreaCount() {
+		Locker locker(&buildMutex);
+
+		int count = 0;
+
+		for (int i = 0; i < buildAreas.size(); ++i)
+			count += buildAreas.get(i);
+
+		return count;
+	}
+};
+
+class NavMeshManagerTest : public ::testing::Test {
+protected:
+	Reference<ZoneServer*> zoneServer;
+	Reference<ZoneProcessServer*> processServer;
+	Reference<Zone*> zone;
+	RecastSettings settings;
+
+public:
+	// milliseconds a placement may wait before its build starts
+	const static int MAXLATENCY = 100;
+
+	// the constructor sets up the navmesh task queues, so there is only one
+	static RecordingNavMeshManager* getManager() {
+		static RecordingNavMeshManager manager;
+
+		return &manager;
+	}
+
+	void SetUp() {
+		ConfigManager::instance()->loadConfigData();
+		ConfigManager::instance()->setProgressMonitors(false);
+		zoneServer = new ZoneServer(ConfigManager::instance());
+		processServer = new ZoneProcessServer(zoneServer);
+		zone = new Zone(processServer, "test_zone");
+		zone->createContainerComponent();
+		zone->_setObjectID(1);
+	}
+
+	void TearDown() {
+		EXPECT_TRUE(getManager()->waitForJobs(5000));
+
+		zone = NULL;
+		processServer = NULL;
+		zoneServer = NULL;
+	}
+
+	Reference<NavMeshRegion*> createRegion(const String& name) {
+		Reference<NavMeshRegion*> region = new NavMeshRegion();
+
+		Locker locker(region);
+		region->setMeshName(name);
+
+		return region;
+	}
+
+	// far enough apart that the job keeps every one of them
+	AABB getStructureArea(int index) {
+		Vector3 position(index * 100.f, 0, 0);
+		Vector3 extents(8, 8, 8);
+
+		return AABB(position - extents, position + extents);
+	}
+};
+
+TEST_F(NavMeshManagerTest, PlacementStartsBuildRightAway) {
+	RecordingNavMeshManager* manager = getManager();
+	Reference<NavMeshRegion*> region = createRegion("navmesh_manager_test_single");
+
+	manager->reset(0);
+	manager->enqueueJob(zone, region, getStructureArea(0), settings, NavMeshManager::TileQueue);
+
+	ASSERT_TRUE(manager->waitForJobs(5000));
+
+	ASSERT_EQ(manager->getBuildCount(), 1);
+	EXPECT_LT(manager->getBuildStart(0), (uint64) MAXLATENCY);
+	EXPECT_EQ(manager->getBuiltAreaCount(), 1);
+}
+
+TEST_F(NavMeshManagerTest, PlacementBurstBuildsAtMostTwice) {
+	RecordingNavMeshManager* manager = getManager();
+	Reference<NavMeshRegion*> region = createRegion("navmesh_manager_test_burst");
+
+	const int buildTime = 300;
+	const int placements = 10;
+
+	manager->reset(buildTime);
+
+	// a row of houses placed while the first build runs
+	for (int i = 0; i < placements; ++i) {
+		manager->enqueueJob(zone, region, getStructureArea(i), settings, NavMeshManager::TileQueue);
+
+		Thread::sleep(10);
+	}
+
+	ASSERT_TRUE(manager->waitForJobs(5000));
+
+	int builds = manager->getBuildCount();
+
+	// the first placement starts a build, everything after it goes into one rebuild
+	ASSERT_GE(builds, 1);
+	EXPECT_LE(builds, 2);
+	EXPECT_EQ(manager->getBuiltAreaCount(), placements);
+
+	EXPECT_LT(manager->getBuildStart(0), (uint64) MAXLATENCY);
+
+	// the rebuild follows the first build without waiting
+	if (builds == 2)
+		EXPECT_LT(manager->getBuildStart(1), manager->getBuildStart(0) + buildTime + MAXLATENCY);
+}
+
+TEST_F(NavMeshManagerTest, PlacementAfterBuildStartsNewJob) {
+	RecordingNavMeshManager* manager = getManager();
+	Reference<NavMeshRegion*> region = createRegion("navmesh_manager_test_idle");
+
+	manager->reset(0);
+	manager->enqueueJob(zone, region, getStructureArea(0), settings, NavMeshManager::TileQueue);
+
+	ASSERT_TRUE(manager->waitForJobs(5000));
+
+	manager->reset(0);
+	manager->enqueueJob(zone, region, getStructureArea(1), settings, NavMeshManager::TileQueue);
+
+	ASSERT_TRUE(manager->waitForJobs(5000));
+
+	ASSERT_EQ(manager->getBuildCount(), 1);
+	EXPECT_LT(manager->getBuildStart(0), (uint64) MAXLATENCY);
+	EXPECT_EQ(manager->getBuiltAreaCount(), 1);
+}
+
+}
+}
+}
+}
+}
@@ -0,0 +1,183 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#include "gtest/gtest.h"
+
+#include "server/zone/managers/collision/StaticCollisionTree.h"
+#include "server/zone/objects/scene/SceneObject.h"
+
+namespace server {
+namespace zone {
+namespace managers {
+namespace collision {
+namespace test {
+
+class TestCollisionTree : public StaticCollisionTree {
+public:
+	/**
+	 * Adds object with box as its appearance bounding box
+	 */
+	void insertWithBox(SceneObject* object, const AABB& box) {
+		float min[3], max[3];
+		getInstanceBounds(object, box, min, max);
+
+		insert(object, min, max);
+	}
+};
+
+class StaticCollisionTreeTest : public ::testing::Test {
+protected:
+	TestCollisionTree tree;
+	uint64 nextObjectId;
+
+	// a 10x10 building, 8m high
+	AABB buildingBox;
+
+public:
+	StaticCollisionTreeTest() : nextObjectId(1), buildingBox(Vector3(-5, 0, -5), Vector3(5, 8, 5)) {
+	}
+
+	Reference<SceneObject*> createBuilding(float x, float z, float y) {
+		Reference<SceneObject*> object = new SceneObject();
+		object->_setObjectID(nextObjectId++);
+		object->initializePosition(x, z, y);
+
+		tree.insertWithBox(object, buildingBox);
+
+		return object;
+	}
+
+	/**
+	 * @param from world position (x, y, z up)
+	 * @param to world position (x, y, z up)
+	 */
+	int getSegmentCandidates(const Vector3& from, const Vector3& to, Vector<Reference<SceneObject*> >& objects) {
+		return tree.getSegmentCandidates(StaticCollisionTree::getTreePosition(from), StaticCollisionTree::getTreePosition(to), objects);
+	}
+
+	/**
+	 * @param origins world positions (x, y, z up)
+	 * @param end world position (x, y, z up)
+	 */
+	int getSegmentsCandidates(const Vector<Vector3>& origins, const Vector3& end, Vector<Reference<SceneObject*> >& objects) {
+		Vector<Vector3> treeOrigins;
+
+		for (int i = 0; i < origins.size(); ++i)
+			treeOrigins.add(StaticCollisionTree::getTreePosition(origins.get(i)));
+
+		return tree.getSegmentsCandidates(treeOrigins, StaticCollisionTree::getTreePosition(end), objects);
+	}
+
+	bool segmentHits(const Vector3& from, const Vector3& to, SceneObject* object) {
+		Vector<Reference<SceneObject*> > objects;
+		getSegmentCandidates(from, to, objects);
+
+		for (int i = 0; i < objects.size(); ++i) {
+			if (objects.get(i) == object)
+				return true;
+		}
+
+		return false;
+	}
+};
+
+TEST_F(StaticCollisionTreeTest, SegmentThroughObjectAwayFromOrigin) {
+	Reference<SceneObject*> building = createBuilding(3000, 20, -2000);
+
+	// rays are built from getWorldPosition with the height in z
+	EXPECT_TRUE(segmentHits(Vector3(2980, -2000, 21.5f), Vector3(3020, -2000, 21.5f), building));
+	EXPECT_TRUE(segmentHits(Vector3(3000, -2020, 25), Vector3(3000, -1980, 25), building));
+
+	// over the roof and beside it
+	EXPECT_FALSE(segmentHits(Vector3(2980, -2000, 60), Vector3(3020, -2000, 60), building));
+	EXPECT_FALSE(segmentHits(Vector3(2980, -1900, 21.5f), Vector3(3020, -1900, 21.5f), building));
+}
+
+TEST_F(StaticCollisionTreeTest, SegmentFindsEveryObjectItCrosses) {
+	Vector<Reference<SceneObject*> > buildings;
+
+	// enough objects for a deep tree, a row of them along y = -3000
+	for (int i = 0; i < 1000; ++i)
+		buildings.add(createBuilding(-4000 + i * 20, 5, -3000));
+
+	Vector<Reference<SceneObject*> > objects;
+	getSegmentCandidates(Vector3(-4100, -3000, 7), Vector3(16100, -3000, 7), objects);
+
+	EXPECT_EQ(buildings.size(), objects.size());
+
+	objects.removeAll();
+	getSegmentCandidates(Vector3(-4100, -2900, 7), Vector3(16100, -2900, 7), objects);
+
+	EXPECT_EQ(0, objects.size());
+}
+
+TEST_F(StaticCollisionTreeTest, AreaTargetsFindObstacleBetweenThem) {
+	// attackers spread west of a building, the target east of it
+	Reference<SceneObject*> building = createBuilding(-2500, 30, 3500);
+	Reference<SceneObject*> farBuilding = createBuilding(-2500, 30, 3800);
+
+	Vector<Vector3> origins;
+	origins.add(Vector3(-2530, 3490, 31.5f));
+	origins.add(Vector3(-2525, 3510, 33));
+	origins.add(Vector3(-2540, 3500, 32));
+
+	Vector<Reference<SceneObject*> > objects;
+	getSegmentsCandidates(origins, Vector3(-2470, 3500, 31.5f), objects);
+
+	ASSERT_EQ(1, objects.size());
+	EXPECT_EQ(building.get(), objects.get(0).get());
+
+	// the same rays high above the roof
+	for (int i = 0; i < origins.size(); ++i)
+		origins.get(i).setZ(origins.get(i).getZ() + 100);
+
+	objects.removeAll();
+	getSegmentsCandidates(origins, Vector3(-2470, 3500, 131.5f), objects);
+
+	EXPECT_EQ(0, objects.size());
+}
+
+TEST_F(StaticCollisionTreeTest, MovingObjectsOutsideTheTree) {
+	// no template, the zone still updates the tree for it when it moves
+	Reference<SceneObject*> object = new SceneObject();
+	object->_setObjectID(nextObjectId++);
+	object->initializePosition(100, 0, 100);
+
+	tree.insert(object);
+	tree.update(object);
+
+	EXPECT_EQ(0, tree.size());
+
+	Reference<SceneObject*> building = createBuilding(-100, 0, -100);
+
+	tree.update(object);
+	tree.update(building);
+
+	EXPECT_EQ(1, tree.size());
+}
+
+TEST_F(StaticCollisionTreeTest, ColumnAndSphereCandidates) {
+	Reference<SceneObject*> building = createBuilding(-1500, 40, 2500);
+
+	Vector<Reference<SceneObject*> > objects;
+	tree.getColumnCandidates(-1502, 2503, objects);
+
+	EXPECT_EQ(1, objects.size());
+
+	objects.removeAll();
+	tree.getSphereCandidates(StaticCollisionTree::getTreePosition(Vector3(-1500, 2500, 44)), 2, objects);
+
+	EXPECT_EQ(1, objects.size());
+
+	objects.removeAll();
+	tree.getSphereCandidates(StaticCollisionTree::getTreePosition(Vector3(-1500, 2500, 100)), 2, objects);
+
+	EXPECT_EQ(0, objects.size());
+}
+
+}
+}
+}
+}
+}
@@ -2476,6 +2476,8 @@ Reference<SortedVector<ManagedReference<TangibleObject*> >* > CombatManager::get
 			zone->getInRangeObjects(attacker->getWorldPositionX(), attacker->getWorldPositionY(), 128, &closeObjects, true);
 		}
 
+		Vector<SceneObject*> candidates(closeObjects.size(), 10);
+
 		for (int i = 0; i < closeObjects.size(); ++i) {
 			SceneObject* object = static_cast<SceneObject*>(closeObjects.get(i));
 
@@ -2516,27 +2518,25 @@ Reference<SortedVector<ManagedReference<TangibleObject*> >* > CombatManager::get
 				continue;
 			}
 
-			//			zone->runlock();
+			candidates.add(tano);
+		}
 
-			try {
-				if (!(weapon->isThrownWeapon()) && !(data.isSplashDamage()) && !(weapon->isHeavyWeapon())) {
-					if (CollisionManager::checkLineOfSight(object, attacker)) {
-						defenders->put(tano);
-					}
-				} else {
-					if (CollisionManager::checkLineOfSight(object, defenderObject)) {
-						defenders->put(tano);
-					}
-				}
-			} catch (Exception& e) {
-				error(e.getMessage());
-			} catch (...) {
-				//zone->rlock();
+		// every candidate is checked against the same end point, cast all the rays at once
+		SceneObject* lineOfSightTarget = attacker;
 
-				throw;
-			}
+		if (weapon->isThrownWeapon() || data.isSplashDamage() || weapon->isHeavyWeapon())
+			lineOfSightTarget = defenderObject;
 
-			//			zone->rlock();
+		try {
+			Vector<bool> visible;
+			CollisionManager::checkLineOfSight(candidates, lineOfSightTarget, visible);
+
+			for (int i = 0; i < candidates.size(); ++i) {
+				if (visible.get(i))
+					defenders->put(candidates.get(i)->asTangibleObject());
+			}
+		} catch (Exception& e) {
+			error(e.getMessage());
 		}
 
 		//		zone->runlock();
@@ -20,6 +20,8 @@
 #include "server/zone/objects/creature/ai/bt/ParallelSequenceBehavior.h"
 #include "server/zone/objects/creature/ai/bt/ParallelSelectorBehavior.h"
 #include "server/zone/objects/creature/ai/bt/LuaBehavior.h"
+#include "server/zone/objects/creature/ai/bt/NativeBehavior.h"
+#include "server/zone/objects/creature/ai/bt/BehaviorTree.h"
 #include "templates/params/creature/CreatureFlag.h"
 #include "server/zone/managers/creature/PetManager.h"
 #include "server/zone/objects/intangible/PetControlDevice.h"
@@ -53,6 +55,10 @@ public:
 	HashTable<unsigned int, Reference<AiTemplate*> > idles;
 	bool loaded;
 
+	// trees shared by every agent built from the same templates
+	HashTable<String, Reference<BehaviorTree*> > trees;
+	Mutex treeMutex;
+
 	AtomicInteger activeMoveEvents;
 	AtomicInteger scheduledMoveEvents;
 	AtomicInteger moveEventsWithFollowObject;
@@ -71,6 +77,7 @@ public:
 		selectAttacks.setNullValue(NULL);
 		combatMoves.setNullValue(NULL);
 		idles.setNullValue(NULL);
+		trees.setNullValue(NULL);
 
 		loaded = false;
 	}
@@ -158,12 +165,60 @@ public:
 		return getTemplate(bitMask, idles);
 	}
 
+	Reference<BehaviorTree*> getBehaviorTree(AiTemplate* aiTemplate) {
+		if (aiTemplate == NULL)
+			return NULL;
+
+		const String& key = aiTemplate->getTemplateName();
+
+		Locker locker(&treeMutex);
+
+		Reference<BehaviorTree*> tree = trees.get(key);
+
+		if (tree == NULL) {
+			tree = BehaviorTree::create(aiTemplate);
+
+			if (tree != NULL)
+				trees.put(key, tree);
+		}
+
+		return tree;
+	}
+
+	Reference<BehaviorTree*> getBehaviorTree(const String& name, AiTemplate* getTarget, AiTemplate* selectAttack, AiTemplate* combatMove, AiTemplate* idle) {
+		StringBuffer key;
+		key << name;
+
+		AiTemplate* templates[] = { getTarget, selectAttack, combatMove, idle };
+
+		for (int i = 0; i < 4; ++i)
+			key << ":" << (templates[i] == NULL ? String("none") : templates[i]->getTemplateName());
+
+		Locker locker(&treeMutex);
+
+		Reference<BehaviorTree*> tree = trees.get(key.toString());
+
+		if (tree == NULL) {
+			tree = BehaviorTree::create(name, getTarget, selectAttack, combatMove, idle);
+			trees.put(key.toString(), tree);
+		}
+
+		return tree;
+	}
+
+	int getBehaviorTreeSize() {
+		Locker locker(&treeMutex);
+
+		return trees.size();
+	}
+
 private:
 	static const bool DEBUG_MODE = false;
 
 	void registerFunctions(Lua* lua) {
 		lua_register(lua->getLuaState(), "addAiTemplate", addAiTemplate);
 		lua_register(lua->getLuaState(), "addAiBehavior", addAiBehavior);
+		lua_register(lua->getLuaState(), "addNativeAiBehavior", addNativeAiBehavior);
 		lua_register(lua->getLuaState(), "includeAiFile", includeFile);
 	}
 
@@ -301,32 +356,59 @@ private:
 		return 0;
 	}
 
+	/**
+	 * addNativeAiBehavior(className, nativeName, awareness) runs the C++ version of nativeName
+	 * for className, awareness is true if className derives from DefaultInterrupt
+	 */
+	static int addNativeAiBehavior(lua_State* L) {
+		String name = lua_tostring(L, -3);
+		String nativeName = lua_tostring(L, -2);
+		bool awareness = lua_toboolean(L, -1);
+
+		Reference<LuaBehavior*> b = NativeBehavior::create(nativeName, name, awareness);
+
+		if (b == NULL) {
+			AiMap::instance()->error("Unknown native AI behavior " + nativeName + " for " + name + ", using lua");
+
+			b = new LuaBehavior(name);
+		}
+
+		if (b->initialize()) {
+			AiMap::instance()->putBehavior(name, b);
+
+			if (DEBUG_MODE)
+				AiMap::instance()->info("Loaded native AI behavior " + name, true);
+		}
+
+		return 0;
+	}
+
 public:
-	static Behavior* createNewInstance(AiAgent* _agent, const String& _name, uint16 _type) {
+	static Behavior* createNewInstance(const String& _name, uint16 _type) {
 		Behavior* newBehavior;
 
 		switch (_type) {
 		case AiMap::SEQUENCEBEHAVIOR:
-			newBehavior = new SequenceBehavior(_agent, _name);
+			newBehavior = new SequenceBehavior(_name);
 			break;
 		case AiMap::SELECTORBEHAVIOR:
-			newBehavior = new SelectorBehavior(_agent, _name);
+			newBehavior = new SelectorBehavior(_name);
 			break;
 		case AiMap::NONDETERMINISTICSEQUENCEBEHAVIOR:
-			newBehavior = new NonDeterministicSequenceBehavior(_agent, _name);
+			newBehavior = new NonDeterministicSequenceBehavior(_name);
 			break;
 		case AiMap::NONDETERMINISTICSELECTORBEHAVIOR:
-			newBehavior = new NonDeterministicSelectorBehavior(_agent, _name);
+			newBehavior = new NonDeterministicSelectorBehavior(_name);
 			break;
 		case AiMap::PARALLELSEQUENCEBEHAVIOR:
-			newBehavior = new ParallelSequenceBehavior(_agent, _name);
+			newBehavior = new ParallelSequenceBehavior(_name);
 			break;
 		case AiMap::PARALLELSELECTORBEHAVIOR:
-			newBehavior = new ParallelSelectorBehavior(_agent, _name);
+			newBehavior = new ParallelSelectorBehavior(_name);
 			break;
 		case AiMap::BEHAVIOR:
 		default:
-			newBehavior = new Behavior(_agent, _name);
+			newBehavior = new Behavior(_name);
 			break;
 		}
 
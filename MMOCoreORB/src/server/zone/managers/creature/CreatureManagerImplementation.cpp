@@ -640,7 +640,7 @@ int CreatureManagerImplementation::notifyDestruction(TangibleObject* destructor,
 		if (playerManager != NULL)
 			playerManager->disseminateExperience(destructedObject, &copyThreatMap);
 
-		SceneObject* creatureInventory = destructedObject->getSlottedObject("inventory");
+		SceneObject* creatureInventory = destructedObject->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 		if (creatureInventory != NULL && player != NULL && player->isPlayerCreature()) {
 			LootManager* lootManager = zoneServer->getLootManager();
@@ -1032,7 +1032,7 @@ void CreatureManagerImplementation::tame(Creature* creature, CreatureObject* pla
 		return;
 	}
 
-	ManagedReference<SceneObject*> datapad = player->getSlottedObject("datapad");
+	ManagedReference<SceneObject*> datapad = player->getKnownSlottedObject(SlotIndex::DATAPAD);
 
 	if (datapad == NULL)
 		return;
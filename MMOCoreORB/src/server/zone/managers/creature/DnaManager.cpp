@@ -114,7 +114,7 @@ void DnaManager::generationalSample(PetDeed* deed, CreatureObject* player,int qu
 	int ite = reduceByPercent(deed->getIntelligence(),reductionAmount);
 	int pow = reduceByPercent(deed->getPower(),reductionAmount);
 
-	ManagedReference<SceneObject*> inventory = player->getSlottedObject("inventory");
+	ManagedReference<SceneObject*> inventory = player->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 	if (inventory->isContainerFullRecursive()) {
 		StringIdChatParameter err("survey", "no_inv_space");
@@ -196,7 +196,7 @@ void DnaManager::generateSample(Creature* creature, CreatureObject* player,int q
 	int ite = Genetics::hamToValue(creature->getMaxHAM(6),quality);
 	int pow = Genetics::damageToValue((creature->getDamageMax() + creature->getDamageMin())/2,quality);
 
-	ManagedReference<SceneObject*> inventory = player->getSlottedObject("inventory");
+	ManagedReference<SceneObject*> inventory = player->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 	if (inventory->isContainerFullRecursive()) {
 		StringIdChatParameter err("survey", "no_inv_space");
@@ -499,7 +499,7 @@ int PetManagerImplementation::notifyDestruction(TangibleObject* destructor, AiAg
 		return 1;
 
 	if (destructedObject->isMount() && destructedObject->hasRidingCreature()) {
-		Reference<CreatureObject*> rider = destructedObject->getSlottedObject("rider").castTo<CreatureObject*>();
+		Reference<CreatureObject*> rider = destructedObject->getKnownSlottedObject(SlotIndex::RIDER).castTo<CreatureObject*>();
 
 		if (rider != NULL) {
 			Locker locker(rider);
@@ -284,6 +284,8 @@ void DirectorManager::initializeLuaEngine(Lua* luaEngine) {
 	lua_register(luaEngine->getLuaState(), "readSharedMemory", readSharedMemory);
 	lua_register(luaEngine->getLuaState(), "writeSharedMemory", writeSharedMemory);
 	lua_register(luaEngine->getLuaState(), "deleteSharedMemory", deleteSharedMemory);
+	lua_register(luaEngine->getLuaState(), "incrementSharedMemory", incrementSharedMemory);
+	lua_register(luaEngine->getLuaState(), "compareAndSwapSharedMemory", compareAndSwapSharedMemory);
 	lua_register(luaEngine->getLuaState(), "readStringSharedMemory", readStringSharedMemory);
 	lua_register(luaEngine->getLuaState(), "writeStringSharedMemory", writeStringSharedMemory);
 	lua_register(luaEngine->getLuaState(), "deleteStringSharedMemory", deleteStringSharedMemory);
@@ -530,7 +532,7 @@ void DirectorManager::initializeLuaEngine(Lua* luaEngine) {
 }
 
 int DirectorManager::loadScreenPlays(Lua* luaEngine) {
-	bool res = luaEngine->runFile("scripts/screenplays/screenplays.lua");
+	bool res = runScreenPlayFile("scripts/screenplays/screenplays.lua", luaEngine->getLuaState());
 
 	if (!DEBUG_MODE)
 		info("Loaded " + String::valueOf(instance()->screenPlays.size()) + " screenplays.", true);
@@ -541,7 +543,48 @@ int DirectorManager::loadScreenPlays(Lua* luaEngine) {
 	return 0;
 }
 
+bool DirectorManager::runScreenPlayFile(const String& filename, lua_State* L) {
+	ScreenPlayChunkCache* cache = instance()->getChunkCache();
+
+	Reference<ScreenPlayChunk*> chunk = cache->get(filename);
+
+	int res = 0;
+
+	if (chunk != NULL) {
+		res = luaL_loadbufferx(L, chunk->getData(), chunk->getSize(), ("@" + filename).toCharArray(), "b");
+	} else {
+		uint32 generation = cache->getGeneration();
+
+		res = luaL_loadfile(L, filename.toCharArray());
+
+		if (res == 0) {
+			chunk = new ScreenPlayChunk();
+
+			if (lua_dump(L, ScreenPlayChunk::write, chunk.get(), 0) == 0)
+				cache->put(filename, chunk, generation);
+		}
+	}
+
+	if (res == 0)
+		res = lua_pcall(L, 0, 0, 0);
+
+	if (res != 0) {
+		const char* message = lua_tostring(L, -1);
+
+		instance()->error("running file " + filename + ": " + (message != NULL ? message : "unknown error"));
+
+		lua_pop(L, 1);
+
+		return false;
+	}
+
+	return true;
+}
+
 void DirectorManager::reloadScreenPlays() {
+	// sources are compiled again by the first state that reloads them
+	chunkCache.clear();
+
 	masterScreenPlayVersion.increment();
 }
 
@@ -563,7 +606,7 @@ int DirectorManager::writeScreenPlayData(lua_State* L) {
 		return 0;
 	}
 
-	Reference<PlayerObject*> ghost = player->getSlottedObject("ghost").castTo<PlayerObject*>();
+	Reference<PlayerObject*> ghost = player->getKnownSlottedObject(SlotIndex::GHOST).castTo<PlayerObject*>();
 
 	if (ghost == NULL) {
 		DirectorManager::instance()->error("Attempted to write screen play data for a null ghost in screen play: " + screenPlay + ".");
@@ -686,7 +729,7 @@ int DirectorManager::readScreenPlayData(lua_State* L) {
 		return 1;
 	}
 
-	Reference<PlayerObject*> ghost = player->getSlottedObject("ghost").castTo<PlayerObject*>();
+	Reference<PlayerObject*> ghost = player->getKnownSlottedObject(SlotIndex::GHOST).castTo<PlayerObject*>();
 
 	if (ghost == NULL) {
 		DirectorManager::instance()->error("Attempted to read screen play data for a null ghost in screen play: " + screenPlay + ".");
@@ -719,7 +762,7 @@ int DirectorManager::deleteScreenPlayData(lua_State* L) {
 		return 0;
 	}
 
-	Reference<PlayerObject*> ghost = player->getSlottedObject("ghost").castTo<PlayerObject*>();
+	Reference<PlayerObject*> ghost = player->getKnownSlottedObject(SlotIndex::GHOST).castTo<PlayerObject*>();
 
 	if (ghost == NULL) {
 		DirectorManager::instance()->error("Attempted to delete screen play data for a null ghost in screen play: " + screenPlay + ".");
@@ -746,7 +789,7 @@ int DirectorManager::clearScreenPlayData(lua_State* L) {
 		return 0;
 	}
 
-	Reference<PlayerObject*> ghost = player->getSlottedObject("ghost").castTo<PlayerObject*>();
+	Reference<PlayerObject*> ghost = player->getKnownSlottedObject(SlotIndex::GHOST).castTo<PlayerObject*>();
 
 	if (ghost == NULL) {
 		DirectorManager::instance()->error("Attempted to clear screen play data for a null ghost in screen play: " + screenPlay + ".");
@@ -813,7 +856,7 @@ int DirectorManager::includeFile(lua_State* L) {
 
 	int oldError = ERROR_CODE;
 
-	bool ret = Lua::runFile("scripts/screenplays/" + filename, L);
+	bool ret = runScreenPlayFile("scripts/screenplays/" + filename, L);
 
 	if (!ret) {
 		ERROR_CODE = GENERAL_ERROR;
@@ -835,16 +878,8 @@ int DirectorManager::readSharedMemory(lua_State* L) {
 
 	String key = Lua::getStringParameter(L);
 
-#ifndef WITH_STM
-	DirectorManager::instance()->rlock();
-#endif
-
 	uint64 data = DirectorManager::instance()->sharedMemory->get(key);
 
-#ifndef WITH_STM
-	DirectorManager::instance()->runlock();
-#endif
-
 	lua_pushinteger(L, data);
 
 	return 1;
@@ -859,16 +894,8 @@ int DirectorManager::deleteSharedMemory(lua_State* L) {
 
 	String key = Lua::getStringParameter(L);
 
-#ifndef WITH_STM
-	DirectorManager::instance()->wlock();
-#endif
-
 	DirectorManager::instance()->sharedMemory->remove(key);
 
-#ifndef WITH_STM
-	DirectorManager::instance()->unlock();
-#endif
-
 	return 0;
 }
 
@@ -882,20 +909,45 @@ int DirectorManager::writeSharedMemory(lua_State* L) {
 	String key = lua_tostring(L, -2);
 	uint64 data = lua_tointeger(L, -1);
 
-#ifndef WITH_STM
-	DirectorManager::instance()->wlock();
-#endif
-
 	DirectorManager::instance()->sharedMemory->put(key, data);
 
-#ifndef WITH_STM
-	DirectorManager::instance()->unlock();
-#endif
-
 	return 0;
 }
 
+int DirectorManager::incrementSharedMemory(lua_State* L) {
+	if (checkArgumentCount(L, 2) == 1) {
+		instance()->error("incorrect number of arguments passed to DirectorManager::incrementSharedMemory");
+		ERROR_CODE = INCORRECT_ARGUMENTS;
+		return 0;
+	}
+
+	String key = lua_tostring(L, -2);
+	int64 delta = lua_tointeger(L, -1);
+
+	uint64 data = DirectorManager::instance()->sharedMemory->increment(key, delta);
+
+	lua_pushinteger(L, data);
+
+	return 1;
+}
 
+int DirectorManager::compareAndSwapSharedMemory(lua_State* L) {
+	if (checkArgumentCount(L, 3) == 1) {
+		instance()->error("incorrect number of arguments passed to DirectorManager::compareAndSwapSharedMemory");
+		ERROR_CODE = INCORRECT_ARGUMENTS;
+		return 0;
+	}
+
+	String key = lua_tostring(L, -3);
+	uint64 expected = lua_tointeger(L, -2);
+	uint64 data = lua_tointeger(L, -1);
+
+	bool swapped = DirectorManager::instance()->sharedMemory->compareAndSet(key, expected, data);
+
+	lua_pushboolean(L, swapped);
+
+	return 1;
+}
 
 int DirectorManager::readStringSharedMemory(lua_State* L) {
 	if (checkArgumentCount(L, 1) == 1) {
@@ -906,16 +958,8 @@ int DirectorManager::readStringSharedMemory(lua_State* L) {
 
 	String key = Lua::getStringParameter(L);
 
-#ifndef WITH_STM
-	DirectorManager::instance()->rlock();
-#endif
-
 	String data = DirectorManager::instance()->sharedMemory->getString(key);
 
-#ifndef WITH_STM
-	DirectorManager::instance()->runlock();
-#endif
-
 	lua_pushstring(L, data.toCharArray());
 
 	return 1;
@@ -930,16 +974,8 @@ int DirectorManager::deleteStringSharedMemory(lua_State* L) {
 
 	String key = Lua::getStringParameter(L);
 
-#ifndef WITH_STM
-	DirectorManager::instance()->wlock();
-#endif
-
 	DirectorManager::instance()->sharedMemory->removeString(key);
 
-#ifndef WITH_STM
-	DirectorManager::instance()->unlock();
-#endif
-
 	return 0;
 }
 
@@ -953,16 +989,8 @@ int DirectorManager::writeStringSharedMemory(lua_State* L) {
 	String key = lua_tostring(L, -2);
 	String data = lua_tostring(L, -1);
 
-#ifndef WITH_STM
-	DirectorManager::instance()->wlock();
-#endif
-
 	DirectorManager::instance()->sharedMemory->putString(key, data);
 
-#ifndef WITH_STM
-	DirectorManager::instance()->unlock();
-#endif
-
 	return 0;
 }
 
@@ -2752,7 +2780,7 @@ int DirectorManager::getSpawnArea(lua_State* L) {
 		int y0 = position.getY() - areaSize;
 		int y1 = position.getY() + areaSize;
 
-		found = zone->getPlanetManager()->getTerrainManager()->getHighestHeightDifference(x0, y0, x1, y1) <= maximumHeightDifference;
+		found = zone->getPlanetManager()->getTerrainManager()->isHeightDifferenceWithin(x0, y0, x1, y1, maximumHeightDifference);
 		retries--;
 	}
 
@@ -2764,7 +2792,7 @@ int DirectorManager::getSpawnArea(lua_State* L) {
 		int y0 = position.getY() - areaSize;
 		int y1 = position.getY() + areaSize;
 
-		found = zone->getPlanetManager()->getTerrainManager()->getHighestHeightDifference(x0, y0, x1, y1) <= maximumHeightDifference;
+		found = zone->getPlanetManager()->getTerrainManager()->isHeightDifferenceWithin(x0, y0, x1, y1, maximumHeightDifference);
 	}
 
 	if (found) {
@@ -10,6 +10,7 @@
 
 #include "engine/engine.h"
 #include "DirectorSharedMemory.h"
+#include "ScreenPlayChunkCache.h"
 #include "server/zone/managers/director/QuestStatus.h"
 #include "server/zone/managers/director/QuestVectorMap.h"
 
@@ -56,6 +57,7 @@ namespace server {
 		ThreadLocal<Lua*> localLua;
 		ThreadLocal<uint32*> localScreenPlayVersion;
 		AtomicInteger masterScreenPlayVersion;
+		ScreenPlayChunkCache chunkCache;
 		VectorMap<String, bool> screenPlays;
 		SynchronizedVectorMap<String, Reference<QuestStatus*> > questStatuses;
 		SynchronizedVectorMap<String, Reference<QuestVectorMap*> > questVectorMaps;
@@ -102,6 +104,10 @@ namespace server {
 		virtual Lua* getLuaInstance();
 		int runScreenPlays();
 
+		ScreenPlayChunkCache* getChunkCache() {
+			return &chunkCache;
+		}
+
 		static int writeScreenPlayData(lua_State* L);
 		static int readScreenPlayData(lua_State* L);
 		static int deleteScreenPlayData(lua_State* L);
@@ -134,6 +140,8 @@ namespace server {
 		static int readSharedMemory(lua_State* L);
 		static int writeSharedMemory(lua_State* L);
 		static int deleteSharedMemory(lua_State* L);
+		static int incrementSharedMemory(lua_State* L);
+		static int compareAndSwapSharedMemory(lua_State* L);
 		static int readStringSharedMemory(lua_State* L);
 		static int writeStringSharedMemory(lua_State* L);
 		static int deleteStringSharedMemory(lua_State* L);
@@ -193,6 +201,7 @@ namespace server {
 		void setupLuaPackagePath(Lua* luaEngine);
 		void initializeLuaEngine(Lua* luaEngine);
 		int loadScreenPlays(Lua* luaEngine);
+		static bool runScreenPlayFile(const String& filename, lua_State* L);
 		void loadJediManager(Lua* luaEngine);
 		static Vector3 generateSpawnPoint(String zoneName, float x, float y, float minimumDistance, float maximumDistance, float extraNoBuildRadius, float sphereCollision, bool forceSpawn = false);
 
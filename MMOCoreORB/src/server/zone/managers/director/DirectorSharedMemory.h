@@ -10,37 +10,130 @@
 
 #include "engine/engine.h"
 
+/**
+ * Screenplay data shared by every Lua state. Keys are spread over shards by
+ * hash, each shard with a lock of its own, so writers of different keys
+ * rarely meet and readers never wait on each other.
+ */
 class DirectorSharedMemory : public Object {
-	HashTable<String, uint64> hashTable;
-	HashTable<String, String> stringTable;
+public:
+	const static int SHARDS = 32;
+
+protected:
+	class Shard {
+	public:
+		HashTable<String, uint64> hashTable;
+		HashTable<String, String> stringTable;
+
+		ReadWriteLock lock;
+	};
+
+	Shard shards[SHARDS];
+
+	inline Shard& getShard(const String& k) {
+		// not the low bits, the tables of the shard bucket by those
+		return shards[((uint32) k.hashCode() >> 16) % SHARDS];
+	}
 
 public:
+	DirectorSharedMemory() {
+	}
+
+	DirectorSharedMemory(const DirectorSharedMemory& memory) : Object() {
+		for (int i = 0; i < SHARDS; ++i) {
+			Shard& shard = const_cast<DirectorSharedMemory&>(memory).shards[i];
+
+			ReadLocker locker(&shard.lock);
+
+			shards[i].hashTable = shard.hashTable;
+			shards[i].stringTable = shard.stringTable;
+		}
+	}
+
 	uint64 get(const String& k) {
-		return hashTable.get(k);
+		Shard& shard = getShard(k);
+
+		ReadLocker locker(&shard.lock);
+
+		return shard.hashTable.get(k);
 	}
 
 	String getString(const String& k) {
-		return stringTable.get(k);
+		Shard& shard = getShard(k);
+
+		ReadLocker locker(&shard.lock);
+
+		return shard.stringTable.get(k);
 	}
 
 	void put(const String& k, uint64 v) {
-		hashTable.put(k, v);
+		Shard& shard = getShard(k);
+
+		Locker locker(&shard.lock);
+
+		shard.hashTable.put(k, v);
 	}
 
 	void putString(const String& k, const String& v) {
-		stringTable.put(k, v);
+		Shard& shard = getShard(k);
+
+		Locker locker(&shard.lock);
+
+		shard.stringTable.put(k, v);
+	}
+
+	/**
+	 * Adds delta to the value of k in one step
+	 * @return the new value
+	 */
+	uint64 increment(const String& k, int64 delta) {
+		Shard& shard = getShard(k);
+
+		Locker locker(&shard.lock);
+
+		uint64 v = shard.hashTable.get(k) + delta;
+
+		shard.hashTable.put(k, v);
+
+		return v;
+	}
+
+	/**
+	 * Sets k to v if it still holds expected
+	 * @return true if k was set
+	 */
+	bool compareAndSet(const String& k, uint64 expected, uint64 v) {
+		Shard& shard = getShard(k);
+
+		Locker locker(&shard.lock);
+
+		if (shard.hashTable.get(k) != expected)
+			return false;
+
+		shard.hashTable.put(k, v);
+
+		return true;
 	}
 
 	void remove(const String& k) {
-		hashTable.remove(k);
+		Shard& shard = getShard(k);
+
+		Locker locker(&shard.lock);
+
+		shard.hashTable.remove(k);
 	}
 
 	void removeString(const String& k) {
-		stringTable.remove(k);
+		Shard& shard = getShard(k);
+
+		Locker locker(&shard.lock);
+
+		shard.stringTable.remove(k);
 	}
 
 	void setNullValue(uint64 o) {
-		hashTable.setNullValue(o);
+		for (int i = 0; i < SHARDS; ++i)
+			shards[i].hashTable.setNullValue(o);
 	}
 
 	Object* clone() {
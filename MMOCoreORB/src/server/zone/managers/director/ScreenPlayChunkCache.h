@@ -0,0 +1,132 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#ifndef SCREENPLAYCHUNKCACHE_H_
+#define SCREENPLAYCHUNKCACHE_H_
+
+#include "engine/engine.h"
+
+/**
+ * Compiled bytecode of one screenplay file as lua_dump writes it. Never
+ * changed after it is cached, so every Lua state can load from it at once.
+ */
+class ScreenPlayChunk : public Object {
+	char* data;
+	size_t size;
+	size_t capacity;
+
+public:
+	ScreenPlayChunk() : data(NULL), size(0), capacity(0) {
+	}
+
+	~ScreenPlayChunk() {
+		free(data);
+	}
+
+	/**
+	 * lua_Writer appending to the ScreenPlayChunk in userData
+	 */
+	static int write(lua_State* L, const void* buffer, size_t length, void* userData) {
+		ScreenPlayChunk* chunk = static_cast<ScreenPlayChunk*>(userData);
+
+		if (chunk->size + length > chunk->capacity) {
+			size_t newCapacity = MAX(chunk->capacity * 2, chunk->size + length);
+			char* newData = static_cast<char*>(realloc(chunk->data, newCapacity));
+
+			if (newData == NULL)
+				return 1;
+
+			chunk->data = newData;
+			chunk->capacity = newCapacity;
+		}
+
+		memcpy(chunk->data + chunk->size, buffer, length);
+		chunk->size += length;
+
+		return 0;
+	}
+
+	inline const char* getData() const {
+		return data;
+	}
+
+	inline size_t getSize() const {
+		return size;
+	}
+};
+
+/**
+ * Screenplay files compiled once and shared by the Lua states of every
+ * thread. Clearing the cache starts a new generation, chunks compiled from
+ * sources read before that are not taken in.
+ */
+class ScreenPlayChunkCache : public Object {
+	HashTable<String, Reference<ScreenPlayChunk*> > chunks;
+
+	uint32 generation;
+
+	ReadWriteLock lock;
+
+	AtomicInteger hits;
+	AtomicInteger compiles;
+
+public:
+	ScreenPlayChunkCache() : generation(0) {
+		chunks.setNullValue(NULL);
+	}
+
+	Reference<ScreenPlayChunk*> get(const String& filename) {
+		ReadLocker locker(&lock);
+
+		Reference<ScreenPlayChunk*> chunk = chunks.get(filename);
+
+		if (chunk != NULL)
+			hits.increment();
+
+		return chunk;
+	}
+
+	/**
+	 * @return the generation to hand to put for a file read from now on
+	 */
+	uint32 getGeneration() {
+		ReadLocker locker(&lock);
+
+		return generation;
+	}
+
+	void put(const String& filename, ScreenPlayChunk* chunk, uint32 sourceGeneration) {
+		Locker locker(&lock);
+
+		compiles.increment();
+
+		if (sourceGeneration != generation)
+			return;
+
+		chunks.put(filename, chunk);
+	}
+
+	void clear() {
+		Locker locker(&lock);
+
+		chunks.removeAll();
+		++generation;
+	}
+
+	int size() {
+		ReadLocker locker(&lock);
+
+		return chunks.size();
+	}
+
+	inline int getHits() {
+		return hits.get();
+	}
+
+	inline int getCompiles() {
+		return compiles.get();
+	}
+};
+
+#endif /* SCREENPLAYCHUNKCACHE_H_ */
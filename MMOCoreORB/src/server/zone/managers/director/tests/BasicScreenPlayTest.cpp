@@ -0,0 +1,107 @@
+/*
+ * BasicScreenPlayTest.cpp
+ *
+ *  Created on: Aug 10, 2013
+ *      Author: TheAnswer
+ */
+
+#ifndef BASICSCREENPLAYTEST_CPP_
+#define BASICSCREENPLAYTEST_CPP_
+
+#include "gtest/gtest.h"
+#include "server/zone/managers/director/DirectorManager.h"
+#include "conf/ConfigManager.h"
+
+/**
+ * Sets up the Lua state of a fresh thread and times it
+ */
+class LuaInstanceThread : public Thread {
+	uint64 initTime;
+
+public:
+	LuaInstanceThread() : initTime(0) {
+	}
+
+	void run() {
+		Time start;
+
+		DirectorManager::instance()->getLuaInstance();
+
+		initTime = start.miliDifference();
+	}
+
+	uint64 getInitTime() const {
+		return initTime;
+	}
+};
+
+class BasicScreenPlayTest : public ::testing::Test {
+public:
+
+	BasicScreenPlayTest() {
+		// Perform creation setup here.
+		ConfigManager::instance()->loadConfigData();
+	}
+
+	~BasicScreenPlayTest() {
+		// Clean up.
+	}
+
+	void SetUp() {
+		// Perform setup of common constructs here.
+	}
+
+	void TearDown() {
+		// Perform clean up of common constructs here.
+	}
+};
+
+TEST_F(BasicScreenPlayTest, ScreenPlayLuaInitialize) {
+	DirectorManager::DEBUG_MODE = 1;
+
+	lua_State* L = DirectorManager::instance()->getLuaInstance()->getLuaState();
+
+	ASSERT_EQ(*lua_version(L), 503) << "Wrong version of Lua Installed: " << *lua_version(L) << ". Required version: " << 503;
+	EXPECT_EQ(DirectorManager::instance()->runScreenPlays(), 0);
+}
+
+TEST_F(BasicScreenPlayTest, ScreenPlayChunkCache) {
+	DirectorManager::DEBUG_MODE = 1;
+
+	DirectorManager* director = DirectorManager::instance();
+	ScreenPlayChunkCache* cache = director->getChunkCache();
+
+	director->getLuaInstance();
+
+	// the first thread after a reload compiles the sources
+	director->reloadScreenPlays();
+
+	LuaInstanceThread coldThread;
+	coldThread.start();
+	coldThread.join();
+
+	int compiles = cache->getCompiles();
+
+	ASSERT_GT(cache->size(), 0);
+
+	// the others only load bytecode
+	LuaInstanceThread warmThread;
+	warmThread.start();
+	warmThread.join();
+
+	EXPECT_EQ(cache->getCompiles(), compiles);
+
+	director->reloadScreenPlays();
+
+	EXPECT_EQ(cache->size(), 0);
+
+	Time reloadStart;
+	director->getLuaInstance();
+	uint64 reloadTime = reloadStart.miliDifference();
+
+	RecordProperty("cold_thread_init_ms", (int) coldThread.getInitTime());
+	RecordProperty("warm_thread_init_ms", (int) warmThread.getInitTime());
+	RecordProperty("reload_ms", (int) reloadTime);
+}
+
+#endif /* BASICSCREENPLAYTEST_CPP_ */
@@ -0,0 +1,179 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#include "gtest/gtest.h"
+
+#include "server/zone/managers/director/DirectorSharedMemory.h"
+
+static const int THREADS = 8;
+static const int OPERATIONS = 100000;
+
+// keys every thread writes, the rest of the keys belong to one thread
+static const int SHAREDKEYS = 4;
+
+/**
+ * Runs the mix screenplays put on the shared memory, mostly reads of their
+ * own keys with writes and counter increments in between
+ */
+class SharedMemoryThread : public Thread {
+protected:
+	int id;
+	bool useCompareAndSet;
+
+	DirectorSharedMemory* memory;
+
+	// old scheme, every access under one lock
+	ReadWriteLock* globalLock;
+
+public:
+	SharedMemoryThread(int id, DirectorSharedMemory* memory, ReadWriteLock* globalLock, bool useCompareAndSet)
+		: id(id), useCompareAndSet(useCompareAndSet), memory(memory), globalLock(globalLock) {
+	}
+
+	void run() {
+		String ownKey = "thread:" + String::valueOf(id);
+
+		for (int i = 0; i < OPERATIONS; ++i) {
+			String sharedKey = "counter:" + String::valueOf(i % SHAREDKEYS);
+
+			switch (i % 8) {
+			case 0:
+				if (useCompareAndSet) {
+					uint64 current;
+
+					do {
+						current = memory->get(sharedKey);
+					} while (!memory->compareAndSet(sharedKey, current, current + 1));
+				} else if (globalLock != NULL) {
+					Locker locker(globalLock);
+
+					memory->increment(sharedKey, 1);
+				} else {
+					memory->increment(sharedKey, 1);
+				}
+				break;
+			case 1:
+				writeValue(ownKey + ":" + String::valueOf(i % 64), i);
+				break;
+			default:
+				readValue(ownKey + ":" + String::valueOf(i % 64));
+				break;
+			}
+		}
+	}
+
+	void writeValue(const String& key, uint64 value) {
+		if (globalLock != NULL) {
+			Locker locker(globalLock);
+
+			memory->put(key, value);
+		} else {
+			memory->put(key, value);
+		}
+	}
+
+	uint64 readValue(const String& key) {
+		if (globalLock != NULL) {
+			ReadLocker locker(globalLock);
+
+			return memory->get(key);
+		}
+
+		return memory->get(key);
+	}
+};
+
+class DirectorSharedMemoryTest : public ::testing::Test {
+public:
+	uint64 runThreads(DirectorSharedMemory* memory, ReadWriteLock* globalLock, bool useCompareAndSet) {
+		Vector<SharedMemoryThread*> threads;
+
+		Time start;
+
+		for (int i = 0; i < THREADS; ++i) {
+			SharedMemoryThread* thread = new SharedMemoryThread(i, memory, globalLock, useCompareAndSet);
+			thread->start();
+
+			threads.add(thread);
+		}
+
+		for (int i = 0; i < THREADS; ++i)
+			threads.get(i)->join();
+
+		uint64 time = start.miliDifference();
+
+		for (int i = 0; i < THREADS; ++i)
+			delete threads.get(i);
+
+		return time;
+	}
+
+	uint64 getCounterTotal(DirectorSharedMemory* memory) {
+		uint64 total = 0;
+
+		for (int i = 0; i < SHAREDKEYS; ++i)
+			total += memory->get("counter:" + String::valueOf(i));
+
+		return total;
+	}
+};
+
+TEST_F(DirectorSharedMemoryTest, IncrementAndCompareAndSet) {
+	DirectorSharedMemory memory;
+	memory.setNullValue(0);
+
+	EXPECT_EQ(5u, memory.increment("key", 5));
+	EXPECT_EQ(3u, memory.increment("key", -2));
+
+	EXPECT_FALSE(memory.compareAndSet("key", 5, 7));
+	EXPECT_EQ(3u, memory.get("key"));
+
+	EXPECT_TRUE(memory.compareAndSet("key", 3, 7));
+	EXPECT_EQ(7u, memory.get("key"));
+
+	EXPECT_TRUE(memory.compareAndSet("missing", 0, 1));
+	EXPECT_EQ(1u, memory.get("missing"));
+
+	memory.putString("string", "value");
+	EXPECT_EQ(String("value"), memory.getString("string"));
+
+	memory.removeString("string");
+	memory.remove("key");
+
+	EXPECT_EQ(String(""), memory.getString("string"));
+	EXPECT_EQ(0u, memory.get("key"));
+}
+
+TEST_F(DirectorSharedMemoryTest, ConcurrentThroughput) {
+	uint64 increments = (uint64) THREADS * ((OPERATIONS + 7) / 8);
+
+	DirectorSharedMemory globalMemory;
+	globalMemory.setNullValue(0);
+	ReadWriteLock globalLock;
+
+	uint64 globalTime = runThreads(&globalMemory, &globalLock, false);
+
+	EXPECT_EQ(increments, getCounterTotal(&globalMemory));
+
+	DirectorSharedMemory shardedMemory;
+	shardedMemory.setNullValue(0);
+
+	uint64 shardedTime = runThreads(&shardedMemory, NULL, false);
+
+	EXPECT_EQ(increments, getCounterTotal(&shardedMemory));
+
+	DirectorSharedMemory casMemory;
+	casMemory.setNullValue(0);
+
+	uint64 casTime = runThreads(&casMemory, NULL, true);
+
+	EXPECT_EQ(increments, getCounterTotal(&casMemory));
+
+	uint64 operations = (uint64) THREADS * OPERATIONS;
+
+	RecordProperty("global_lock_ms", (int) globalTime);
+	RecordProperty("sharded_ms", (int) shardedTime);
+	RecordProperty("sharded_cas_ms", (int) casTime);
+	RecordProperty("sharded_ops_per_ms", (int) (operations / MAX(shardedTime, (uint64) 1)));
+}
@@ -1947,7 +1947,7 @@ void GCWManagerImplementation::sendSelectDeedToDonate(BuildingObject* building,
 	if (ghost->hasSuiBoxWindowType(SuiWindowType::HQ_TERMINAL))
 		ghost->closeSuiWindowType(SuiWindowType::HQ_TERMINAL);
 
-	ManagedReference<SceneObject*> inv = creature->getSlottedObject("inventory");
+	ManagedReference<SceneObject*> inv = creature->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 	if (inv == NULL)
 		return;
@@ -2406,7 +2406,7 @@ void GCWManagerImplementation::generateTurretControlBoxTo(CreatureObject* creatu
 	if (ghost == NULL)
 		return;
 
-	Reference<WeaponObject*> weapon = turret->getSlottedObject("hold_r").castTo<WeaponObject*>();
+	Reference<WeaponObject*> weapon = turret->getKnownSlottedObject(SlotIndex::HOLD_R).castTo<WeaponObject*>();
 
 	if (weapon == NULL)
 		return;
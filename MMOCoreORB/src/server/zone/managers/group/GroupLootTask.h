@@ -36,7 +36,7 @@ public:
 		Locker gclocker(group, corpse);
 
 		//Get the corpse's inventory.
-		SceneObject* lootContainer = corpse->getSlottedObject("inventory");
+		SceneObject* lootContainer = corpse->getKnownSlottedObject(SlotIndex::INVENTORY);
 		if (lootContainer == NULL)
 			return;
 
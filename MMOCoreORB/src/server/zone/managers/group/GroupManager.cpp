@@ -187,7 +187,7 @@ void GroupManager::joinGroup(CreatureObject* player) {
 		}
 
 		// clear invitee's LFG setting once a group is joined
-		Reference<PlayerObject*> ghost = player->getSlottedObject("ghost").castTo<PlayerObject*>();
+		Reference<PlayerObject*> ghost = player->getKnownSlottedObject(SlotIndex::GHOST).castTo<PlayerObject*>();
 		if (ghost != NULL)
 			ghost->clearCharacterBit(PlayerObject::LFG, true);
 
@@ -246,7 +246,7 @@ GroupObject* GroupManager::createGroup(CreatureObject* leader) {
 	leader->sendSystemMessage("@group:formed_self");
 
 	// clear inviter's LFG setting once a group is created
-	Reference<PlayerObject*> ghost = leader->getSlottedObject("ghost").castTo<PlayerObject*>();
+	Reference<PlayerObject*> ghost = leader->getKnownSlottedObject(SlotIndex::GHOST).castTo<PlayerObject*>();
 	if (ghost != NULL)
 		ghost->clearCharacterBit(PlayerObject::LFG, true);
 
@@ -708,7 +708,7 @@ void GroupManager::makeLeader(GroupObject* group, CreatureObject* player, Creatu
 		corpse->addActiveSession(SessionFacadeType::LOOTLOTTERY, session);
 
 		//Get the corpse's inventory.
-		SceneObject* lootContainer = corpse->getSlottedObject("inventory");
+		SceneObject* lootContainer = corpse->getKnownSlottedObject(SlotIndex::INVENTORY);
 		if (lootContainer == NULL)
 			return;
 
@@ -758,7 +758,7 @@ void GroupManager::makeLeader(GroupObject* group, CreatureObject* player, Creatu
 		Locker glocker(group, corpse);
 
 		//Get the corpse's inventory.
-		SceneObject* lootContainer = corpse->getSlottedObject("inventory");
+		SceneObject* lootContainer = corpse->getKnownSlottedObject(SlotIndex::INVENTORY);
 		if (lootContainer == NULL)
 			return;
 		int totalItems = lootContainer->getContainerObjectsSize();
@@ -832,7 +832,7 @@ void GroupManager::makeLeader(GroupObject* group, CreatureObject* player, Creatu
 		itemPerms->setDenyPermission("player", ContainerPermissions::MOVECONTAINER);
 
 		//Transfer the item to the winner.
-		SceneObject* winnerInventory = winner->getSlottedObject("inventory");
+		SceneObject* winnerInventory = winner->getKnownSlottedObject(SlotIndex::INVENTORY);
 		if (winnerInventory == NULL)
 			return;
 
@@ -678,7 +678,7 @@ FishingPoleObject* FishingManagerImplementation::getPole(CreatureObject* player)
 	if (player == NULL)
 		return NULL;
 
-	SceneObject* pole = player->getSlottedObject("hold_r");
+	SceneObject* pole = player->getKnownSlottedObject(SlotIndex::HOLD_R);
 
 	if (pole != NULL) {
 		if (pole->isFishingPoleObject()) {
@@ -945,7 +945,7 @@ bool FishingManagerImplementation::loseBait(CreatureObject* player) {
 	if (player == NULL)
 		return false;
 
-	ManagedReference<SceneObject*> pole = player->getSlottedObject("hold_r");
+	ManagedReference<SceneObject*> pole = player->getKnownSlottedObject(SlotIndex::HOLD_R);
 
 	if (pole != NULL) {
 		if (pole->isFishingPoleObject() && pole->isContainerFull()) {
@@ -213,7 +213,7 @@ bool ForageManagerImplementation::forageGiveItems(CreatureObject* player, int fo
 	Locker playerLocker(player);
 
 	ManagedReference<LootManager*> lootManager = player->getZoneServer()->getLootManager();
-	ManagedReference<SceneObject*> inventory = player->getSlottedObject("inventory");
+	ManagedReference<SceneObject*> inventory = player->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 	if (lootManager == NULL || inventory == NULL) {
 		player->sendSystemMessage("@skl_use:sys_forage_fail");
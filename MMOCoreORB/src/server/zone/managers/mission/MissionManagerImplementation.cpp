@@ -25,6 +25,8 @@
 #include "templates/manager/TemplateManager.h"
 #include "server/zone/managers/planet/PlanetManager.h"
 #include "server/zone/managers/planet/MissionTargetMap.h"
+#include "server/zone/managers/planet/MissionLocationPool.h"
+#include "server/zone/managers/planet/BuildabilityMap.h"
 #include "server/zone/managers/player/PlayerManager.h"
 #include "server/zone/managers/name/NameManager.h"
 #include "server/zone/managers/creature/CreatureManager.h"
@@ -107,6 +109,11 @@ void MissionManagerImplementation::loadLuaSettings() {
 	}
 }
 
+void MissionManagerImplementation::initializeLocationQueue() {
+	// the checks touch the terrain and the zone trees, keep them off the terminal requests
+	Core::getTaskManager()->initializeCustomQueue("MissionLocations", 1);
+}
+
 void MissionManagerImplementation::handleMissionListRequest(MissionTerminal* missionTerminal, CreatureObject* player, int counter) {
 	// newbie and statue terminals don't exist, but their templates do
 	if (missionTerminal->isStatueTerminal() || missionTerminal->isNewbieTerminal()) {
@@ -184,7 +191,7 @@ void MissionManagerImplementation::handleMissionAccept(MissionTerminal* missionT
 	if (playerMissionBag != missionBag)
 		return;
 
-	SceneObject* datapad = player->getSlottedObject("datapad");
+	SceneObject* datapad = player->getKnownSlottedObject(SlotIndex::DATAPAD);
 
 	if (mission->getParent().get() == datapad)
 		return;
@@ -259,7 +266,7 @@ void MissionManagerImplementation::createDeliverMissionObjectives(MissionObject*
 
 void MissionManagerImplementation::createCraftingMissionObjectives(MissionObject* mission, MissionTerminal* missionTerminal, CreatureObject* player) {
 	//Check if player already got an crafting mission and what item it uses.
-	SceneObject* datapad = player->getSlottedObject("datapad");
+	SceneObject* datapad = player->getKnownSlottedObject(SlotIndex::DATAPAD);
 
 	if (datapad == NULL) {
 		return;
@@ -405,7 +412,7 @@ void MissionManagerImplementation::removeMission(MissionObject* mission, Creatur
 	ManagedReference<MissionObject*> ref = mission;
 
 	ManagedReference<SceneObject*> missionParent = mission->getParent();
-	SceneObject* datapad = player->getSlottedObject("datapad");
+	SceneObject* datapad = player->getKnownSlottedObject(SlotIndex::DATAPAD);
 
 	if (missionParent != datapad)
 		return;
@@ -644,40 +651,9 @@ void MissionManagerImplementation::randomizeGenericDestroyMission(CreatureObject
 
 	mission->setMissionNumber(randTexts);
 
-	TerrainManager* terrain = zone->getPlanetManager()->getTerrainManager();
-
 	Vector3 startPos;
 
-	bool foundPosition = false;
-	int maximumNumberOfTries = 20;
-	while (!foundPosition && maximumNumberOfTries-- > 0) {
-		foundPosition = true;
-
-		startPos = player->getWorldCoordinate(System::random(1000) + 1000, (float)System::random(360), false);
-
-		if (zone->isWithinBoundaries(startPos)) {
-			float height = zone->getHeight(startPos.getX(), startPos.getY());
-			float waterHeight = height * 2;
-			bool result = terrain->getWaterHeight(startPos.getX(), startPos.getY(), waterHeight);
-
-			if (!result || waterHeight <= height) {
-				//Check that the position is outside cities.
-				SortedVector<ManagedReference<ActiveArea* > > activeAreas;
-				zone->getInRangeActiveAreas(startPos.getX(), startPos.getY(), &activeAreas, true);
-				for (int i = 0; i < activeAreas.size(); ++i) {
-					if (activeAreas.get(i)->isMunicipalZone()) {
-						foundPosition = false;
-					}
-				}
-			} else {
-				foundPosition = false;
-			}
-		} else {
-			foundPosition = false;
-		}
-	}
-
-	if (!foundPosition) {
+	if (!getMissionLocation(player, MissionLocationPool::DESTROYRING, startPos)) {
 		return;
 	}
 
@@ -736,6 +712,117 @@ void MissionManagerImplementation::randomizeGenericDestroyMission(CreatureObject
 	mission->setTypeCRC(MissionTypes::DESTROY);
 }
 
+bool MissionManagerImplementation::getMissionLocation(CreatureObject* player, int ring, Vector3& location) {
+	Zone* zone = player->getZone();
+
+	if (zone == NULL)
+		return false;
+
+	ManagedReference<PlanetManager*> planetManager = zone->getPlanetManager();
+	MissionLocationPool* locations = planetManager->getMissionLocations();
+
+	Vector3 origin = player->getWorldPosition();
+	bool refill = false;
+
+	bool found = locations->take(ring, origin, zone->getBuildabilityMap(), location, refill);
+
+	if (refill) {
+		ManagedReference<MissionManager*> missionManager = _this.getReferenceUnsafeStaticCast();
+		ManagedReference<Zone*> refillZone = zone;
+
+		Core::getTaskManager()->executeTask([missionManager, refillZone, ring, origin] {
+			missionManager->refillMissionLocations(refillZone, ring, origin);
+		}, "RefillMissionLocations", "MissionLocations");
+	}
+
+	if (found)
+		return true;
+
+	// nothing pooled around here yet
+	float minDistance = MissionLocationPool::getMinDistance(ring);
+	float maxDistance = MissionLocationPool::getMaxDistance(ring);
+
+	int maximumNumberOfTries = 20;
+	while (maximumNumberOfTries-- > 0) {
+		location = player->getWorldCoordinate(System::random((int) (maxDistance - minDistance)) + minDistance, (float)System::random(360), false);
+
+		if (isMissionLocation(zone, ring, location))
+			return true;
+	}
+
+	return false;
+}
+
+bool MissionManagerImplementation::isMissionLocation(Zone* zone, int ring, const Vector3& location) {
+	ManagedReference<PlanetManager*> planetManager = zone->getPlanetManager();
+
+	if (ring == MissionLocationPool::RECONRING) {
+		//Check if it is a position where you can build and away from any travel points.
+		if (!planetManager->isBuildingPermittedAt(location.getX(), location.getY(), NULL))
+			return false;
+
+		Reference<PlanetTravelPoint*> travelPoint = planetManager->getNearestPlanetTravelPoint(location);
+
+		return travelPoint != NULL && travelPoint->getArrivalPosition().distanceTo(location) > 1000.0f;
+	}
+
+	if (!zone->isWithinBoundaries(location))
+		return false;
+
+	float height = zone->getHeight(location.getX(), location.getY());
+	float waterHeight = height * 2;
+	bool result = planetManager->getTerrainManager()->getWaterHeight(location.getX(), location.getY(), waterHeight);
+
+	if (result && waterHeight > height)
+		return false;
+
+	//Check that the position is outside cities.
+	SortedVector<ManagedReference<ActiveArea* > > activeAreas;
+	zone->getInRangeActiveAreas(location.getX(), location.getY(), &activeAreas, true);
+
+	for (int i = 0; i < activeAreas.size(); ++i) {
+		if (activeAreas.get(i)->isMunicipalZone())
+			return false;
+	}
+
+	return true;
+}
+
+void MissionManagerImplementation::refillMissionLocations(Zone* zone, int ring, const Vector3& origin) {
+	ManagedReference<PlanetManager*> planetManager = zone->getPlanetManager();
+
+	if (planetManager == NULL)
+		return;
+
+	BuildabilityMap* buildabilityMap = zone->getBuildabilityMap();
+
+	float minDistance = MissionLocationPool::getMinDistance(ring);
+	float maxDistance = MissionLocationPool::getMaxDistance(ring);
+
+	Vector<SpawnPositionPool::Entry> entries;
+	int attempts = 0;
+
+	// a terminal list holds several missions of a type
+	while (attempts < SpawnPositionPool::REFILLATTEMPTS * 2 && entries.size() < SpawnPositionPool::REFILLSIZE * 2) {
+		++attempts;
+
+		float distance = System::random((int) (maxDistance - minDistance)) + minDistance;
+		float angle = System::random(360) * Math::DEG2RAD;
+
+		Vector3 location(origin.getX() + distance * Math::cos(angle), origin.getY() + distance * Math::sin(angle), 0);
+
+		// taken before the checks so anything that changes while they run drops the location
+		int revision = buildabilityMap->getRevision(location.getX(), location.getY());
+
+		if (revision == -1 || !isMissionLocation(zone, ring, location))
+			continue;
+
+		entries.add(SpawnPositionPool::Entry(location, revision));
+	}
+
+	planetManager->getMissionLocations()->add(ring, origin, entries, attempts);
+}
+
 void MissionManagerImplementation::randomizeSurveyMission(CreatureObject* player, MissionObject* mission) {
 	randomizeGenericSurveyMission(player, mission, Factions::FACTIONNEUTRAL);
 }
@@ -1395,7 +1482,6 @@ void MissionManagerImplementation::randomizeGenericHuntingMission(CreatureObject
 }
 
 void MissionManagerImplementation::randomizeGenericReconMission(CreatureObject* player, MissionObject* mission, const uint32 faction) {
-	bool foundPosition = false;
 	Vector3 position;
 
 	Zone* playerZone = player->getZone();
@@ -1404,21 +1490,7 @@ void MissionManagerImplementation::randomizeGenericReconMission(CreatureObject*
 		return;
 	}
 
-	int maximumNumberOfTries = 20;
-	while (!foundPosition && maximumNumberOfTries-- > 0) {
-		position = player->getWorldCoordinate(System::random(3000) + 1000, (float)System::random(360), false);
-
-		//Check if it is a position where you can build and away from any travel points.
-		if (playerZone->getPlanetManager()->isBuildingPermittedAt(position.getX(), position.getY(), NULL)) {
-			Reference<PlanetTravelPoint*> travelPoint = playerZone->getPlanetManager()->getNearestPlanetTravelPoint(position);
-
-			if (travelPoint != NULL && travelPoint->getArrivalPosition().distanceTo(position) > 1000.0f) {
-				foundPosition = true;
-			}
-		}
-	}
-
-	if (!foundPosition) {
+	if (!getMissionLocation(player, MissionLocationPool::RECONRING, position)) {
 		return;
 	}
 
@@ -1774,7 +1846,7 @@ Vector3 MissionManagerImplementation::getRandomBountyTargetPosition(CreatureObje
 }
 
 Reference<MissionObject*> MissionManagerImplementation::getBountyHunterMission(CreatureObject* player) {
-	ManagedReference<SceneObject*> datapad = player->getSlottedObject("datapad");
+	ManagedReference<SceneObject*> datapad = player->getKnownSlottedObject(SlotIndex::DATAPAD);
 
 	if (datapad != NULL) {
 		VectorMap<uint64, ManagedReference<SceneObject*> > objects;
@@ -2000,7 +2072,7 @@ void MissionManagerImplementation::deactivateMissions(CreatureObject* player) {
 		return;
 	}
 
-	SceneObject* datapad = player->getSlottedObject("datapad");
+	SceneObject* datapad = player->getKnownSlottedObject(SlotIndex::DATAPAD);
 
 	if (datapad == NULL) {
 		return;
@@ -161,9 +161,9 @@ float ObjectControllerImplementation::activateCommand(CreatureObject* object, un
 		object->info("activating characterAbility " + characterAbility);
 
 		if (object->isPlayerCreature()) {
-			Reference<PlayerObject*> playerObject =  object->getSlottedObject("ghost").castTo<PlayerObject*>();
+			Reference<PlayerObject*> playerObject =  object->getKnownSlottedObject(SlotIndex::GHOST).castTo<PlayerObject*>();
 
-			if (!playerObject->hasAbility(characterAbility)) {
+			if (!playerObject->hasAbility(queueCommand->getCharacterAbilityCRC())) {
 				object->clearQueueAction(actionCount, 0, 2);
 
 				return 0.f;
@@ -186,9 +186,9 @@ float ObjectControllerImplementation::activateCommand(CreatureObject* object, un
 	if (queueCommand->requiresAdmin()) {
 		try {
 			if(object->isPlayerCreature()) {
-				Reference<PlayerObject*> ghost =  object->getSlottedObject("ghost").castTo<PlayerObject*>();
+				Reference<PlayerObject*> ghost =  object->getKnownSlottedObject(SlotIndex::GHOST).castTo<PlayerObject*>();
 
-				if (ghost == NULL || !ghost->hasGodMode() || !ghost->hasAbility(queueCommand->getQueueCommandName())) {
+				if (ghost == NULL || !ghost->hasGodMode() || !ghost->hasAbility(queueCommand->getNameCRC())) {
 					StringBuffer logEntry;
 					logEntry << object->getDisplayedName() << " attempted to use the '/" << queueCommand->getQueueCommandName()
 							<< "' command without permissions";
@@ -0,0 +1,247 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#include "BuildabilityMap.h"
+
+#include "server/zone/objects/scene/SceneObject.h"
+#include "templates/tangible/SharedStructureObjectTemplate.h"
+#include "templates/footprint/StructureFootprint.h"
+#include "terrain/ProceduralTerrainAppearance.h"
+#include "terrain/layer/boundaries/Boundary.h"
+
+BuildabilityMap::BuildabilityMap() : Logger("BuildabilityMap"), origin(0), cellsPerRow(0),
+		cellFlags(NULL), noBuildObjects(NULL), revisions(NULL), globalWater(false) {
+}
+
+BuildabilityMap::~BuildabilityMap() {
+	delete[] cellFlags;
+	delete[] noBuildObjects;
+	delete[] revisions;
+}
+
+void BuildabilityMap::initialize(float size, const Vector<Reference<PoiData*> >* pois, ProceduralTerrainAppearance* terrain) {
+	Locker locker(&mutex);
+
+	if (isReady())
+		return;
+
+	origin = -size / 2;
+	cellsPerRow = (int) ceil(size / CELLSIZE);
+
+	cellFlags = new uint8[cellsPerRow * cellsPerRow];
+	noBuildObjects = new AtomicInteger[cellsPerRow * cellsPerRow];
+	revisions = new AtomicInteger[cellsPerRow * cellsPerRow];
+
+	for (int i = 0; i < cellsPerRow * cellsPerRow; ++i)
+		cellFlags[i] = 0;
+
+	if (pois != NULL)
+		initializePoiMasks(pois);
+
+	if (terrain != NULL)
+		initializeWaterMask(terrain);
+	else
+		globalWater = true;
+
+	HashTableIterator<uint64, NoBuildObject> iterator = objects.iterator();
+
+	while (iterator.hasNext())
+		countCells(iterator.next(), 1);
+
+	ready.increment();
+
+	info("initialized " + String::valueOf(cellsPerRow) + "x" + String::valueOf(cellsPerRow) + " cells with " + String::valueOf(objects.size()) + " no build objects");
+}
+
+void BuildabilityMap::initializePoiMasks(const Vector<Reference<PoiData*> >* pois) {
+	for (int i = 0; i < pois->size(); ++i) {
+		Vector3 position = pois->get(i)->getPosition();
+
+		// PlanetManager measures the distance to x, y, 0
+		float rangeSquared = POIRANGE * POIRANGE - position.getZ() * position.getZ();
+
+		if (rangeSquared < 0)
+			continue;
+
+		float range = Math::sqrt(rangeSquared);
+
+		int minX = MAX((int) floor((position.getX() - range - origin) / CELLSIZE), 0);
+		int minY = MAX((int) floor((position.getY() - range - origin) / CELLSIZE), 0);
+		int maxX = MIN((int) floor((position.getX() + range - origin) / CELLSIZE), cellsPerRow - 1);
+		int maxY = MIN((int) floor((position.getY() + range - origin) / CELLSIZE), cellsPerRow - 1);
+
+		for (int y = minY; y <= maxY; ++y) {
+			float y0 = origin + y * CELLSIZE;
+			float y1 = y0 + CELLSIZE;
+
+			float nearY = MIN(MAX(position.getY(), y0), y1) - position.getY();
+			float farY = MAX(fabs(y0 - position.getY()), fabs(y1 - position.getY()));
+
+			for (int x = minX; x <= maxX; ++x) {
+				float x0 = origin + x * CELLSIZE;
+				float x1 = x0 + CELLSIZE;
+
+				float nearX = MIN(MAX(position.getX(), x0), x1) - position.getX();
+				float farX = MAX(fabs(x0 - position.getX()), fabs(x1 - position.getX()));
+
+				uint8& flags = cellFlags[y * cellsPerRow + x];
+
+				// a little short of the range so rounding never claims a point the exact check wouldn't
+				if (farX * farX + farY * farY < rangeSquared * 0.99f)
+					flags |= POIINRANGE;
+				else if (nearX * nearX + nearY * nearY <= rangeSquared)
+					flags |= POINEAR;
+			}
+		}
+	}
+}
+
+void BuildabilityMap::initializeWaterMask(ProceduralTerrainAppearance* terrain) {
+	globalWater = terrain->getUseGlobalWaterTable();
+
+	if (globalWater)
+		return;
+
+	float max = origin + cellsPerRow * CELLSIZE;
+
+	Vector<const Boundary*> boundaries;
+	terrain->getWaterBoundariesInAABB(AABB(Vector3(origin, -FLT_MAX, origin), Vector3(max, FLT_MAX, max)), &boundaries);
+
+	for (int i = 0; i < boundaries.size(); ++i) {
+		const Boundary* boundary = boundaries.get(i);
+
+		int minX = MAX((int) floor((boundary->getMinX() - origin) / CELLSIZE), 0);
+		int minY = MAX((int) floor((boundary->getMinY() - origin) / CELLSIZE), 0);
+		int maxX = MIN((int) floor((boundary->getMaxX() - origin) / CELLSIZE), cellsPerRow - 1);
+		int maxY = MIN((int) floor((boundary->getMaxY() - origin) / CELLSIZE), cellsPerRow - 1);
+
+		for (int y = minY; y <= maxY; ++y) {
+			for (int x = minX; x <= maxX; ++x)
+				cellFlags[y * cellsPerRow + x] |= WATER;
+		}
+	}
+}
+
+float BuildabilityMap::getNoBuildReach(SceneObject* object) {
+	if (object == NULL)
+		return 0;
+
+	SharedObjectTemplate* objectTemplate = object->getObjectTemplate();
+
+	if (objectTemplate == NULL)
+		return 0;
+
+	float reach = MAX(objectTemplate->getNoBuildRadius(), 0.f);
+
+	if (objectTemplate->isSharedStructureObjectTemplate()) {
+		StructureFootprint* footprint = static_cast<SharedStructureObjectTemplate*>(objectTemplate)->getStructureFootprint();
+
+		// footprint cells are 8m and the footprint center lies inside it, so its
+		// diagonal covers every rotation
+		if (footprint != NULL) {
+			float length = footprint->getRowSize() * 8;
+			float width = footprint->getColSize() * 8;
+
+			reach = MAX(reach, Math::sqrt(length * length + width * width));
+		}
+	}
+
+	return reach;
+}
+
+void BuildabilityMap::insert(SceneObject* object) {
+	float reach = getNoBuildReach(object);
+
+	if (reach <= 0)
+		return;
+
+	NoBuildObject noBuildObject(object->getPositionX(), object->getPositionY(), reach);
+
+	Locker locker(&mutex);
+
+	uint64 oid = object->getObjectID();
+
+	if (objects.containsKey(oid) && isReady())
+		countCells(objects.get(oid), -1);
+
+	objects.put(oid, noBuildObject);
+
+	if (isReady())
+		countCells(noBuildObject, 1);
+}
+
+void BuildabilityMap::remove(SceneObject* object) {
+	if (getNoBuildReach(object) <= 0)
+		return;
+
+	Locker locker(&mutex);
+
+	uint64 oid = object->getObjectID();
+
+	if (!objects.containsKey(oid))
+		return;
+
+	if (isReady())
+		countCells(objects.get(oid), -1);
+
+	objects.remove(oid);
+}
+
+void BuildabilityMap::update(SceneObject* object) {
+	if (getNoBuildReach(object) <= 0)
+		return;
+
+	Locker locker(&mutex);
+
+	uint64 oid = object->getObjectID();
+
+	if (objects.containsKey(oid)) {
+		const NoBuildObject& current = objects.get(oid);
+
+		if (current.x == object->getPositionX() && current.y == object->getPositionY())
+			return;
+	}
+
+	locker.release();
+
+	insert(object);
+}
+
+void BuildabilityMap::countCells(const NoBuildObject& object, int delta) {
+	float reach = object.reach + MAXMARGIN;
+
+	int minX = MAX((int) floor((object.x - reach - origin) / CELLSIZE), 0);
+	int minY = MAX((int) floor((object.y - reach - origin) / CELLSIZE), 0);
+	int maxX = MIN((int) floor((object.x + reach - origin) / CELLSIZE), cellsPerRow - 1);
+	int maxY = MIN((int) floor((object.y + reach - origin) / CELLSIZE), cellsPerRow - 1);
+
+	for (int y = minY; y <= maxY; ++y) {
+		for (int x = minX; x <= maxX; ++x) {
+			if (delta > 0)
+				noBuildObjects[y * cellsPerRow + x].increment();
+			else
+				noBuildObjects[y * cellsPerRow + x].decrement();
+
+			revisions[y * cellsPerRow + x].increment();
+		}
+	}
+}
+
+void BuildabilityMap::touch(float x, float y, float radius) {
+	if (!isReady())
+		return;
+
+	// spawn checks look for active areas up to their margin plus 64m around a point
+	float reach = radius + MAXMARGIN + 64;
+
+	int minX = MAX((int) floor((x - reach - origin) / CELLSIZE), 0);
+	int minY = MAX((int) floor((y - reach - origin) / CELLSIZE), 0);
+	int maxX = MIN((int) floor((x + reach - origin) / CELLSIZE), cellsPerRow - 1);
+	int maxY = MIN((int) floor((y + reach - origin) / CELLSIZE), cellsPerRow - 1);
+
+	for (int cellY = minY; cellY <= maxY; ++cellY) {
+		for (int cellX = minX; cellX <= maxX; ++cellX)
+			revisions[cellY * cellsPerRow + cellX].increment();
+	}
+}
@@ -0,0 +1,185 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#ifndef BUILDABILITYMAP_H_
+#define BUILDABILITYMAP_H_
+
+#include "engine/engine.h"
+
+#include "ClientPoiDataTable.h"
+
+namespace server {
+namespace zone {
+namespace objects {
+namespace scene {
+	class SceneObject;
+}
+}
+}
+}
+
+using namespace server::zone::objects::scene;
+
+class ProceduralTerrainAppearance;
+
+/**
+ * Coarse grid over a zone telling which of the spawn and build checks of
+ * PlanetManager can possibly fail at a point. Cells far from points of
+ * interest, water and objects with a no build radius answer those checks
+ * without touching the terrain or the quad tree, the others are left to
+ * the exact checks.
+ *
+ * Points of interest and water never change after initialize. Objects with
+ * a no build radius or a structure footprint are counted in the cells they
+ * can reach as the zone inserts, moves and removes them.
+ *
+ * Every cell also carries a revision that changes whenever an object or an
+ * area that can affect the checks in it comes or goes, so results cached
+ * for a point stay valid while the revision of its cell does.
+ */
+class BuildabilityMap : public Object, public Logger {
+public:
+	const static int CELLSIZE = 64;
+
+	// largest extra margin answered from the object counts
+	const static int MAXMARGIN = 128;
+
+	// range the point of interest masks are built for
+	const static int POIRANGE = 150;
+
+	// every point of the cell is within POIRANGE of a point of interest
+	const static uint8 POIINRANGE = 1;
+
+	// some points of the cell are within POIRANGE of a point of interest
+	const static uint8 POINEAR = 2;
+
+	// the cell overlaps the bounds of a water boundary
+	const static uint8 WATER = 4;
+
+protected:
+	class NoBuildObject {
+	public:
+		float x, y;
+
+		// no build radius or footprint extent around x, y
+		float reach;
+
+		NoBuildObject() : x(0), y(0), reach(0) {
+		}
+
+		NoBuildObject(float x, float y, float reach) : x(x), y(y), reach(reach) {
+		}
+	};
+
+	float origin;
+	int cellsPerRow;
+
+	uint8* cellFlags;
+	AtomicInteger* noBuildObjects;
+	AtomicInteger* revisions;
+
+	bool globalWater;
+
+	// objects inserted before initialize are counted by it
+	HashTable<uint64, NoBuildObject> objects;
+
+	Mutex mutex;
+
+	AtomicInteger ready;
+
+public:
+	BuildabilityMap();
+	~BuildabilityMap();
+
+	/**
+	 * Builds the static masks for a zone of side size centered on 0, 0
+	 */
+	void initialize(float size, const Vector<Reference<PoiData*> >* pois, ProceduralTerrainAppearance* terrain);
+
+	void insert(SceneObject* object);
+	void remove(SceneObject* object);
+	void update(SceneObject* object);
+
+	/**
+	 * Changes the revision of the cells whose spawn checks can see an area
+	 * of radius around x, y
+	 */
+	void touch(float x, float y, float radius);
+
+	inline bool isReady() {
+		return ready.get() != 0;
+	}
+
+	/**
+	 * @return POIINRANGE, POINEAR or 0 for the cell at x, y, POINEAR when
+	 * the map doesn't know
+	 */
+	inline int getPoiRange(float x, float y) {
+		int cell = getCell(x, y);
+
+		if (cell == -1)
+			return POINEAR;
+
+		return cellFlags[cell] & (POIINRANGE | POINEAR);
+	}
+
+	inline bool mayBeInWater(float x, float y) {
+		int cell = getCell(x, y);
+
+		return cell == -1 || globalWater || (cellFlags[cell] & WATER);
+	}
+
+	/**
+	 * @return false if no object with a no build radius or footprint
+	 * widened by margin can reach x, y
+	 */
+	inline bool mayBeInNoBuildZone(float x, float y, float margin) {
+		if (margin > MAXMARGIN)
+			return true;
+
+		int cell = getCell(x, y);
+
+		return cell == -1 || noBuildObjects[cell].get() != 0;
+	}
+
+	/**
+	 * @return revision of the cell at x, y or -1 when the map doesn't know
+	 */
+	inline int getRevision(float x, float y) {
+		int cell = getCell(x, y);
+
+		if (cell == -1)
+			return -1;
+
+		return revisions[cell].get() & 0x7FFFFFFF;
+	}
+
+	/**
+	 * Radius around its position the no build checks of object can reach
+	 * without margin, 0 for objects they ignore
+	 */
+	static float getNoBuildReach(SceneObject* object);
+
+protected:
+	inline int getCell(float x, float y) {
+		if (!isReady())
+			return -1;
+
+		int cellX = (int) floor((x - origin) / CELLSIZE);
+		int cellY = (int) floor((y - origin) / CELLSIZE);
+
+		if (cellX < 0 || cellY < 0 || cellX >= cellsPerRow || cellY >= cellsPerRow)
+			return -1;
+
+		return cellY * cellsPerRow + cellX;
+	}
+
+	void initializePoiMasks(const Vector<Reference<PoiData*> >* pois);
+	void initializeWaterMask(ProceduralTerrainAppearance* terrain);
+
+	// mutex must be locked
+	void countCells(const NoBuildObject& object, int delta);
+};
+
+#endif /* BUILDABILITYMAP_H_ */
@@ -0,0 +1,111 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#ifndef MISSIONLOCATIONPOOL_H_
+#define MISSIONLOCATIONPOOL_H_
+
+#include "engine/engine.h"
+
+#include "server/zone/objects/area/SpawnPositionPool.h"
+
+/**
+ * Mission target locations of a planet that already passed the checks of
+ * their mission type, grouped by the spot the terminal user stood on and the
+ * distance ring of the mission type. Locations are only handed out while the
+ * buildability map revision of their cell is the one they were checked with.
+ */
+class MissionLocationPool : public Object {
+public:
+	const static int DESTROYRING = 0;
+	const static int RECONRING = 1;
+	const static int RINGS = 2;
+
+	// users closer than this to each other share their locations
+	const static int CELLSIZE = 64;
+
+protected:
+	class Spot : public Object {
+	public:
+		SpawnPositionPool locations[RINGS];
+		bool refilling[RINGS];
+
+		Spot() {
+			for (int i = 0; i < RINGS; ++i)
+				refilling[i] = false;
+		}
+	};
+
+	HashTable<uint32, Reference<Spot*> > spots;
+
+	Mutex mutex;
+
+public:
+	static float getMinDistance(int ring) {
+		return 1000.f;
+	}
+
+	static float getMaxDistance(int ring) {
+		return ring == RECONRING ? 4000.f : 2000.f;
+	}
+
+	/**
+	 * Removes a location of ring around origin
+	 * @param refill set when the caller should refill the spot of origin
+	 * @return false if the spot has none
+	 */
+	bool take(int ring, const Vector3& origin, BuildabilityMap* map, Vector3& location, bool& refill) {
+		Locker locker(&mutex);
+
+		Reference<Spot*> spot = getSpot(origin);
+
+		bool found = spot->locations[ring].take(origin, getMinDistance(ring), getMaxDistance(ring), map, location);
+
+		refill = !spot->refilling[ring] && (!found || spot->locations[ring].size() < SpawnPositionPool::LOWWATER);
+
+		if (refill)
+			spot->refilling[ring] = true;
+
+		return found;
+	}
+
+	/**
+	 * Adds the locations a refill of ring around origin found
+	 */
+	void add(int ring, const Vector3& origin, const Vector<SpawnPositionPool::Entry>& entries, int attempts) {
+		Locker locker(&mutex);
+
+		Reference<Spot*> spot = getSpot(origin);
+
+		for (int i = 0; i < entries.size(); ++i)
+			spot->locations[ring].add(entries.get(i));
+
+		spot->locations[ring].addRefill(attempts, entries.size());
+		spot->refilling[ring] = false;
+	}
+
+	int getSpotCount() {
+		Locker locker(&mutex);
+
+		return spots.size();
+	}
+
+protected:
+	// mutex must be locked
+	Reference<Spot*> getSpot(const Vector3& origin) {
+		uint32 cellX = (uint32) (int) floor(origin.getX() / CELLSIZE) & 0xFFFF;
+		uint32 cellY = (uint32) (int) floor(origin.getY() / CELLSIZE) & 0xFFFF;
+		uint32 key = (cellX << 16) | cellY;
+
+		Reference<Spot*> spot = spots.get(key);
+
+		if (spot == NULL) {
+			spot = new Spot();
+			spots.put(key, spot);
+		}
+
+		return spot;
+	}
+};
+
+#endif /* MISSIONLOCATIONPOOL_H_ */
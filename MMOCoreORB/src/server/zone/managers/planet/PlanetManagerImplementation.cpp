@@ -42,6 +42,7 @@
 #include "conf/ConfigManager.h"
 
 #include "PlanetTravelPoint.h"
+#include "BuildabilityMap.h"
 #include "templates/tangible/SharedStructureObjectTemplate.h"
 #include "server/zone/managers/structure/StructureManager.h"
 #include "terrain/layer/boundaries/BoundaryRectangle.h"
@@ -53,6 +54,7 @@ Mutex PlanetManagerImplementation::poiMutex;
 
 void PlanetManagerImplementation::initialize() {
 	performanceLocations = new MissionTargetMap();
+	missionLocations = new MissionLocationPool();
 
 	numberOfCities = 0;
 
@@ -62,6 +64,7 @@ void PlanetManagerImplementation::initialize() {
 
 	loadClientRegions();
 	loadClientPoiData();
+	initializeBuildabilityMap();
 	loadLuaConfig();
 	loadTravelFares();
 
@@ -774,6 +777,7 @@ void PlanetManagerImplementation::finalize() {
 	weatherManager = NULL;
 	planetTravelPointList = NULL;
 	performanceLocations = NULL;
+	missionLocations = NULL;
 	zone = NULL;
 	server = NULL;
 
@@ -783,7 +787,28 @@ void PlanetManagerImplementation::finalize() {
 	}
 }
 
+void PlanetManagerImplementation::initializeBuildabilityMap() {
+	String zoneName = zone->getZoneName();
+
+	const Vector<Reference<PoiData*> >* pois = NULL;
+
+	if (clientPoiDataTable.containsPlanet(zoneName))
+		pois = &clientPoiDataTable.getPois(zoneName);
+
+	zone->getBuildabilityMap()->initialize(terrainManager->getMax() * 2, pois, terrainManager->getProceduralTerrainAppearance());
+}
+
 bool PlanetManagerImplementation::isInRangeWithPoi(float x, float y, float range) {
+	if (range == BuildabilityMap::POIRANGE) {
+		int poiRange = zone->getBuildabilityMap()->getPoiRange(x, y);
+
+		if (poiRange & BuildabilityMap::POIINRANGE)
+			return true;
+
+		if (!(poiRange & BuildabilityMap::POINEAR))
+			return false;
+	}
+
 	String zoneName = zone->getZoneName();
 
 	if (!clientPoiDataTable.containsPlanet(zoneName))
@@ -802,6 +827,9 @@ bool PlanetManagerImplementation::isInRangeWithPoi(float x, float y, float range
 }
 
 bool PlanetManagerImplementation::isInObjectsNoBuildZone(float x, float y, float extraMargin) {
+	if (!zone->getBuildabilityMap()->mayBeInNoBuildZone(x, y, extraMargin))
+		return false;
+
 	SortedVector<QuadTreeEntry*> closeObjects;
 
 	Vector3 targetPos(x, y, zone->getHeight(x, y));
@@ -870,7 +898,7 @@ bool PlanetManagerImplementation::isSpawningPermittedAt(float x, float y, float
 	if (isInRangeWithPoi(x, y, 150))
 		return false;
 
-	if (terrainManager->getHighestHeightDifference(x - 10, y - 10, x + 10, y + 10) > 15.0)
+	if (!terrainManager->isHeightDifferenceWithin(x - 10, y - 10, x + 10, y + 10, 15.0))
 		return false;
 
 	return true;
@@ -1042,6 +1070,9 @@ bool PlanetManagerImplementation::checkShuttleStatus(CreatureObject* creature, C
 }
 
 bool PlanetManagerImplementation::isInWater(float x, float y) {
+	if (!zone->getBuildabilityMap()->mayBeInWater(x, y))
+		return false;
+
 	float z = zone->getHeight(x, y);
 	float waterHeight = z;
 	if(getTerrainManager()->getWaterHeight(x, y, waterHeight))
@@ -1059,7 +1090,7 @@ float PlanetManagerImplementation::findClosestWorldFloor(float x, float y, float
 
     if (intersections == NULL) {
     	ref = intersections = new IntersectionResults();
-    	CollisionManager::getWorldFloorCollisions(x, y, zone, intersections, closeObjects);
+    	CollisionManager::getWorldFloorCollisions(x, y, zone, intersections);
     }
 
 	float terrainHeight = zone->getHeight(x, y);
@@ -0,0 +1,297 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#include "gtest/gtest.h"
+
+#include "server/zone/managers/planet/BuildabilityMap.h"
+#include "templates/manager/DataArchiveStore.h"
+#include "terrain/ProceduralTerrainAppearance.h"
+#include "terrain/layer/boundaries/Boundary.h"
+#include "conf/ConfigManager.h"
+
+class TestPoiData : public PoiData {
+public:
+	TestPoiData(float x, float y, float z) {
+		this->x = x;
+		this->y = y;
+		this->z = z;
+	}
+};
+
+/**
+ * Takes no build objects without a scene object behind them
+ */
+class TestBuildabilityMap : public BuildabilityMap {
+public:
+	void insertObject(uint64 oid, float x, float y, float reach) {
+		Locker locker(&mutex);
+
+		NoBuildObject object(x, y, reach);
+
+		if (objects.containsKey(oid) && isReady())
+			countCells(objects.get(oid), -1);
+
+		objects.put(oid, object);
+
+		if (isReady())
+			countCells(object, 1);
+	}
+
+	void removeObject(uint64 oid) {
+		Locker locker(&mutex);
+
+		if (!objects.containsKey(oid))
+			return;
+
+		if (isReady())
+			countCells(objects.get(oid), -1);
+
+		objects.remove(oid);
+	}
+};
+
+class BuildabilityMapTest : public ::testing::Test {
+public:
+	const static int SIZE = 4096;
+
+	Vector<float> pointsX;
+	Vector<float> pointsY;
+
+	/**
+	 * Random points plus points on and right next to every cell border
+	 * between minX, minY and maxX, maxY
+	 */
+	void addPoints(float minX, float minY, float maxX, float maxY, int randomPoints) {
+		for (int i = 0; i < randomPoints; ++i) {
+			pointsX.add(minX + System::random((int) ((maxX - minX) * 10)) / 10.f);
+			pointsY.add(minY + System::random((int) ((maxY - minY) * 10)) / 10.f);
+		}
+
+		float origin = -SIZE / 2;
+		float step = BuildabilityMap::CELLSIZE;
+
+		float firstX = origin + ceil((minX - origin) / step) * step;
+		float firstY = origin + ceil((minY - origin) / step) * step;
+
+		for (float x = firstX; x <= maxX; x += step) {
+			for (float y = firstY; y <= maxY; y += step) {
+				for (int dx = -1; dx <= 1; ++dx) {
+					for (int dy = -1; dy <= 1; ++dy) {
+						pointsX.add(x + dx * 0.01f);
+						pointsY.add(y + dy * 0.01f);
+					}
+				}
+
+				// along the borders between the corners
+				pointsX.add(x + System::random((int) step * 100) / 100.f);
+				pointsY.add(y);
+
+				pointsX.add(x);
+				pointsY.add(y + System::random((int) step * 100) / 100.f);
+			}
+		}
+	}
+
+	/**
+	 * Points on and around the circle of radius around x, y
+	 */
+	void addCirclePoints(float x, float y, float radius) {
+		for (int i = 0; i < 64; ++i) {
+			float angle = i * M_PI / 32;
+
+			for (int d = -1; d <= 1; ++d) {
+				pointsX.add(x + (radius + d * 0.01f) * cos(angle));
+				pointsY.add(y + (radius + d * 0.01f) * sin(angle));
+			}
+		}
+	}
+
+	void clearPoints() {
+		pointsX.removeAll();
+		pointsY.removeAll();
+	}
+};
+
+TEST_F(BuildabilityMapTest, PoiMasksNeverContradictExactCheck) {
+	const float range = BuildabilityMap::POIRANGE;
+
+	Vector<Reference<PoiData*> > pois;
+
+	for (int i = 0; i < 40; ++i) {
+		float x = System::random(SIZE - 400) - SIZE / 2 + 200;
+		float y = System::random(SIZE - 400) - SIZE / 2 + 200;
+
+		pois.add(new TestPoiData(x, y, System::random(100)));
+	}
+
+	// on a cell corner and on the edge of the map
+	pois.add(new TestPoiData(BuildabilityMap::CELLSIZE * 3, BuildabilityMap::CELLSIZE * -2, 0));
+	pois.add(new TestPoiData(-SIZE / 2 + 10, SIZE / 2 - 10, 20));
+
+	BuildabilityMap map;
+	map.initialize(SIZE, &pois, NULL);
+	ASSERT_TRUE(map.isReady());
+
+	for (int i = 0; i < pois.size(); ++i) {
+		Vector3 position = pois.get(i)->getPosition();
+
+		addPoints(position.getX() - 200, position.getY() - 200, position.getX() + 200, position.getY() + 200, 500);
+		addCirclePoints(position.getX(), position.getY(), Math::sqrt(range * range - position.getZ() * position.getZ()));
+	}
+
+	int answered = 0;
+
+	for (int i = 0; i < pointsX.size(); ++i) {
+		float x = pointsX.get(i), y = pointsY.get(i);
+
+		// what PlanetManager::isInRangeWithPoi does without the map
+		Vector3 target(x, y, 0);
+		bool inRange = false;
+
+		for (int j = 0; j < pois.size() && !inRange; ++j)
+			inRange = pois.get(j)->getPosition().squaredDistanceTo(target) <= range * range;
+
+		int poiRange = map.getPoiRange(x, y);
+
+		if (poiRange & BuildabilityMap::POIINRANGE) {
+			EXPECT_TRUE(inRange) << x << " " << y;
+			++answered;
+		} else if (!(poiRange & BuildabilityMap::POINEAR)) {
+			EXPECT_FALSE(inRange) << x << " " << y;
+			++answered;
+		}
+	}
+
+	// cells well inside or outside the range answer without the exact check
+	EXPECT_GT(answered, 0);
+}
+
+TEST_F(BuildabilityMapTest, NoBuildCountsNeverRejectExactCheck) {
+	TestBuildabilityMap map;
+
+	// some objects exist before the map does
+	map.insertObject(1, 100, 100, 32);
+	map.insertObject(2, BuildabilityMap::CELLSIZE * 4, BuildabilityMap::CELLSIZE * 4, 50);
+
+	map.initialize(SIZE, NULL, NULL);
+
+	map.insertObject(3, -1000.5f, 700.25f, 90);
+	map.insertObject(4, SIZE / 2 - 5, -SIZE / 2 + 5, 40);
+
+	// moved and removed objects no longer count where they were
+	map.insertObject(5, 1500, 1500, 60);
+	map.insertObject(5, 1200, -300, 60);
+	map.insertObject(6, -1500, -1500, 60);
+	map.removeObject(6);
+
+	float objects[][3] = {
+		{ 100, 100, 32 },
+		{ BuildabilityMap::CELLSIZE * 4, BuildabilityMap::CELLSIZE * 4, 50 },
+		{ -1000.5f, 700.25f, 90 },
+		{ SIZE / 2 - 5, -SIZE / 2 + 5, 40 },
+		{ 1200, -300, 60 },
+	};
+
+	float margins[] = { 0, 16, 64, BuildabilityMap::MAXMARGIN };
+
+	for (int i = 0; i < 5; ++i) {
+		float reach = objects[i][2] + BuildabilityMap::MAXMARGIN;
+
+		addPoints(objects[i][0] - reach - 64, objects[i][1] - reach - 64, objects[i][0] + reach + 64, objects[i][1] + reach + 64, 500);
+
+		for (float margin : margins)
+			addCirclePoints(objects[i][0], objects[i][1], objects[i][2] + margin);
+	}
+
+	for (float margin : margins) {
+		for (int i = 0; i < pointsX.size(); ++i) {
+			float x = pointsX.get(i), y = pointsY.get(i);
+
+			// the exact check is 3D, the flat distance is never further
+			bool inNoBuildZone = false;
+
+			for (int j = 0; j < 5 && !inNoBuildZone; ++j) {
+				float dx = objects[j][0] - x, dy = objects[j][1] - y;
+				float radius = objects[j][2] + margin;
+
+				inNoBuildZone = dx * dx + dy * dy < radius * radius;
+			}
+
+			if (inNoBuildZone)
+				EXPECT_TRUE(map.mayBeInNoBuildZone(x, y, margin)) << x << " " << y << " margin " << margin;
+		}
+	}
+
+	EXPECT_FALSE(map.mayBeInNoBuildZone(1500, 1500, 0));
+	EXPECT_FALSE(map.mayBeInNoBuildZone(-1500, -1500, 0));
+	EXPECT_TRUE(map.mayBeInNoBuildZone(1500, 1500, BuildabilityMap::MAXMARGIN + 1));
+}
+
+TEST_F(BuildabilityMapTest, WaterMaskNeverRejectsWater) {
+	ConfigManager::instance()->loadConfigData();
+	DataArchiveStore::instance()->loadTres(ConfigManager::instance()->getTrePath(), ConfigManager::instance()->getTreFiles());
+
+	const char* planets[] = { "corellia", "dantooine", "naboo", "rori", "yavin4" };
+
+	for (const char* planet : planets) {
+		String terrainFile = "terrain/" + String(planet) + ".trn";
+
+		IffStream* stream = DataArchiveStore::instance()->openIffFile(terrainFile);
+
+		ASSERT_TRUE(stream != NULL) << terrainFile.toCharArray();
+
+		ProceduralTerrainAppearance terrain;
+		terrain.readObject(stream);
+
+		delete stream;
+
+		if (terrain.getUseGlobalWaterTable())
+			continue;
+
+		float size = terrain.getSize();
+
+		BuildabilityMap map;
+		map.initialize(size, NULL, &terrain);
+
+		Vector<const Boundary*> boundaries;
+		terrain.getWaterBoundariesInAABB(AABB(Vector3(-size / 2, -FLT_MAX, -size / 2), Vector3(size / 2, FLT_MAX, size / 2)), &boundaries);
+
+		clearPoints();
+
+		for (int i = 0; i < boundaries.size(); ++i) {
+			const Boundary* boundary = boundaries.get(i);
+
+			addPoints(boundary->getMinX() - 32, boundary->getMinY() - 32, boundary->getMaxX() + 32, boundary->getMaxY() + 32, 200);
+
+			// the bounds themselves
+			float cornersX[] = { boundary->getMinX(), boundary->getMaxX() };
+			float cornersY[] = { boundary->getMinY(), boundary->getMaxY() };
+
+			for (int cx = 0; cx < 2; ++cx) {
+				for (int cy = 0; cy < 2; ++cy) {
+					pointsX.add(cornersX[cx]);
+					pointsY.add(cornersY[cy]);
+				}
+			}
+		}
+
+		int water = 0;
+
+		for (int i = 0; i < pointsX.size(); ++i) {
+			float x = pointsX.get(i), y = pointsY.get(i);
+			float waterHeight;
+
+			if (terrain.getWater(x, y, waterHeight)) {
+				EXPECT_TRUE(map.mayBeInWater(x, y)) << planet << " " << x << " " << y;
+				++water;
+			}
+		}
+
+		RecordProperty((String(planet) + "_water_points").toCharArray(), water);
+
+		// far from any water boundary
+		if (boundaries.isEmpty())
+			EXPECT_FALSE(map.mayBeInWater(0, 0)) << planet;
+	}
+}
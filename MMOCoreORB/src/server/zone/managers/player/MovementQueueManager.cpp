@@ -0,0 +1,155 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#include "MovementQueueManager.h"
+
+#include "server/zone/Zone.h"
+#include "server/zone/ZoneClientSession.h"
+#include "conf/ConfigManager.h"
+
+MovementQueueManager::MovementQueueManager() : Logger("MovementQueueManager") {
+	ConfigManager* config = ConfigManager::instance();
+
+	initialize(*config->getMovementTaskQueues(), *config->getMovementZones(), *config->getMovementZoneRegions(), config->getMovementQueueRebalanceDepth());
+}
+
+MovementQueueManager::MovementQueueManager(const Vector<int>& queues, const Vector<String>& zones, const Vector<int>& regions, int rebalanceDepth) : Logger("MovementQueueManager") {
+	initialize(queues, zones, regions, rebalanceDepth);
+}
+
+void MovementQueueManager::initialize(const Vector<int>& queues, const Vector<String>& zones, const Vector<int>& regions, int rebalanceDepth) {
+	for (int i = 0; i < queues.size() && i < MAXQUEUES; ++i)
+		taskQueues.add(queues.get(i));
+
+	if (taskQueues.size() == 0)
+		taskQueues.add(3);
+
+	zoneRegions.setNoDuplicateInsertPlan();
+	zoneSlots.setNoDuplicateInsertPlan();
+	regionQueues.setNoDuplicateInsertPlan();
+
+	// regions take the dedicated queues in config order
+	int slot = 0;
+
+	for (int i = 0; i < zones.size() && i < regions.size(); ++i) {
+		if (zoneRegions.contains(zones.get(i)))
+			continue;
+
+		zoneRegions.put(zones.get(i), regions.get(i));
+		zoneSlots.put(zones.get(i), slot);
+
+		slot += regions.get(i);
+	}
+
+	this->rebalanceDepth = rebalanceDepth;
+}
+
+int MovementQueueManager::getRegion(const String& zoneName, float minX, float maxX, float x) {
+	int index = zoneRegions.find(zoneName);
+
+	if (index == -1)
+		return 0;
+
+	int regions = zoneRegions.elementAt(index).getValue();
+
+	if (regions <= 1 || maxX <= minX)
+		return 0;
+
+	float width = (maxX - minX) / regions;
+
+	return Math::max(0, Math::min(regions - 1, (int) ((x - minX) / width)));
+}
+
+int MovementQueueManager::getDefaultQueueIndex(const String& zoneName, int region) {
+	int index = zoneSlots.find(zoneName);
+
+	// zones that aren't configured share the first queue
+	if (index == -1 || taskQueues.size() < 2)
+		return 0;
+
+	int slot = zoneSlots.elementAt(index).getValue() + region;
+
+	return 1 + slot % (taskQueues.size() - 1);
+}
+
+int MovementQueueManager::getQuietestQueueIndex() {
+	int quietest = 0;
+
+	for (int i = 1; i < taskQueues.size(); ++i) {
+		if (queueDepths[i].get() < queueDepths[quietest].get())
+			quietest = i;
+	}
+
+	return quietest;
+}
+
+int MovementQueueManager::getQueueIndex(Zone* zone, float x) {
+	if (zone == NULL)
+		return 0;
+
+	const String& zoneName = zone->getZoneName();
+
+	int region = getRegion(zoneName, zone->getMinX(), zone->getMaxX(), x);
+
+	uint64 key = ((uint64) zone->getZoneCRC() << 8) | region;
+
+	ReadLocker rlocker(&regionQueuesLock);
+
+	int entry = regionQueues.find(key);
+	int index = entry != -1 ? regionQueues.elementAt(entry).getValue() : getDefaultQueueIndex(zoneName, region);
+
+	if (rebalanceDepth <= 0 || queueDepths[index].get() <= rebalanceDepth)
+		return index;
+
+	int quietest = getQuietestQueueIndex();
+
+	if (queueDepths[quietest].get() * 2 >= queueDepths[index].get())
+		return index;
+
+	rlocker.release();
+
+	Locker locker(&regionQueuesLock);
+
+	regionQueues.put(key, quietest);
+
+	info("moving movement updates of " + zoneName + " region " + String::valueOf(region) + " from task queue "
+			+ String::valueOf(taskQueues.get(index)) + " to " + String::valueOf(taskQueues.get(quietest)));
+
+	return quietest;
+}
+
+int MovementQueueManager::acquireTaskQueue(ZoneClientSession* client, Zone* zone, float x) {
+	int regionIndex = -1;
+
+	// pending count and queue change together, so a client never has updates pending on two queues
+	while (true) {
+		uint32 state = client->getMovementTaskState();
+		uint32 pending = state >> 8;
+		int index = (int) (state & 0xFF) - 1;
+
+		if (pending == 0 || index < 0) {
+			if (regionIndex == -1)
+				regionIndex = getQueueIndex(zone, x);
+
+			index = regionIndex;
+		}
+
+		if (client->compareAndSetMovementTaskState(state, ((pending + 1) << 8) | (index + 1))) {
+			queueDepths[index].increment();
+
+			return index;
+		}
+	}
+}
+
+void MovementQueueManager::releaseTaskQueue(ZoneClientSession* client, int index) {
+	queueDepths[index].decrement();
+
+	while (true) {
+		uint32 state = client->getMovementTaskState();
+
+		if ((state >> 8) == 0 || client->compareAndSetMovementTaskState(state, state - (1 << 8)))
+			return;
+	}
+}
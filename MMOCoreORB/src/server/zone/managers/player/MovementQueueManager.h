@@ -0,0 +1,98 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#ifndef MOVEMENTQUEUEMANAGER_H_
+#define MOVEMENTQUEUEMANAGER_H_
+
+#include "engine/engine.h"
+
+namespace server {
+namespace zone {
+	class Zone;
+	class ZoneClientSession;
+}
+}
+
+using namespace server::zone;
+
+/**
+ * Picks the task queue player movement updates run on. Zones, or west to
+ * east strips of a zone, are mapped to queues from MovementTaskQueues in the
+ * config and moved to a quieter queue when their queue backs up. A client
+ * keeps its queue while it has updates pending so they are handled in order.
+ */
+class MovementQueueManager : public Singleton<MovementQueueManager>, public Logger, public Object {
+public:
+	// queue indexes are kept in the low byte of the client movement task state
+	const static int MAXQUEUES = 32;
+
+protected:
+	Vector<int> taskQueues;
+	AtomicInteger queueDepths[MAXQUEUES];
+
+	// zone name -> number of regions
+	VectorMap<String, int> zoneRegions;
+
+	// zone name -> dedicated queue slot of its first region, in config order
+	VectorMap<String, int> zoneSlots;
+
+	// zone crc << 8 | region -> index into taskQueues, for regions moved off their queue
+	VectorMap<uint64, int> regionQueues;
+	ReadWriteLock regionQueuesLock;
+
+	int rebalanceDepth;
+
+	void initialize(const Vector<int>& queues, const Vector<String>& zones, const Vector<int>& regions, int rebalanceDepth);
+
+	int getQueueIndex(Zone* zone, float x);
+	int getQuietestQueueIndex();
+
+public:
+	/**
+	 * Uses the movement queues from the config
+	 */
+	MovementQueueManager();
+
+	/**
+	 * @param queues task queues to use, the first one takes the zones that aren't in zones
+	 * @param zones zones that get dedicated queues
+	 * @param regions number of west to east regions of each of zones
+	 */
+	MovementQueueManager(const Vector<int>& queues, const Vector<String>& zones, const Vector<int>& regions, int rebalanceDepth);
+
+	/**
+	 * @return west to east region of zoneName x is in, minX and maxX being the zone bounds
+	 */
+	int getRegion(const String& zoneName, float minX, float maxX, float x);
+
+	/**
+	 * @return index into the task queues region of zoneName uses until it is rebalanced
+	 */
+	int getDefaultQueueIndex(const String& zoneName, int region);
+
+	/**
+	 * Reserves a slot on the queue for a movement update of client at x
+	 * @return index of the reserved queue, to be passed to releaseTaskQueue
+	 */
+	int acquireTaskQueue(ZoneClientSession* client, Zone* zone, float x);
+
+	/**
+	 * Releases the slot reserved by acquireTaskQueue once the update is done
+	 * @param index index returned by acquireTaskQueue
+	 */
+	void releaseTaskQueue(ZoneClientSession* client, int index);
+
+	/**
+	 * @return task queue the updates of index are executed on
+	 */
+	int getTaskQueue(int index) {
+		return taskQueues.get(index);
+	}
+
+	int getQueueDepth(int index) {
+		return queueDepths[index].get();
+	}
+};
+
+#endif /* MOVEMENTQUEUEMANAGER_H_ */
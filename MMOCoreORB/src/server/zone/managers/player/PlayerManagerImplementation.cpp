@@ -388,10 +388,10 @@ bool PlayerManagerImplementation::kickUser(const String& name, const String& adm
 	if (adminplayer == NULL)
 		return false;
 
-	Reference<PlayerObject*> ghost = player->getSlottedObject("ghost").castTo<PlayerObject*>();
+	Reference<PlayerObject*> ghost = player->getKnownSlottedObject(SlotIndex::GHOST).castTo<PlayerObject*>();
 
 
-	Reference<PlayerObject*> adminghost = adminplayer->getSlottedObject("ghost").castTo<PlayerObject*>();
+	Reference<PlayerObject*> adminghost = adminplayer->getKnownSlottedObject(SlotIndex::GHOST).castTo<PlayerObject*>();
 
 	if(adminghost == NULL)
 		return false;
@@ -1613,7 +1613,7 @@ void PlayerManagerImplementation::handleAddItemToTradeWindow(CreatureObject* pla
 
 	tradeContainer->addTradeItem(objectToTrade);
 
-	SceneObject* inventory = player->getSlottedObject("inventory");
+	SceneObject* inventory = player->getKnownSlottedObject(SlotIndex::INVENTORY);
 	inventory->sendWithoutContainerObjectsTo(receiver);
 	objectToTrade->sendTo(receiver, true);
 
@@ -1706,11 +1706,11 @@ bool PlayerManagerImplementation::checkTradeItems(CreatureObject* player, Creatu
 	if (receiverContainer->getTradeTargetPlayer() != player->getObjectID())
 		return false;
 
-	SceneObject* playerInventory = player->getSlottedObject("inventory");
-	SceneObject* receiverInventory = receiver->getSlottedObject("inventory");
+	SceneObject* playerInventory = player->getKnownSlottedObject(SlotIndex::INVENTORY);
+	SceneObject* receiverInventory = receiver->getKnownSlottedObject(SlotIndex::INVENTORY);
 
-	SceneObject* playerDatapad = player->getSlottedObject("datapad");
-	SceneObject* receiverDatapad = receiver->getSlottedObject("datapad");
+	SceneObject* playerDatapad = player->getKnownSlottedObject(SlotIndex::DATAPAD);
+	SceneObject* receiverDatapad = receiver->getKnownSlottedObject(SlotIndex::DATAPAD);
 
 	int playerTanos = 0;
 	int playerItnos = 0;
@@ -1950,8 +1950,8 @@ void PlayerManagerImplementation::handleVerifyTradeMessage(CreatureObject* playe
 		}
 
 		if (receiverTradeContainer->hasVerifiedTrade()) {
-			SceneObject* receiverInventory = receiver->getSlottedObject("inventory");
-			SceneObject* receiverDatapad = receiver->getSlottedObject("datapad");
+			SceneObject* receiverInventory = receiver->getKnownSlottedObject(SlotIndex::INVENTORY);
+			SceneObject* receiverDatapad = receiver->getKnownSlottedObject(SlotIndex::DATAPAD);
 
 			for (int i = 0; i < tradeContainer->getTradeSize(); ++i) {
 				ManagedReference<SceneObject*> item = tradeContainer->getTradeItem(i);
@@ -1965,8 +1965,8 @@ void PlayerManagerImplementation::handleVerifyTradeMessage(CreatureObject* playe
 				}
 			}
 
-			SceneObject* playerInventory = player->getSlottedObject("inventory");
-			SceneObject* playerDatapad = player->getSlottedObject("datapad");
+			SceneObject* playerInventory = player->getKnownSlottedObject(SlotIndex::INVENTORY);
+			SceneObject* playerDatapad = player->getKnownSlottedObject(SlotIndex::DATAPAD);
 
 			for (int i = 0; i < receiverTradeContainer->getTradeSize(); ++i) {
 				ManagedReference<SceneObject*> item = receiverTradeContainer->getTradeItem(i);
@@ -2739,7 +2739,7 @@ void PlayerManagerImplementation::updateSwimmingState(CreatureObject* player, fl
 		if (intersections == NULL) {
 			ref = intersections = new IntersectionResults();
 
-			CollisionManager::getWorldFloorCollisions(player->getPositionX(), player->getPositionY(), zone, intersections, closeObjectsVector);
+			CollisionManager::getWorldFloorCollisions(player->getPositionX(), player->getPositionY(), zone, intersections);
 		}
 
 		for (int i = 0; i < intersections->size(); i++) {
@@ -2947,7 +2947,7 @@ void PlayerManagerImplementation::lootAll(CreatureObject* player, CreatureObject
 	if (!ai->isDead() || player->isDead())
 		return;
 
-	SceneObject* creatureInventory = ai->getSlottedObject("inventory");
+	SceneObject* creatureInventory = ai->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 	if (creatureInventory == NULL)
 		return;
@@ -2972,7 +2972,7 @@ void PlayerManagerImplementation::lootAll(CreatureObject* player, CreatureObject
 
 	ai->notifyObservers(ObserverEventType::LOOTCREATURE, player, 0);
 
-	SceneObject* playerInventory = player->getSlottedObject("inventory");
+	SceneObject* playerInventory = player->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 	if (playerInventory == NULL)
 		return;
@@ -3053,9 +3053,9 @@ SortedVector<ManagedReference<SceneObject*> > PlayerManagerImplementation::getIn
 	if (player == NULL)
 		return insurableItems;
 
-	SceneObject* datapad = player->getSlottedObject("datapad");
-	SceneObject* defweapon = player->getSlottedObject("default_weapon");
-	SceneObject* bank = player->getSlottedObject("bank");
+	SceneObject* datapad = player->getKnownSlottedObject(SlotIndex::DATAPAD);
+	SceneObject* defweapon = player->getKnownSlottedObject(SlotIndex::DEFAULT_WEAPON);
+	SceneObject* bank = player->getKnownSlottedObject(SlotIndex::BANK);
 
 	for (int i = 0; i < player->getSlottedObjectsSize(); ++i) {
 		SceneObject* container = player->getSlottedObject(i);
@@ -4022,7 +4022,7 @@ void PlayerManagerImplementation::acceptUnity( CreatureObject* respondingPlayer
 	}
 
 	// Check for a ring in player's inventory
-	ManagedReference<SceneObject*> inventory = respondingPlayer->getSlottedObject("inventory");
+	ManagedReference<SceneObject*> inventory = respondingPlayer->getKnownSlottedObject(SlotIndex::INVENTORY);
 	if( inventory == NULL ){
 		respondingPlayer->sendSystemMessage("@unity:wed_error"); // "An error has occurred during the unity process."
 		askingPlayer->sendSystemMessage("@unity:wed_error"); // "An error has occurred during the unity process."
@@ -4100,8 +4100,8 @@ void PlayerManagerImplementation::completeUnity( CreatureObject* respondingPlaye
 	}
 
 	// Find selected ring
-	ManagedReference<SceneObject*> respondingPlayerInventory = respondingPlayer->getSlottedObject("inventory");
-	ManagedReference<SceneObject*> askingPlayerInventory = askingPlayer->getSlottedObject("inventory");
+	ManagedReference<SceneObject*> respondingPlayerInventory = respondingPlayer->getKnownSlottedObject(SlotIndex::INVENTORY);
+	ManagedReference<SceneObject*> askingPlayerInventory = askingPlayer->getKnownSlottedObject(SlotIndex::INVENTORY);
 	if( respondingPlayerInventory == NULL || askingPlayerInventory == NULL ){
 		respondingPlayer->sendSystemMessage("@unity:wed_error"); // "An error has occurred during the unity process."
 		askingPlayer->sendSystemMessage("@unity:wed_error"); // "An error has occurred during the unity process."
@@ -4414,7 +4414,7 @@ void PlayerManagerImplementation::generateVeteranReward(CreatureObject* player )
 	}
 
 	// Generate item
-	SceneObject* inventory = player->getSlottedObject("inventory");
+	SceneObject* inventory = player->getKnownSlottedObject(SlotIndex::INVENTORY);
 	if( inventory == NULL ){
 		player->sendSystemMessage( "@veteran:reward_error"); //	The reward could not be granted.
 		cancelVeteranRewardSession( player );
@@ -16,19 +16,52 @@ namespace zone {
 namespace managers {
 namespace player {
 
+/**
+ * Online players that can be iterated without holding any lock. A snapshot
+ * is never changed once published, PlayerMap publishes a new one after the
+ * players change and a reader keeps the one it got alive for as long as it
+ * needs it.
+ */
+class PlayerMapSnapshot : public Object {
+	Vector<ManagedReference<CreatureObject*> > players;
+
+public:
+	PlayerMapSnapshot() {
+	}
+
+	void add(CreatureObject* player) {
+		players.add(player);
+	}
+
+	inline int size() const {
+		return players.size();
+	}
+
+	inline const ManagedReference<CreatureObject*>& get(int index) const {
+		return players.get(index);
+	}
+};
+
 class PlayerMap : public Mutex, public Object {
+	// keyed by lower case first name
 	HashTable<String, ManagedReference<CreatureObject*> > players;
-	HashTableIterator<String, ManagedReference<CreatureObject*> > iter;
+
+	// NULL until requested after the players changed
+	Reference<PlayerMapSnapshot*> snapshot;
 
 public:
-	PlayerMap(int initsize) : Mutex("PlayerMap"), players(initsize), iter(&players) {
+	PlayerMap(int initsize) : Mutex("PlayerMap"), players(initsize) {
 	}
 
 	void put(const String& name, CreatureObject* player, bool doLock = true) {
+		String key = name.toLowerCase();
+
 		lock(doLock);
 
 		try {
-			players.put(name.toLowerCase(), player);
+			players.put(key, player);
+
+			snapshot = NULL;
 		} catch (Exception& e) {
 			System::out << e.getMessage();
 			e.printStackTrace();
@@ -44,11 +77,13 @@ public:
 	CreatureObject* get(const String& name, bool doLock = true) {
 		CreatureObject* player = NULL;
 
+		String key = name.toLowerCase();
+
 		lock(doLock);
 
 		try {
 
-			player = players.get(name.toLowerCase());
+			player = players.get(key);
 
 		} catch (Exception& e) {
 			System::out << e.getMessage();
@@ -67,11 +102,16 @@ public:
 	CreatureObject* remove(const String& name, bool doLock = true) {
 		CreatureObject* player = NULL;
 
+		String key = name.toLowerCase();
+
 		lock(doLock);
 
 		try {
 
-			player = players.remove(name.toLowerCase());
+			player = players.remove(key);
+
+			if (player != NULL)
+				snapshot = NULL;
 
 		} catch (Exception& e) {
 			System::out << e.getMessage();
@@ -87,40 +127,28 @@ public:
 		return player;
 	}
 
-	CreatureObject* getNextValue(bool doLock = true) {
-		CreatureObject* player = NULL;
-
+	/**
+	 * @return the online players as of now, safe to iterate without locks
+	 */
+	Reference<PlayerMapSnapshot*> getSnapshot(bool doLock = true) {
 		lock(doLock);
 
-		player = iter.getNextValue();
+		Reference<PlayerMapSnapshot*> current = snapshot;
 
-		unlock(doLock);
+		if (current == NULL) {
+			current = new PlayerMapSnapshot();
 
-		return player;
-	}
+			HashTableIterator<String, ManagedReference<CreatureObject*> > iter = players.iterator();
 
-	CreatureObject* next(bool doLock = true) {
-		return getNextValue(doLock);
-	}
-
-	bool hasNext(bool doLock = true) {
-		bool res = false;
-
-		lock(doLock);
+			while (iter.hasNext())
+				current->add(iter.getNextValue());
 
-		res = iter.hasNext();
+			snapshot = current;
+		}
 
 		unlock(doLock);
 
-		return res;
-	}
-
-	void resetIterator(bool doLock = true) {
-		lock(doLock);
-
-		iter.resetIterator();
-
-		unlock(doLock);
+		return current;
 	}
 
 	int size(bool doLock = true) {
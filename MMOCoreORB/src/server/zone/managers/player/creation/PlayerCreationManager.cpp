@@ -703,7 +703,7 @@ void PlayerCreationManager::addStartingItems(CreatureObject* creature,
 
 	// Get inventory.
 	if (!equipmentOnly) {
-		SceneObject* inventory = creature->getSlottedObject("inventory");
+		SceneObject* inventory = creature->getKnownSlottedObject(SlotIndex::INVENTORY);
 		if (inventory == NULL) {
 			return;
 		}
@@ -780,7 +780,7 @@ void PlayerCreationManager::addProfessionStartingItems(CreatureObject* creature,
 
 	// Get inventory.
 	if (!equipmentOnly) {
-		SceneObject* inventory = creature->getSlottedObject("inventory");
+		SceneObject* inventory = creature->getKnownSlottedObject(SlotIndex::INVENTORY);
 		if (inventory == NULL) {
 			return;
 		}
@@ -1077,7 +1077,7 @@ void PlayerCreationManager::addRacialMods(CreatureObject* creature,
 
 	// Get inventory.
 	if (!equipmentOnly) {
-		SceneObject* inventory = creature->getSlottedObject("inventory");
+		SceneObject* inventory = creature->getKnownSlottedObject(SlotIndex::INVENTORY);
 		if (inventory == NULL) {
 			return;
 		}
@@ -0,0 +1,90 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#include "gtest/gtest.h"
+
+#include "server/zone/managers/player/MovementQueueManager.h"
+#include "conf/ConfigManager.h"
+
+class MovementQueueManagerTest : public ::testing::Test {
+protected:
+	Vector<int> queues;
+	Vector<String> zones;
+	Vector<int> regions;
+
+public:
+	MovementQueueManagerTest() {
+		for (int i = 3; i <= 6; ++i)
+			queues.add(i);
+	}
+
+	void SetUp() {
+	}
+
+	void TearDown() {
+	}
+
+	void addZone(const String& name, int regionCount) {
+		zones.add(name);
+		regions.add(regionCount);
+	}
+
+	int getTaskQueue(MovementQueueManager& manager, const String& zoneName, float x) {
+		int region = manager.getRegion(zoneName, -8192, 8192, x);
+
+		return manager.getTaskQueue(manager.getDefaultQueueIndex(zoneName, region));
+	}
+};
+
+TEST_F(MovementQueueManagerTest, DefaultConfigKeepsDedicatedPlanetQueues) {
+	ConfigManager config;
+	config.init();
+	config.loadMovementTaskQueues();
+
+	MovementQueueManager manager(*config.getMovementTaskQueues(), *config.getMovementZones(), *config.getMovementZoneRegions(), config.getMovementQueueRebalanceDepth());
+
+	EXPECT_EQ(4, getTaskQueue(manager, "corellia", 0));
+	EXPECT_EQ(5, getTaskQueue(manager, "tatooine", 0));
+	EXPECT_EQ(6, getTaskQueue(manager, "naboo", 0));
+
+	EXPECT_EQ(3, getTaskQueue(manager, "dantooine", 0));
+	EXPECT_EQ(3, getTaskQueue(manager, "tutorial", 0));
+}
+
+TEST_F(MovementQueueManagerTest, RegionsTakeQueuesInConfigOrder) {
+	addZone("tatooine", 2);
+	addZone("corellia", 1);
+	addZone("naboo", 2);
+
+	MovementQueueManager manager(queues, zones, regions, 50);
+
+	EXPECT_EQ(0, manager.getRegion("tatooine", -8192, 8192, -100));
+	EXPECT_EQ(1, manager.getRegion("tatooine", -8192, 8192, 100));
+	EXPECT_EQ(0, manager.getRegion("tatooine", -8192, 8192, -9000));
+	EXPECT_EQ(1, manager.getRegion("tatooine", -8192, 8192, 9000));
+	EXPECT_EQ(0, manager.getRegion("dantooine", -8192, 8192, 100));
+
+	EXPECT_EQ(4, getTaskQueue(manager, "tatooine", -4000));
+	EXPECT_EQ(5, getTaskQueue(manager, "tatooine", 4000));
+	EXPECT_EQ(6, getTaskQueue(manager, "corellia", 4000));
+
+	// more regions than dedicated queues wrap around
+	EXPECT_EQ(4, getTaskQueue(manager, "naboo", -4000));
+	EXPECT_EQ(5, getTaskQueue(manager, "naboo", 4000));
+
+	EXPECT_EQ(3, getTaskQueue(manager, "dantooine", 4000));
+}
+
+TEST_F(MovementQueueManagerTest, SingleQueueTakesEverything) {
+	queues.removeAll();
+	queues.add(3);
+
+	addZone("corellia", 2);
+
+	MovementQueueManager manager(queues, zones, regions, 50);
+
+	EXPECT_EQ(3, getTaskQueue(manager, "corellia", -4000));
+	EXPECT_EQ(3, getTaskQueue(manager, "corellia", 4000));
+	EXPECT_EQ(3, getTaskQueue(manager, "dantooine", 0));
+}
@@ -286,7 +286,7 @@ void ResourceManagerImplementation::getResourceListByType(Vector<ManagedReferenc
 }
 
 uint32 ResourceManagerImplementation::getAvailablePowerFromPlayer(CreatureObject* player) {
-	SceneObject* inventory = player->getSlottedObject("inventory");
+	SceneObject* inventory = player->getKnownSlottedObject(SlotIndex::INVENTORY);
 	uint32 power = 0;
 
 	for (int i = 0; i < inventory->getContainerObjectsSize(); i++) {
@@ -316,7 +316,7 @@ void ResourceManagerImplementation::removePowerFromPlayer(CreatureObject* player
 	if (power == 0)
 		return;
 
-	SceneObject* inventory = player->getSlottedObject("inventory");
+	SceneObject* inventory = player->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 	uint32 containerPower = 0;
 
@@ -367,7 +367,7 @@ void ResourceManagerImplementation::givePlayerResource(CreatureObject* playerCre
 		return;
 	}
 
-	ManagedReference<SceneObject*> inventory = playerCreature->getSlottedObject("inventory");
+	ManagedReference<SceneObject*> inventory = playerCreature->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 	if(inventory != NULL && !inventory->isContainerFullRecursive()) {
 		Locker locker(spawn);
@@ -838,16 +838,21 @@ void ResourceSpawner::sendSurvey(CreatureObject* player, const String& resname)
 
 	float spacer = float(toolRange) / float(points - 1);
 
-	float posX = player->getPositionX() - (((points - 1) / 2.0f) * spacer);
-	float posY = player->getPositionY() + (((points - 1) / 2.0f) * spacer);
+	float startX = player->getPositionX() - (((points - 1) / 2.0f) * spacer);
+	float startY = player->getPositionY() + (((points - 1) / 2.0f) * spacer);
 
 	float maxDensity = -1;
 	float maxX = 0, maxY = 0;
 
+	Vector<float> densities;
+	resourceMap->getDensityGrid(resname, zoneName, startX, startY, spacer, points, &densities);
+
 	for (int i = 0; i < points; i++) {
-		for (int j = 0; j < points; j++) {
+		float posY = startY - i * spacer;
 
-			float density = resourceMap->getDensityAt(resname, zoneName, posX, posY);
+		for (int j = 0; j < points; j++) {
+			float posX = startX + j * spacer;
+			float density = densities.get(i * points + j);
 
 			if (density > maxDensity) {
 				maxDensity = density;
@@ -856,12 +861,7 @@ void ResourceSpawner::sendSurvey(CreatureObject* player, const String& resname)
 			}
 
 			surveyMessage->add(posX, posY, density);
-
-			posX += spacer;
 		}
-
-		posY -= spacer;
-		posX -= (points * spacer);
 	}
 
 	ManagedReference<WaypointObject*> waypoint = NULL;
@@ -1071,7 +1071,7 @@ void ResourceSpawner::sendSampleResults(CreatureObject* player, const float dens
 
 bool ResourceSpawner::addResourceToPlayerInventory(CreatureObject* player, ResourceSpawn* resourceSpawn, int unitsExtracted) {
 	// Add resource to inventory
-	ManagedReference<SceneObject*> inventory = player->getSlottedObject("inventory");
+	ManagedReference<SceneObject*> inventory = player->getKnownSlottedObject(SlotIndex::INVENTORY);
 	Locker locker(inventory);
 	// Check inventory for resource and add if existing
 	for (int i = 0; i < inventory->getContainerObjectsSize(); ++i) {
@@ -42,6 +42,11 @@ float ResourceMap::getDensityAt(const String& resourcename, String zoneName, flo
 	return resourceSpawn->getDensityAt(zoneName, x, y);
 }
 
+void ResourceMap::getDensityGrid(const String& resourcename, const String& zoneName, float x, float y, float spacing, int points, Vector<float>* densities) {
+	ManagedReference<ResourceSpawn* > resourceSpawn = get(resourcename.toLowerCase());
+	resourceSpawn->getDensityGrid(zoneName, x, y, spacing, points, densities);
+}
+
 void ResourceMap::add(const String& resname, ManagedReference<ResourceSpawn* > resourceSpawn) {
 	put(resname.toLowerCase(), resourceSpawn);
 
@@ -105,6 +105,18 @@ public:
 	*/
 	float getDensityAt(const String& resourcename, String zoneName, float x, float y);
 
+	/**
+	 * Get's the density values of resource on a grid in one pass
+	 * \param resourcename The name of the resource
+	 * \param zoneName The zone map name
+	 * \param x The x coordinate of the first column
+	 * \param y The y coordinate of the first row
+	 * \param spacing Distance between the points
+	 * \param points Number of rows and columns
+	 * \param densities Receives the densities row by row
+	*/
+	void getDensityGrid(const String& resourcename, const String& zoneName, float x, float y, float spacing, int points, Vector<float>* densities);
+
 	/**
 	 * Get's the density value of resource at given point
 	 * \param zoneid ID of zone being requesting
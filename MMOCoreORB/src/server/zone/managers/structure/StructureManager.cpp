@@ -1020,7 +1020,7 @@ void StructureManager::promptMaintenanceDroid(StructureObject* structure, Creatu
 		return;
 
 	Vector<DroidObject*> droids;
-	ManagedReference<SceneObject*> datapad = creature->getSlottedObject("datapad");
+	ManagedReference<SceneObject*> datapad = creature->getKnownSlottedObject(SlotIndex::DATAPAD);
 	if(datapad == NULL) {
 		return;
 	}
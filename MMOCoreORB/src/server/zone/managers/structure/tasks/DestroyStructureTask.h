@@ -111,7 +111,7 @@ public:
 				structureObject->getOwnerObjectID());
 
 		if (owner != NULL) {
-			ManagedReference<SceneObject*> ghost = owner->getSlottedObject("ghost");
+			ManagedReference<SceneObject*> ghost = owner->getKnownSlottedObject(SlotIndex::GHOST);
 
 			if (ghost != NULL && ghost->isPlayerObject()) {
 				PlayerObject* playerObject = cast<PlayerObject*>(ghost.get());
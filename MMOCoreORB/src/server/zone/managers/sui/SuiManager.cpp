@@ -463,7 +463,7 @@ void SuiManager::handleCharacterBuilderSelectItem(CreatureObject* player, SuiBox
 				//"object/tangible/wearables/apron/apron_chef_s01.iff"
 				//"object/tangible/wearables/ithorian/apron_chef_jacket_s01_ith.iff"
 
-				ManagedReference<SceneObject*> inventory = player->getSlottedObject("inventory");
+				ManagedReference<SceneObject*> inventory = player->getKnownSlottedObject(SlotIndex::INVENTORY);
 				if (inventory == NULL) {
 					return;
 				}
@@ -598,7 +598,7 @@ void SuiManager::handleCharacterBuilderSelectItem(CreatureObject* player, SuiBox
 			player->sendMessage(cbSui->generateMessage());
 
 		} else { // Items
-			ManagedReference<SceneObject*> inventory = player->getSlottedObject("inventory");
+			ManagedReference<SceneObject*> inventory = player->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 			if (inventory == NULL) {
 				return;
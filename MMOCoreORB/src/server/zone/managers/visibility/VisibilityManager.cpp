@@ -29,7 +29,7 @@ int VisibilityManager::calculateReward(CreatureObject* creature) {
 
 	int reward = minReward;
 
-	Reference<PlayerObject*> ghost = creature->getSlottedObject("ghost").castTo<PlayerObject*>();
+	Reference<PlayerObject*> ghost = creature->getKnownSlottedObject(SlotIndex::GHOST).castTo<PlayerObject*>();
 
 	if (ghost != NULL) {
 		int skillPoints = ghost->getSpentJediSkillPoints();
@@ -87,7 +87,7 @@ float VisibilityManager::calculateVisibilityIncrease(CreatureObject* creature) {
 
 void VisibilityManager::decreaseVisibility(CreatureObject* creature) {
 
-	Reference<PlayerObject*> ghost = creature->getSlottedObject("ghost").castTo<PlayerObject*>();
+	Reference<PlayerObject*> ghost = creature->getKnownSlottedObject(SlotIndex::GHOST).castTo<PlayerObject*>();
 
 	if (ghost != NULL) {
 		Locker locker(ghost);
@@ -120,7 +120,7 @@ VisibilityManager::VisibilityManager() : Logger("VisibilityManager") {
 
 void VisibilityManager::login(CreatureObject* creature) {
 	//info("Logging in " + creature->getFirstName(), true);
-	Reference<PlayerObject*> ghost = creature->getSlottedObject("ghost").castTo<PlayerObject*>();
+	Reference<PlayerObject*> ghost = creature->getKnownSlottedObject(SlotIndex::GHOST).castTo<PlayerObject*>();
 
 	if (ghost != NULL) {
 
@@ -164,7 +164,7 @@ void VisibilityManager::logout(CreatureObject* creature) {
 
 void VisibilityManager::increaseVisibility(CreatureObject* creature, int visibilityMultiplier) {
 	//info("Increasing visibility for " + creature->getFirstName(), true);
-	Reference<PlayerObject*> ghost = creature->getSlottedObject("ghost").castTo<PlayerObject*>();
+	Reference<PlayerObject*> ghost = creature->getKnownSlottedObject(SlotIndex::GHOST).castTo<PlayerObject*>();
 
 	if (ghost != NULL  && !ghost->hasGodMode()) {
 		Locker locker(ghost);
@@ -183,7 +183,7 @@ void VisibilityManager::increaseVisibility(CreatureObject* creature, int visibil
 }
 
 void VisibilityManager::clearVisibility(CreatureObject* creature) {
-	Reference<PlayerObject*> ghost = creature->getSlottedObject("ghost").castTo<PlayerObject*>();
+	Reference<PlayerObject*> ghost = creature->getKnownSlottedObject(SlotIndex::GHOST).castTo<PlayerObject*>();
 
 	if (ghost != NULL  && !ghost->hasGodMode()) {
 		//info("Clearing visibility for player " + String::valueOf(creature->getObjectID()), true);
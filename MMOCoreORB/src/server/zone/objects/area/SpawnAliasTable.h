@@ -0,0 +1,97 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#ifndef SPAWNALIASTABLE_H_
+#define SPAWNALIASTABLE_H_
+
+#include "engine/engine.h"
+
+/**
+ * Walker's alias table over integer weights, picks an index with probability
+ * weight / total weight in constant time. Built with integer arithmetic so
+ * the distribution is exactly the one of a linear scan over the weights.
+ */
+class SpawnAliasTable {
+	// chance out of totalWeight to keep the column instead of its alias
+	Vector<int> thresholds;
+	Vector<int> aliases;
+
+	int totalWeight;
+
+public:
+	SpawnAliasTable() : totalWeight(0) {
+	}
+
+	void build(const Vector<int>& weights) {
+		thresholds.removeAll();
+		aliases.removeAll();
+		totalWeight = 0;
+
+		int count = weights.size();
+
+		for (int i = 0; i < count; ++i)
+			totalWeight += MAX(weights.get(i), 0);
+
+		if (totalWeight <= 0)
+			return;
+
+		// weights scaled by count so the average column holds totalWeight
+		Vector<int64> scaled;
+		Vector<int> small, large;
+
+		for (int i = 0; i < count; ++i) {
+			int64 weight = (int64) MAX(weights.get(i), 0) * count;
+
+			scaled.add(weight);
+			thresholds.add(totalWeight);
+			aliases.add(i);
+
+			if (weight < totalWeight)
+				small.add(i);
+			else
+				large.add(i);
+		}
+
+		while (small.size() > 0 && large.size() > 0) {
+			int less = small.remove(small.size() - 1);
+			int more = large.get(large.size() - 1);
+
+			thresholds.set(less, (int) scaled.get(less));
+			aliases.set(less, more);
+
+			int64 rest = scaled.get(more) + scaled.get(less) - totalWeight;
+			scaled.set(more, rest);
+
+			if (rest < totalWeight) {
+				large.remove(large.size() - 1);
+				small.add(more);
+			}
+		}
+	}
+
+	/**
+	 * @return index of the chosen weight, -1 if every weight is 0
+	 */
+	int choose() const {
+		if (totalWeight <= 0)
+			return -1;
+
+		int column = System::random(thresholds.size() - 1);
+
+		if ((int) System::random(totalWeight - 1) < thresholds.get(column))
+			return column;
+
+		return aliases.get(column);
+	}
+
+	inline int size() const {
+		return thresholds.size();
+	}
+
+	inline int getTotalWeight() const {
+		return totalWeight;
+	}
+};
+
+#endif /* SPAWNALIASTABLE_H_ */
@@ -12,6 +12,7 @@
 #include "server/zone/managers/creature/SpawnGroup.h"
 #include "server/zone/managers/collision/CollisionManager.h"
 #include "server/zone/managers/planet/PlanetManager.h"
+#include "server/zone/managers/planet/BuildabilityMap.h"
 #include "server/zone/objects/area/SpawnAreaObserver.h"
 #include "server/zone/objects/area/areashapes/AreaShape.h"
 #include "server/ServerCore.h"
@@ -33,6 +34,18 @@ void SpawnAreaImplementation::buildSpawnList(Vector<uint32>* groupCRCs) {
 			totalWeighting += spawn->getWeighting();
 		}
 	}
+
+	Vector<int> weights;
+
+	for (int i = 0; i < possibleSpawns.size(); ++i) {
+		LairSpawn* spawn = possibleSpawns.get(i);
+
+		weights.add(spawn->getWeighting());
+
+		maxSpawnSize = MAX(maxSpawnSize, spawn->getSize());
+	}
+
+	spawnTable.build(weights);
 }
 
 Vector3 SpawnAreaImplementation::getRandomPosition(SceneObject* player) {
@@ -43,16 +56,7 @@ Vector3 SpawnAreaImplementation::getRandomPosition(SceneObject* player) {
 	while (!positionFound && retries-- > 0) {
 		position = areaShape->getRandomPosition(player->getWorldPosition(), 64.0f, 256.0f);
 
-		positionFound = true;
-
-		for (int i = 0; i < noSpawnAreas.size(); ++i) {
-			ManagedReference<SpawnArea*> noSpawnArea = noSpawnAreas.get(i).get();
-
-			if (noSpawnArea != NULL && noSpawnArea->containsPoint(position.getX(), position.getY())) {
-				positionFound = false;
-				break;
-			}
-		}
+		positionFound = !isInNoSpawnArea(position.getX(), position.getY());
 	}
 
 	if (!positionFound) {
@@ -62,6 +66,87 @@ Vector3 SpawnAreaImplementation::getRandomPosition(SceneObject* player) {
 	return position;
 }
 
+bool SpawnAreaImplementation::isInNoSpawnArea(float x, float y) {
+	for (int i = 0; i < noSpawnAreas.size(); ++i) {
+		ManagedReference<SpawnArea*> noSpawnArea = noSpawnAreas.get(i).get();
+
+		if (noSpawnArea != NULL && noSpawnArea->containsPoint(x, y))
+			return true;
+	}
+
+	return false;
+}
+
+SpawnPositionPool* SpawnAreaImplementation::getSpawnPool() {
+	return &spawnPool;
+}
+
+void SpawnAreaImplementation::scheduleSpawnPoolRefill(const Vector3& origin) {
+	if (refillScheduled)
+		return;
+
+	refillScheduled = true;
+
+	ManagedReference<SpawnArea*> area = _this.getReferenceUnsafeStaticCast();
+	Vector3 refillOrigin = origin;
+
+	// the checks of a refill touch the terrain and the zone trees, keep them off the spawning threads
+	Core::getTaskManager()->executeTask([area, refillOrigin] {
+		area->refillSpawnPool(refillOrigin);
+	}, "RefillSpawnPool", "SpawnPool");
+}
+
+void SpawnAreaImplementation::refillSpawnPool(const Vector3& origin) {
+	// runs unlocked, areaShape and noSpawnAreas are only set while the spawn areas load and never change after
+	Zone* zone = getZone();
+
+	ManagedReference<PlanetManager*> planetManager = zone != NULL ? zone->getPlanetManager() : NULL;
+
+	Vector<SpawnPositionPool::Entry> entries;
+	int attempts = 0;
+
+	if (planetManager != NULL) {
+		BuildabilityMap* buildabilityMap = zone->getBuildabilityMap();
+		float margin = maxSpawnSize + 64.f;
+
+		while (attempts < SpawnPositionPool::REFILLATTEMPTS && entries.size() < SpawnPositionPool::REFILLSIZE) {
+			++attempts;
+
+			Vector3 position = areaShape->getRandomPosition(origin, 64.0f, 256.0f);
+
+			if (isInNoSpawnArea(position.getX(), position.getY()))
+				continue;
+
+			// taken before the checks so anything that changes while they run drops the position
+			int revision = buildabilityMap->getRevision(position.getX(), position.getY());
+
+			if (revision == -1)
+				continue;
+
+			if (!planetManager->isSpawningPermittedAt(position.getX(), position.getY(), margin))
+				continue;
+
+			position.setZ(zone->getHeight(position.getX(), position.getY()));
+
+			entries.add(SpawnPositionPool::Entry(position, revision));
+		}
+	}
+
+	Locker locker(_this.getReferenceUnsafeStaticCast());
+
+	for (int i = 0; i < entries.size(); ++i)
+		spawnPool.add(entries.get(i));
+
+	spawnPool.addRefill(attempts, entries.size());
+
+	refillScheduled = false;
+
+	StringBuffer msg;
+	msg << "spawn pool refilled with " << entries.size() << " positions in " << attempts << " attempts, "
+			<< spawnPool.getHits() << " hits " << spawnPool.getMisses() << " misses " << spawnPool.getStale() << " stale";
+	debug(msg.toString());
+}
+
 int SpawnAreaImplementation::notifyObserverEvent(unsigned int eventType, Observable* observable, ManagedObject* arg1, int64 arg2) {
 	if (eventType != ObserverEventType::OBJECTREMOVEDFROMZONE)
 		return 0;
@@ -124,44 +209,50 @@ void SpawnAreaImplementation::tryToSpawn(SceneObject* object) {
 	if (lastSpawn.miliDifference() < MINSPAWNINTERVAL)
 		return;
 
-	int choice = System::random(totalWeighting - 1);
-	int counter = 0;
+	int choice = spawnTable.choose();
+
+	if (choice == -1)
+		return;
+
+	LairSpawn* finalSpawn = possibleSpawns.get(choice);
 
-	LairSpawn* finalSpawn = NULL;
+	Vector3 randomPosition;
+	float spawnZ = 0;
 
-	for (int i = 0; i < possibleSpawns.size(); i++) {
-		LairSpawn* spawn = possibleSpawns.get(i);
+	// the buildability map only tracks changes for margins up to MAXMARGIN
+	if (maxSpawnSize + 64.f <= BuildabilityMap::MAXMARGIN) {
+		Vector3 origin = object->getWorldPosition();
 
-		counter += spawn->getWeighting();
+		bool found = spawnPool.take(origin, 64.f, 256.f, zone->getBuildabilityMap(), randomPosition);
 
-		if (choice < counter) {
-			finalSpawn = spawn;
-			break;
-		}
-	}
+		if (!found || spawnPool.size() < SpawnPositionPool::LOWWATER)
+			scheduleSpawnPoolRefill(origin);
 
-	if (finalSpawn == NULL)
-		return;
+		if (!found)
+			return;
 
-	ManagedReference<PlanetManager*> planetManager = zone->getPlanetManager();
+		spawnZ = randomPosition.getZ();
+	} else {
+		ManagedReference<PlanetManager*> planetManager = zone->getPlanetManager();
 
-	Vector3 randomPosition = getRandomPosition(object);
+		randomPosition = getRandomPosition(object);
 
-	if (randomPosition.getX() == 0 && randomPosition.getY() == 0) {
-		return;
-	}
+		if (randomPosition.getX() == 0 && randomPosition.getY() == 0) {
+			return;
+		}
 
-	float spawnZ = zone->getHeight(randomPosition.getX(), randomPosition.getY());
+		spawnZ = zone->getHeight(randomPosition.getX(), randomPosition.getY());
 
-	randomPosition.setZ(spawnZ);
+		randomPosition.setZ(spawnZ);
 
-	//lets check if we intersect with some object (buildings, etc..)
-	//if (CollisionManager::checkSphereCollision(randomPosition, 64.f + finalSpawn->getSize(), zone))
-	//	return;
+		//lets check if we intersect with some object (buildings, etc..)
+		//if (CollisionManager::checkSphereCollision(randomPosition, 64.f + finalSpawn->getSize(), zone))
+		//	return;
 
-	// Check the spot to see if spawning is allowed
-	if (!planetManager->isSpawningPermittedAt(randomPosition.getX(), randomPosition.getY(), finalSpawn->getSize() + 64.f)) {
-		return;
+		// Check the spot to see if spawning is allowed
+		if (!planetManager->isSpawningPermittedAt(randomPosition.getX(), randomPosition.getY(), finalSpawn->getSize() + 64.f)) {
+			return;
+		}
 	}
 
 	int spawnLimit = finalSpawn->getSpawnLimit();
@@ -0,0 +1,135 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#ifndef SPAWNPOSITIONPOOL_H_
+#define SPAWNPOSITIONPOOL_H_
+
+#include "engine/engine.h"
+
+#include "server/zone/managers/planet/BuildabilityMap.h"
+
+/**
+ * Positions of a spawn area that already passed the spawn checks, each kept
+ * with the buildability map revision of its cell when it was checked. A
+ * structure, city or no spawn area showing up near a position changes that
+ * revision and the position is dropped the next time it is looked at.
+ */
+class SpawnPositionPool {
+public:
+	const static int MAXSIZE = 32;
+
+	// refill below this many positions
+	const static int LOWWATER = 8;
+
+	// positions a refill looks for and the random points it tries at most
+	const static int REFILLSIZE = 8;
+	const static int REFILLATTEMPTS = 40;
+
+	class Entry {
+	public:
+		Vector3 position;
+		int revision;
+
+		Entry() : revision(-1) {
+		}
+
+		Entry(const Vector3& position, int revision) : position(position), revision(revision) {
+		}
+	};
+
+protected:
+	Vector<Entry> entries;
+
+	int hits;
+	int misses;
+	int stale;
+
+	int refills;
+	int refillAttempts;
+	int refilledPositions;
+
+public:
+	SpawnPositionPool() : hits(0), misses(0), stale(0), refills(0), refillAttempts(0), refilledPositions(0) {
+	}
+
+	void add(const Entry& entry) {
+		if (entries.size() >= MAXSIZE)
+			entries.remove(0);
+
+		entries.add(entry);
+	}
+
+	/**
+	 * Removes a valid position between minDistance and maxDistance of origin
+	 * @return false if the pool has none
+	 */
+	bool take(const Vector3& origin, float minDistance, float maxDistance, BuildabilityMap* map, Vector3& position) {
+		float minSquared = minDistance * minDistance;
+		float maxSquared = maxDistance * maxDistance;
+
+		for (int i = entries.size() - 1; i >= 0; --i) {
+			const Entry& entry = entries.get(i);
+
+			float deltaX = entry.position.getX() - origin.getX();
+			float deltaY = entry.position.getY() - origin.getY();
+			float distanceSquared = deltaX * deltaX + deltaY * deltaY;
+
+			if (distanceSquared < minSquared || distanceSquared > maxSquared)
+				continue;
+
+			if (map->getRevision(entry.position.getX(), entry.position.getY()) != entry.revision) {
+				entries.remove(i);
+				++stale;
+
+				continue;
+			}
+
+			position = entry.position;
+			entries.remove(i);
+			++hits;
+
+			return true;
+		}
+
+		++misses;
+
+		return false;
+	}
+
+	void addRefill(int attempts, int positions) {
+		++refills;
+		refillAttempts += attempts;
+		refilledPositions += positions;
+	}
+
+	inline int size() const {
+		return entries.size();
+	}
+
+	inline int getHits() const {
+		return hits;
+	}
+
+	inline int getMisses() const {
+		return misses;
+	}
+
+	inline int getStale() const {
+		return stale;
+	}
+
+	inline int getRefills() const {
+		return refills;
+	}
+
+	inline int getRefillAttempts() const {
+		return refillAttempts;
+	}
+
+	inline int getRefilledPositions() const {
+		return refilledPositions;
+	}
+};
+
+#endif /* SPAWNPOSITIONPOOL_H_ */
@@ -0,0 +1,102 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#include "gtest/gtest.h"
+
+#include "server/zone/objects/area/SpawnAliasTable.h"
+
+class SpawnAliasTableTest : public ::testing::Test {
+public:
+	const static int SAMPLES = 200000;
+
+	void expectDistribution(const Vector<int>& weights) {
+		SpawnAliasTable table;
+		table.build(weights);
+
+		int total = 0;
+
+		for (int i = 0; i < weights.size(); ++i)
+			total += weights.get(i);
+
+		ASSERT_EQ(total, table.getTotalWeight());
+
+		Vector<int> counts;
+
+		for (int i = 0; i < weights.size(); ++i)
+			counts.add(0);
+
+		for (int i = 0; i < SAMPLES; ++i) {
+			int choice = table.choose();
+
+			ASSERT_TRUE(choice >= 0 && choice < weights.size());
+
+			counts.set(choice, counts.get(choice) + 1);
+		}
+
+		for (int i = 0; i < weights.size(); ++i) {
+			if (weights.get(i) == 0)
+				EXPECT_EQ(0, counts.get(i));
+			else
+				EXPECT_NEAR(weights.get(i) / (float) total, counts.get(i) / (float) SAMPLES, 0.01) << "weight " << i;
+		}
+	}
+};
+
+TEST_F(SpawnAliasTableTest, EmptyTableChoosesNothing) {
+	SpawnAliasTable table;
+
+	EXPECT_EQ(-1, table.choose());
+
+	Vector<int> weights;
+	weights.add(0);
+	weights.add(0);
+
+	table.build(weights);
+
+	EXPECT_EQ(-1, table.choose());
+}
+
+TEST_F(SpawnAliasTableTest, SingleWeightIsAlwaysChosen) {
+	Vector<int> weights;
+	weights.add(7);
+
+	SpawnAliasTable table;
+	table.build(weights);
+
+	for (int i = 0; i < 100; ++i)
+		EXPECT_EQ(0, table.choose());
+}
+
+TEST_F(SpawnAliasTableTest, ChoicesFollowTheWeights) {
+	Vector<int> weights;
+	weights.add(1);
+	weights.add(5);
+	weights.add(0);
+	weights.add(14);
+	weights.add(80);
+	weights.add(5);
+
+	expectDistribution(weights);
+}
+
+TEST_F(SpawnAliasTableTest, RebuildReplacesTheWeights) {
+	Vector<int> weights;
+	weights.add(10);
+	weights.add(90);
+
+	SpawnAliasTable table;
+	table.build(weights);
+
+	weights.removeAll();
+	weights.add(0);
+	weights.add(0);
+	weights.add(3);
+
+	table.build(weights);
+
+	EXPECT_EQ(3, table.size());
+
+	for (int i = 0; i < 100; ++i)
+		EXPECT_EQ(2, table.choose());
+}
@@ -0,0 +1,113 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#include "gtest/gtest.h"
+
+#include "server/zone/objects/area/SpawnPositionPool.h"
+
+class SpawnPositionPoolTest : public ::testing::Test {
+public:
+	const static int SIZE = 4096;
+
+	BuildabilityMap map;
+	SpawnPositionPool pool;
+
+	void SetUp() {
+		map.initialize(SIZE, NULL, NULL);
+	}
+
+	/**
+	 * Adds x, y with the revision its cell has now, the way a refill does
+	 */
+	void addPosition(float x, float y) {
+		pool.add(SpawnPositionPool::Entry(Vector3(x, y, 0), map.getRevision(x, y)));
+	}
+};
+
+TEST_F(SpawnPositionPoolTest, TakeDropsPositionsOfChangedCells) {
+	Vector3 origin(0, 0, 0);
+	Vector3 position;
+
+	addPosition(-200, 0);
+	addPosition(200, 0);
+
+	// a structure shows up next to the newer position
+	map.touch(200, 0, 0);
+
+	ASSERT_TRUE(pool.take(origin, 64, 256, &map, position));
+	EXPECT_EQ(-200, position.getX());
+
+	EXPECT_EQ(1, pool.getStale());
+	EXPECT_EQ(1, pool.getHits());
+	EXPECT_EQ(0, pool.size());
+
+	EXPECT_FALSE(pool.take(origin, 64, 256, &map, position));
+	EXPECT_EQ(1, pool.getMisses());
+}
+
+TEST_F(SpawnPositionPoolTest, TakeKeepsPositionsOutOfRange) {
+	Vector3 position;
+
+	addPosition(10, 0);
+	addPosition(1000, 0);
+
+	EXPECT_FALSE(pool.take(Vector3(0, 0, 0), 64, 256, &map, position));
+
+	// still valid for a player somewhere else
+	EXPECT_EQ(2, pool.size());
+	EXPECT_EQ(0, pool.getStale());
+	EXPECT_EQ(1, pool.getMisses());
+
+	ASSERT_TRUE(pool.take(Vector3(900, 0, 0), 64, 256, &map, position));
+	EXPECT_EQ(1000, position.getX());
+}
+
+TEST_F(SpawnPositionPoolTest, FullPoolDropsOldestPositions) {
+	const int extra = 4;
+
+	for (int i = 0; i < SpawnPositionPool::MAXSIZE + extra; ++i)
+		addPosition(100 + i, 0);
+
+	EXPECT_EQ(SpawnPositionPool::MAXSIZE, pool.size());
+
+	Vector3 position;
+
+	for (int i = 0; i < SpawnPositionPool::MAXSIZE; ++i) {
+		ASSERT_TRUE(pool.take(Vector3(0, 0, 0), 64, 256, &map, position));
+		EXPECT_GE(position.getX(), 100 + extra);
+	}
+
+	EXPECT_EQ(0, pool.size());
+}
+
+TEST_F(SpawnPositionPoolTest, RefillReplacesInvalidatedPositions) {
+	Vector3 origin(0, 0, 0);
+	Vector3 position;
+
+	for (int i = 0; i < SpawnPositionPool::REFILLSIZE; ++i)
+		addPosition(100 + i * 10, 50);
+
+	// a city shows up over all of them
+	map.touch(0, 0, 400);
+
+	EXPECT_FALSE(pool.take(origin, 64, 256, &map, position));
+	EXPECT_EQ(SpawnPositionPool::REFILLSIZE, pool.getStale());
+	EXPECT_LT(pool.size(), SpawnPositionPool::LOWWATER);
+
+	// positions checked after the change carry the new revisions
+	for (int i = 0; i < SpawnPositionPool::REFILLSIZE; ++i)
+		addPosition(100 + i * 10, 50);
+
+	pool.addRefill(SpawnPositionPool::REFILLATTEMPTS, SpawnPositionPool::REFILLSIZE);
+
+	EXPECT_EQ(1, pool.getRefills());
+	EXPECT_EQ(SpawnPositionPool::REFILLATTEMPTS, pool.getRefillAttempts());
+	EXPECT_EQ(SpawnPositionPool::REFILLSIZE, pool.getRefilledPositions());
+
+	for (int i = 0; i < SpawnPositionPool::REFILLSIZE; ++i)
+		EXPECT_TRUE(pool.take(origin, 64, 256, &map, position));
+
+	EXPECT_EQ(SpawnPositionPool::REFILLSIZE, pool.getHits());
+	EXPECT_EQ(SpawnPositionPool::REFILLSIZE, pool.getStale());
+}
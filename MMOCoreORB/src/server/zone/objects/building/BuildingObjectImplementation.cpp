@@ -644,7 +644,7 @@ void BuildingObjectImplementation::broadcastCellPermissions() {
 		if (obj->isPlayerCreature())
 			updateCellPermissionsTo(cast<CreatureObject*>(obj.get()));
 		else if (obj->isVehicleObject() || obj->isMount()) {
-			SceneObject* rider = obj->getSlottedObject("rider");
+			SceneObject* rider = obj->getKnownSlottedObject(SlotIndex::RIDER);
 
 			if (rider != NULL && rider->isPlayerCreature()) {
 				updateCellPermissionsTo(cast<CreatureObject*>(rider));
@@ -673,7 +673,7 @@ void BuildingObjectImplementation::broadcastCellPermissions(uint64 objectid) {
 			CreatureObject* creo = obj.castTo<CreatureObject*>();
 			cell->sendPermissionsTo(creo, isAllowedEntry(creo));
 		} else if (obj->isVehicleObject() || obj->isMount()) {
-			SceneObject* rider = obj->getSlottedObject("rider");
+			SceneObject* rider = obj->getKnownSlottedObject(SlotIndex::RIDER);
 
 			if (rider != NULL && rider->isPlayerCreature()) {
 				CreatureObject* creo = cast<CreatureObject*>(rider);
@@ -479,7 +479,7 @@ void CreatureObjectImplementation::clearQueueActions(bool combatOnly) {
 void CreatureObjectImplementation::setWeapon(WeaponObject* weao,
 		bool notifyClient) {
 	if (weao == NULL)
-		weao = TangibleObjectImplementation::getSlottedObject("default_weapon").castTo<WeaponObject*>();
+		weao = TangibleObjectImplementation::getKnownSlottedObject(SlotIndex::DEFAULT_WEAPON).castTo<WeaponObject*>();
 
 	weapon = weao;
 
@@ -2778,6 +2778,13 @@ void CreatureObjectImplementation::sendMessage(BasePacket* msg) {
 	}
 }
 
+void CreatureObjectImplementation::sendSharedMessage(SharedPacket* packet) {
+	ManagedReference<ZoneClientSession*> ownerClient = owner.get();
+
+	if (ownerClient != NULL)
+		ownerClient->sendSharedMessage(packet);
+}
+
 void CreatureObjectImplementation::sendStateCombatSpam(const String& fileName, const String& stringName, byte color, int damage, bool broadcast) {
 	Zone* zone = getZone();
 	if (zone == NULL)
@@ -2841,7 +2848,7 @@ void CreatureObjectImplementation::sendExecuteConsoleCommand(
 }
 
 Reference<PlayerObject*> CreatureObjectImplementation::getPlayerObject() {
-	return getSlottedObject("ghost").castTo<PlayerObject*> ();
+	return getKnownSlottedObject(SlotIndex::GHOST).castTo<PlayerObject*> ();
 }
 
 bool CreatureObjectImplementation::isAggressiveTo(CreatureObject* object) {
@@ -3199,7 +3206,7 @@ float CreatureObjectImplementation::calculateCostAdjustment(uint8 stat, float ba
 
 Reference<WeaponObject*> CreatureObjectImplementation::getWeapon() {
 	if (weapon == NULL) {
-		return TangibleObjectImplementation::getSlottedObject("default_weapon").castTo<WeaponObject*>();
+		return TangibleObjectImplementation::getKnownSlottedObject(SlotIndex::DEFAULT_WEAPON).castTo<WeaponObject*>();
 	} else
 		return weapon;
 }
@@ -687,7 +687,7 @@ int LuaCreatureObject::setLootRights(lua_State* L) {
 		ownerID = player->getObjectID();
 	}
 
-	SceneObject* inventory = realObject->getSlottedObject("inventory");
+	SceneObject* inventory = realObject->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 	if (inventory == NULL)
 		return 0;
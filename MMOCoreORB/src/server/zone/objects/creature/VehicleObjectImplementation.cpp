@@ -290,3 +290,10 @@ void VehicleObjectImplementation::sendMessage(BasePacket* msg) {
 		delete msg;
 }
 
+void VehicleObjectImplementation::sendSharedMessage(SharedPacket* packet) {
+	ManagedReference<CreatureObject* > linkedCreature = this->linkedCreature.get();
+
+	if (linkedCreature != NULL && linkedCreature->getParent().get() == _this.getReferenceUnsafeStaticCast())
+		linkedCreature->sendSharedMessage(packet);
+}
+
@@ -95,6 +95,7 @@
 #include "server/zone/objects/creature/events/DespawnCreatureTask.h"
 #include "server/zone/objects/creature/events/RespawnCreatureTask.h"
 #include "server/zone/objects/creature/ai/PatrolPoint.h"
+#include "server/zone/objects/creature/ai/AiLevelOfDetail.h"
 #include "server/zone/objects/creature/ai/PatrolPointsVector.h"
 #include "server/zone/objects/creature/ai/variables/CreatureAttackMap.h"
 #include "server/zone/objects/creature/ai/variables/CreatureTemplateReference.h"
@@ -216,7 +217,7 @@ void AiAgentImplementation::loadTemplateData(CreatureTemplate* templateData) {
 	else
 		readyWeapon = NULL;
 
-	Reference<WeaponObject*> defaultWeapon = getSlottedObject("default_weapon").castTo<WeaponObject*>();
+	Reference<WeaponObject*> defaultWeapon = getKnownSlottedObject(SlotIndex::DEFAULT_WEAPON).castTo<WeaponObject*>();
 	if (defaultWeapon != NULL) {
 		// set the damage of the default weapon
 		defaultWeapon->setMinDamage(minDmg);
@@ -371,7 +372,7 @@ void AiAgentImplementation::setupAttackMaps() {
 
 	ZoneServer* zoneServer;
 	ObjectController* objectController;
-	Reference<WeaponObject*> defaultWeapon = getSlottedObject("default_weapon").castTo<WeaponObject*>();
+	Reference<WeaponObject*> defaultWeapon = getKnownSlottedObject(SlotIndex::DEFAULT_WEAPON).castTo<WeaponObject*>();
 
 	if ((zoneServer = getZoneServer()) != NULL && (objectController = zoneServer->getObjectController()) != NULL) {
 		attackMap = new CreatureAttackMap();
@@ -444,7 +445,7 @@ void AiAgentImplementation::setLevel(int lvl, bool randomHam) {
 		}
 	}
 
-	Reference<WeaponObject*> defaultWeapon = getSlottedObject("default_weapon").castTo<WeaponObject*>();
+	Reference<WeaponObject*> defaultWeapon = getKnownSlottedObject(SlotIndex::DEFAULT_WEAPON).castTo<WeaponObject*>();
 	if (defaultWeapon != NULL) {
 		defaultWeapon->setMinDamage(minDmg);
 		defaultWeapon->setMaxDamage(maxDmg);
@@ -497,7 +498,7 @@ void AiAgentImplementation::notifyPositionUpdate(QuadTreeEntry* entry) {
 	CreatureObject* creo = object->asCreatureObject();
 
 	if (creo != NULL && creo->isPlayerCreature() && !creo->isInvisible()) {
-		activateAwarenessEvent();
+		activateAwarenessEvent(AiLevelOfDetail::getAwarenessInterval(levelOfDetail));
 	}
 }
 
@@ -679,12 +680,17 @@ void AiAgentImplementation::doAwarenessCheck() {
 	SortedVector<QuadTreeEntry*> closeObjects;
 	vec->safeCopyTo(closeObjects);
 
-	Behavior* current = behaviors.get(currentBehaviorID);
+	// keeps the nodes alive if the agent gets a new tree meanwhile
+	Reference<BehaviorTree*> tree = behaviorTree;
+	Behavior* current = tree != NULL ? tree->getBehavior(currentBehaviorID) : NULL;
 
 	if (current != NULL) {
 		AiAgent* thisObject = asAiAgent();
 		newPlayerCount = 0;
 
+		Vector3 worldPosition = getWorldPosition();
+		float nearestPlayerSquared = -1;
+
 		for (int i = 0; i < closeObjects.size(); ++i) {
 			SceneObject* scene = static_cast<SceneObject*>(closeObjects.get(i));
 
@@ -698,13 +704,30 @@ void AiAgentImplementation::doAwarenessCheck() {
 
 			//Locker crossLocker(target, thisObject); lets do dirty reads
 
-			if (target->isPlayerCreature() && !target->isInvisible())
+			if (target->isPlayerCreature() && !target->isInvisible()) {
 				++newPlayerCount;
 
-			if (current->doAwarenessCheck(target)) {
+				float distanceSquared = worldPosition.squaredDistanceTo(target->getWorldPosition());
+
+				if (nearestPlayerSquared < 0 || distanceSquared < nearestPlayerSquared)
+					nearestPlayerSquared = distanceSquared;
+			}
+
+			if (current->doAwarenessCheck(thisObject, target)) {
 				interrupt(target, ObserverEventType::OBJECTINRANGEMOVED);
 			}
 		}
+
+		if (newPlayerCount > 0) {
+			int radius = getAggroRadius();
+
+			if (radius == 0)
+				radius = DEFAULTAGGRORADIUS;
+
+			// players are noticed at up to twice the aggro radius, see runAwarenessLogicCheck
+			levelOfDetail = AiLevelOfDetail::getTier(nearestPlayerSquared, radius * 2 * 1.2f, levelOfDetail);
+		} else
+			levelOfDetail = AiLevelOfDetail::FAR;
 	}
 
 	if (newPlayerCount != -1) {
@@ -716,7 +739,7 @@ void AiAgentImplementation::doAwarenessCheck() {
 	}
 
 	if (numberOfPlayersInRange.get() > 0)
-		activateAwarenessEvent();
+		activateAwarenessEvent(AiLevelOfDetail::getAwarenessInterval(levelOfDetail));
 }
 
 void AiAgentImplementation::doRecovery(int latency) {
@@ -957,7 +980,7 @@ int AiAgentImplementation::handleObjectMenuSelect(CreatureObject* player, byte s
 
 void AiAgentImplementation::selectWeapon() {
 	WeaponObject* finalWeap = NULL;
-	ManagedReference<WeaponObject*> defaultWeapon = getSlottedObject("default_weapon").castTo<WeaponObject*>();
+	ManagedReference<WeaponObject*> defaultWeapon = getKnownSlottedObject(SlotIndex::DEFAULT_WEAPON).castTo<WeaponObject*>();
 
 	if (getUseRanged()) {
 		if (readyWeapon != NULL && readyWeapon->isRangedWeapon()) {
@@ -1015,7 +1038,7 @@ void AiAgentImplementation::selectWeapon() {
 
 void AiAgentImplementation::selectDefaultWeapon() {
 	ManagedReference<WeaponObject*> currentWeapon = getWeapon();
-	ManagedReference<WeaponObject*> defaultWeapon = getSlottedObject("default_weapon").castTo<WeaponObject*>();
+	ManagedReference<WeaponObject*> defaultWeapon = getKnownSlottedObject(SlotIndex::DEFAULT_WEAPON).castTo<WeaponObject*>();
 
 	if (currentWeapon != NULL && currentWeapon != defaultWeapon)
 		currentWeapon->destroyObjectFromWorld(false);
@@ -1340,7 +1363,7 @@ void AiAgentImplementation::notifyDespawn(Zone* zone) {
 		marker->destroyObjectFromWorld(false);
 	}
 
-	SceneObject* creatureInventory = getSlottedObject("inventory");
+	SceneObject* creatureInventory = getKnownSlottedObject(SlotIndex::INVENTORY);
 
 	if (creatureInventory != NULL) {
 		Locker clocker(creatureInventory, asAiAgent());
@@ -1372,7 +1395,7 @@ void AiAgentImplementation::notifyDespawn(Zone* zone) {
 	locker.release();
 
 	//Delete all loot out of inventory
-	ManagedReference<SceneObject*> inventory = getSlottedObject("inventory");
+	ManagedReference<SceneObject*> inventory = getKnownSlottedObject(SlotIndex::INVENTORY);
 
 	if (inventory != NULL) {
 		while (inventory->getContainerObjectsSize() > 0) {
@@ -1616,7 +1639,10 @@ bool AiAgentImplementation::findNextPosition(float maxDistance, bool walk) {
 	if(hasState(CreatureState::FROZEN))
 		newSpeed = 0.01f;
 
-	float updateTicks = float(UPDATEMOVEMENTINTERVAL) / 1000.f;
+	// far from players the steps get longer and fewer, the speed stays the same
+	int movementInterval = getMovementInterval();
+
+	float updateTicks = float(movementInterval) / 1000.f;
 
 	float maxSpeed = newSpeed*updateTicks; // now maxSpeed is the distance able to travel in time updateTicks
 
@@ -1861,7 +1887,7 @@ bool AiAgentImplementation::findNextPosition(float maxDistance, bool walk) {
 
 		float dist = fabs(thisWorldPos.distanceTo(nextWorldPos));
 		if (dist > 0 && newSpeed > 0.1) {
-			nextMovementInterval = MIN((int)((MIN(dist, maxDist)/newSpeed)*1000 + 0.5), UPDATEMOVEMENTINTERVAL);
+			nextMovementInterval = MIN((int)((MIN(dist, maxDist)/newSpeed)*1000 + 0.5), movementInterval);
 			currentSpeed = newSpeed;
 		} else
 			currentSpeed = 0;
@@ -1903,28 +1929,9 @@ float AiAgentImplementation::getWorldZ(const Vector3& position) {
 
 	IntersectionResults intersections;
 
-	if (closeobjects != NULL) {
-		Vector<QuadTreeEntry*> closeObjects(closeobjects->size(), 10);
-
-		closeobjects->safeCopyTo(closeObjects);
-
-		CollisionManager::getWorldFloorCollisions(position.getX(), position.getY(), zone, &intersections, closeObjects);
-
-		ret = zone->getPlanetManager()->findClosestWorldFloor(position.getX(), position.getY(), position.getZ(), getSwimHeight(), &intersections, NULL);
-	} else {
-		SortedVector<ManagedReference<QuadTreeEntry*> > closeObjects;
-
-#ifdef COV_DEBUG
-		zone->info("Null closeobjects vector in AiAgentImplementation::getWorldZ", true);
-#endif
-
-		Vector3 worldPosition = getWorldPosition();
-		zone->getInRangeObjects(worldPosition.getX(), worldPosition.getY(), 128, &closeObjects, true);
+	CollisionManager::getWorldFloorCollisions(position.getX(), position.getY(), zone, &intersections);
 
-		CollisionManager::getWorldFloorCollisions(position.getX(), position.getY(), zone, &intersections, closeObjects);
-
-		ret = zone->getPlanetManager()->findClosestWorldFloor(position.getX(), position.getY(), position.getZ(), getSwimHeight(), &intersections, NULL);
-	}
+	ret = zone->getPlanetManager()->findClosestWorldFloor(position.getX(), position.getY(), position.getZ(), getSwimHeight(), &intersections, NULL);
 
 	return ret;
 }
@@ -1947,9 +1954,10 @@ void AiAgentImplementation::doMovement() {
 
 	//info("Performing action ID: " + currentBehaviorID, true);
 	// activate AI
-	Behavior* current = behaviors.get(currentBehaviorID);
+	Reference<BehaviorTree*> tree = behaviorTree;
+	Behavior* current = tree != NULL ? tree->getBehavior(currentBehaviorID) : NULL;
 	if (current != NULL)
-		current->doAction(true);
+		current->doAction(asAiAgent(), true);
 
 /*	Time endTime;
 	endTime.updateToCurrentTime();*/
@@ -2138,7 +2146,7 @@ bool AiAgentImplementation::isScentMasked(CreatureObject* target) {
 
 	// Check masked scent
 	if (target->isVehicleObject() || target->isMount()) {
-		effectiveTarget = target->getSlottedObject("rider").castTo<CreatureObject*>();
+		effectiveTarget = target->getKnownSlottedObject(SlotIndex::RIDER).castTo<CreatureObject*>();
 	}
 
 	if (effectiveTarget == NULL)
@@ -2196,7 +2204,7 @@ bool AiAgentImplementation::isConcealed(CreatureObject* target) {
 
 	// Check masked scent
 	if (target->isVehicleObject() || target->isMount()) {
-		effectiveTarget = target->getSlottedObject("rider").castTo<CreatureObject*>();
+		effectiveTarget = target->getKnownSlottedObject(SlotIndex::RIDER).castTo<CreatureObject*>();
 	}
 
 	if (effectiveTarget == NULL)
@@ -2282,7 +2290,17 @@ void AiAgentImplementation::activateMovementEvent() {
 
 	}
 
-	nextMovementInterval = UPDATEMOVEMENTINTERVAL;
+	nextMovementInterval = getMovementInterval();
+}
+
+int AiAgentImplementation::getMovementInterval() {
+	int tier = levelOfDetail;
+
+	// anything the agent is engaged with gets full rate wherever the players are
+	if (getFollowObject().get() != NULL || isRetreating() || isFleeing() || isInCombat())
+		tier = AiLevelOfDetail::NEAR;
+
+	return UPDATEMOVEMENTINTERVAL * AiLevelOfDetail::getScale(tier);
 }
 
 void AiAgentImplementation::activateWaitEvent() {
@@ -2701,7 +2719,7 @@ bool AiAgentImplementation::isAggressiveTo(CreatureObject* target) {
 }
 
 bool AiAgentImplementation::hasLoot(){
-	SceneObject* inventory = getSlottedObject("inventory");
+	SceneObject* inventory = getKnownSlottedObject(SlotIndex::INVENTORY);
 
 	if(inventory == NULL)
 		return false;
@@ -2729,80 +2747,20 @@ void AiAgentImplementation::setupBehaviorTree(AiTemplate* aiTemplate) {
 		return;
 	}
 
-	Vector<Reference<LuaAiTemplate*> >* treeTemplate = aiTemplate->getTree();
-
 	stopWaiting();
 	setWait(0);
 
-	behaviors.put(0, NULL);
-
-	VectorMap<uint32, Vector<uint32> > parents; // id's keyed by parents
-	parents.setAllowOverwriteInsertPlan();
-
-	// first build the maps
-	for (int i=0; i < treeTemplate->size(); i++) {
-		LuaAiTemplate* temp = treeTemplate->get(i).get();
-		if (temp == NULL) {
-			error("Null AI template, contact dannuic if this occurs"); // FIXME (dannuic): Is this still happening?
-			continue;
-		}
-
-		Behavior* behavior = AiMap::createNewInstance(asAiAgent(), temp->className, temp->classType);
-		behavior->setID(temp->id);
-		behaviors.put(temp->id, behavior);
-
-		Vector<uint32> ids = parents.get(temp->parent);
-		ids.add(temp->id);
-		parents.put(temp->parent, ids);
-	}
+	Reference<BehaviorTree*> tree = AiMap::instance()->getBehaviorTree(aiTemplate);
 
-	// now set parents
-	for (int i = 0; i < parents.size(); i++) {
-		VectorMapEntry<uint32, Vector<uint32> >& element = parents.elementAt(i);
-		if (element.getKey() == STRING_HASHCODE("none")) // this is the parent of the root node, just skip it.
-			continue;
-
-		Behavior* b = behaviors.get(element.getKey());
-
-		if (b == NULL || !b->isComposite()) { // parent is not composite, this will probably break the tree
-			error("Failed to load " + String::valueOf(element.getKey()) + " as a parent in tree: " + aiTemplate->getTemplateName());
-			continue;
-		}
-
-		CompositeBehavior* par = cast<CompositeBehavior*>(b);
-
-		Vector<uint32>& ids = element.getValue();
-
-		for (int j = 0; j < ids.size(); j++) {
-			Behavior* child = behaviors.get(ids.get(j));
-
-			if (child == NULL) {
-				error("Failed to load " + String::valueOf(ids.get(i)) + " as a child in tree: " + aiTemplate->getTemplateName());
-				continue;
-			}
-
-			addBehaviorToTree(child, par);
-		}
-	}
-
-	// now tree is complete, set the root node as the current node
-	Vector<uint32>& roots = parents.get(STRING_HASHCODE("none"));
-	if (roots.size() > 1) {
-		error("Multiple root nodes in tree: " + aiTemplate->getTemplateName());
-		return; // all References will be lost here
-	} else if (roots.size() <= 0) {
-		error("No root nodes in tree: " + aiTemplate->getTemplateName());
+	if (tree == NULL) {
+		error("Failed to build behavior tree of " + aiTemplate->getTemplateName());
 		return;
 	}
 
-	uint32 rootID = roots.get(0);
-	Behavior* rootBehavior = behaviors.get(rootID);
-	if (rootBehavior == NULL) {
-		error("Failed to get root instance in " + aiTemplate->getTemplateName());
-		return;
-	}
+	behaviorTree = tree;
+	behaviorState = tree->createState();
 
-	setCurrentBehavior(rootID);
+	setCurrentBehavior(tree->getRootID());
 }
 
 void AiAgentImplementation::setupBehaviorTree() {
@@ -2825,36 +2783,34 @@ void AiAgentImplementation::setupBehaviorTree(AiTemplate* getTarget, AiTemplate*
 	else if (creatureBitmask & CreatureFlag::PACK)
 		name = "CompositePack";
 
-	CompositeBehavior* rootSelector = cast<CompositeBehavior*>(AiMap::instance()->createNewInstance(asAiAgent(), name, AiMap::SELECTORBEHAVIOR));
-	CompositeBehavior* attackSequence = cast<CompositeBehavior*>(AiMap::instance()->createNewInstance(asAiAgent(), name, AiMap::SEQUENCEBEHAVIOR));
-	rootSelector->setID(STRING_HASHCODE("root"));
-	attackSequence->setID(STRING_HASHCODE("attackSequence"));
+	stopWaiting();
+	setWait(0);
 
-	addBehaviorToTree(attackSequence, rootSelector);
+	Reference<BehaviorTree*> tree = AiMap::instance()->getBehaviorTree(name, getTarget, selectAttack, combatMove, idle);
 
-	setupBehaviorTree(getTarget);
-	addCurrentBehaviorToTree(attackSequence);
+	behaviorTree = tree;
+	behaviorState = tree->createState();
 
-	setupBehaviorTree(selectAttack);
-	addCurrentBehaviorToTree(attackSequence);
+	// the state is new, there is nothing to end before moving to the root
+	currentBehaviorID = 0;
 
-	setupBehaviorTree(combatMove);
-	addCurrentBehaviorToTree(attackSequence);
+	resetBehaviorList();
 
-	setupBehaviorTree(idle);
-	addCurrentBehaviorToTree(rootSelector);
+	//info(getBehavior(currentBehaviorID)->print(), true);
+}
 
-	behaviors.put(STRING_HASHCODE("root"), rootSelector);
-	behaviors.put(STRING_HASHCODE("attackSequence"), attackSequence);
+Behavior* AiAgentImplementation::getBehavior(uint32 id) {
+	Reference<BehaviorTree*> tree = behaviorTree;
 
-	resetBehaviorList();
+	if (tree == NULL)
+		return NULL;
 
-	//info(behaviors.get(currentBehaviorID)->print(), true);
+	return tree->getBehavior(id);
 }
 
 void AiAgentImplementation::setCurrentBehavior(uint32 b) {
 	currentBehaviorID = b;
-	if (behaviors.get(currentBehaviorID) != NULL) {
+	if (getBehavior(currentBehaviorID) != NULL) {
 		//activateMovementEvent();
 
 		//info(currentBehaviorID, true);
@@ -2868,17 +2824,17 @@ void AiAgentImplementation::setCurrentBehavior(uint32 b) {
 }
 
 int AiAgentImplementation::getBehaviorStatus() {
-	Behavior* b = behaviors.get(currentBehaviorID);
+	Behavior* b = getBehavior(currentBehaviorID);
 	if (b == NULL)
 		return AiMap::INVALID;
 
-	return b->getStatus();
+	return b->getStatus(asAiAgent());
 }
 
 void AiAgentImplementation::setBehaviorStatus(int status) {
-	Behavior* b = behaviors.get(currentBehaviorID);
+	Behavior* b = getBehavior(currentBehaviorID);
 	if (b != NULL) {
-		b->setStatus((uint8)status);
+		b->setStatus(asAiAgent(), (uint8)status);
 
 		// This is for debugging:
 /*		ZoneServer* zoneServer = ServerCore::getZoneServer();
@@ -2888,32 +2844,20 @@ void AiAgentImplementation::setBehaviorStatus(int status) {
 	}
 }
 
-void AiAgentImplementation::addBehaviorToTree(Behavior* b, CompositeBehavior* par) {
-	if (b)
-		b->setParent(par);
-	if (par)
-		par->addChild(b);
-}
-
-void AiAgentImplementation::addCurrentBehaviorToTree(CompositeBehavior* par) {
-	Behavior* b = behaviors.get(currentBehaviorID);
-	addBehaviorToTree(b, par);
-}
-
 /**
  * move the tree back to the root node
  */
 void AiAgentImplementation::resetBehaviorList() {
-	Behavior* b = behaviors.get(currentBehaviorID);
+	Behavior* b = getBehavior(currentBehaviorID);
 	if (b != NULL)
-		b->end();
+		b->end(asAiAgent());
 
 	currentBehaviorID = STRING_HASHCODE("root");
-	b = behaviors.get(currentBehaviorID);
+	b = getBehavior(currentBehaviorID);
 	if (b == NULL)
 		return;
 
-	b->setStatus(AiMap::SUSPEND);
+	b->setStatus(asAiAgent(), AiMap::SUSPEND);
 
 	stopWaiting();
 	setWait(0);
@@ -2924,25 +2868,25 @@ void AiAgentImplementation::resetBehaviorList() {
 }
 
 void AiAgentImplementation::clearBehaviorList() {
-	for (int i = 0; i < behaviors.size(); i++) {
-		Behavior* b = behaviors.get(i);
-		if (b != NULL) {
-			delete b;
-			b = NULL;
-		}
-	}
-
 	currentBehaviorID = 0;
-	behaviors.removeAll();
+
+	// the tree stays alive in AiMap for the other agents using it
+	behaviorTree = NULL;
+	behaviorState = NULL;
 }
 
 int AiAgentImplementation::interrupt(SceneObject* source, int64 msg) {
-	Behavior* b = behaviors.get(currentBehaviorID);
+	Reference<BehaviorTree*> tree = behaviorTree;
+
+	if (tree == NULL)
+		return 1;
+
+	Behavior* b = tree->getBehavior(currentBehaviorID);
 
 	if (b == NULL)
 		return 1;
 
-	return b->interrupt(source, msg);
+	return b->interrupt(asAiAgent(), source, msg);
 }
 
 void AiAgentImplementation::broadcastInterrupt(int64 msg) {
@@ -3029,7 +2973,7 @@ void AiAgentImplementation::activateLoad(const String& temp) {
 }
 
 bool AiAgentImplementation::hasRangedWeapon() {
-	Reference<WeaponObject*> defaultWeapon = getSlottedObject("default_weapon").castTo<WeaponObject*>();
+	Reference<WeaponObject*> defaultWeapon = getKnownSlottedObject(SlotIndex::DEFAULT_WEAPON).castTo<WeaponObject*>();
 
 	return (defaultWeapon != NULL && defaultWeapon->isRangedWeapon()) || (readyWeapon != NULL && readyWeapon->isRangedWeapon());
 }
@@ -0,0 +1,87 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#ifndef AILEVELOFDETAIL_H_
+#define AILEVELOFDETAIL_H_
+
+#include "engine/engine.h"
+
+namespace server {
+namespace zone {
+namespace objects {
+namespace creature {
+namespace ai {
+
+/**
+ * Rate an AiAgent ticks at depending on how far the nearest player is.
+ * Agents a player could be noticed by tick at full rate, the further ones
+ * move in longer steps at the same speed and check awareness less often.
+ */
+class AiLevelOfDetail {
+public:
+	enum {
+		NEAR,	// a player is within awareness range, full rate
+		MID,	// half rate
+		FAR,	// quarter rate
+		TIERS
+	};
+
+	// msec between awareness checks at full rate
+	static const int AWARENESSINTERVAL = 1000;
+
+	// what a player can run during the slower awareness interval of the tier outside near
+	static const int NEARMARGIN = 16;
+
+	// distance past a tier range before moving to the farther tier, so players on the border don't flip it
+	static const int HYSTERESIS = 8;
+
+	/**
+	 * @param distanceSquared squared distance to the nearest player
+	 * @param awarenessRange range the agent can notice players at
+	 * @param currentTier tier the agent is at now
+	 * @return tier for the agent
+	 */
+	static int getTier(float distanceSquared, float awarenessRange, int currentTier) {
+		float nearRange = awarenessRange + NEARMARGIN;
+		float ranges[] = { nearRange, nearRange * 2 };
+
+		int tier = NEAR;
+
+		while (tier < FAR) {
+			float range = ranges[tier];
+
+			// only leave the tier the agent is in once well past it
+			if (tier >= currentTier)
+				range += HYSTERESIS;
+
+			if (distanceSquared <= range * range)
+				break;
+
+			++tier;
+		}
+
+		return tier;
+	}
+
+	/**
+	 * @return how many times longer the intervals of tier are than at full rate
+	 */
+	static int getScale(int tier) {
+		return 1 << MIN(MAX(tier, (int) NEAR), (int) FAR);
+	}
+
+	static int getAwarenessInterval(int tier) {
+		return AWARENESSINTERVAL * getScale(tier);
+	}
+};
+
+}
+}
+}
+}
+}
+
+using namespace server::zone::objects::creature::ai;
+
+#endif /* AILEVELOFDETAIL_H_ */
@@ -261,7 +261,7 @@ bool CreatureImplementation::canHarvestMe(CreatureObject* player) {
 	if (alreadyHarvested.contains(player->getObjectID()))
 		return false;
 
-	SceneObject* creatureInventory = getSlottedObject("inventory");
+	SceneObject* creatureInventory = getKnownSlottedObject(SlotIndex::INVENTORY);
 
 	if (creatureInventory == NULL)
 		return false;
@@ -293,7 +293,7 @@ bool CreatureImplementation::canDroidHarvestMe(CreatureObject* player,CreatureOb
 		return false;
 	}
 
-	SceneObject* creatureInventory = getSlottedObject("inventory");
+	SceneObject* creatureInventory = getKnownSlottedObject(SlotIndex::INVENTORY);
 
 	if (creatureInventory == NULL) {
 		return false;
@@ -444,7 +444,7 @@ void CreatureImplementation::setPetLevel(int newLevel) {
 	float minDmg = calculateAttackMinDamage(baseLevel);
 	float maxDmg = calculateAttackMaxDamage(baseLevel);
 
-	Reference<WeaponObject*> defaultWeapon = getSlottedObject("default_weapon").castTo<WeaponObject*>();
+	Reference<WeaponObject*> defaultWeapon = getKnownSlottedObject(SlotIndex::DEFAULT_WEAPON).castTo<WeaponObject*>();
 
 	float ratio = ((float)newLevel) / (float)baseLevel;
 	minDmg *= ratio;
@@ -508,3 +508,13 @@ void CreatureImplementation::sendMessage(BasePacket* msg) {
 	else
 		delete msg;
 }
+
+void CreatureImplementation::sendSharedMessage(SharedPacket* packet) {
+	if (!isMount())
+		return;
+
+	ManagedReference<CreatureObject* > linkedCreature = this->linkedCreature.get();
+
+	if (linkedCreature != NULL && linkedCreature->getParent().get() == _this.getReferenceUnsafeStaticCast())
+		linkedCreature->sendSharedMessage(packet);
+}
@@ -126,7 +126,7 @@ void DroidObjectImplementation::notifyInsertToZone(Zone* zone) {
 
 int DroidObjectImplementation::rechargeFromBattery(CreatureObject* player) {
 	// Find droid battery in player inventory
-	ManagedReference<SceneObject*> inventory = player->getSlottedObject("inventory");
+	ManagedReference<SceneObject*> inventory = player->getKnownSlottedObject(SlotIndex::INVENTORY);
 	if (inventory == NULL) {
 		player->sendSystemMessage("Player inventory not found");
 		return 0;
@@ -210,7 +210,7 @@ bool DroidObjectImplementation::isPowerDroid() {
 
 void DroidObjectImplementation::initDroidModules() {
 	modules.removeAll();
-	ManagedReference<SceneObject*> container = getSlottedObject("crafted_components");
+	ManagedReference<SceneObject*> container = getKnownSlottedObject(SlotIndex::CRAFTED_COMPONENTS);
 	if (container != NULL && container->getContainerObjectsSize() > 0) {
 		SceneObject* satchel = container->getContainerObject(0);
 
@@ -237,7 +237,7 @@ void DroidObjectImplementation::initDroidModules() {
 
 void DroidObjectImplementation::initDroidWeapons() {
 	//Set weapon stats
-	WeaponObject* weapon = getSlottedObject("default_weapon").castTo<WeaponObject*>();
+	WeaponObject* weapon = getKnownSlottedObject(SlotIndex::DEFAULT_WEAPON).castTo<WeaponObject*>();
 
 	if (weapon != NULL) {
 		Locker locker(weapon);
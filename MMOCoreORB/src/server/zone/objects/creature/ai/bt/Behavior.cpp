@@ -10,44 +10,39 @@
 #include "server/zone/managers/creature/AiMap.h"
 #include "LuaBehavior.h"
 
-Behavior::Behavior(AiAgent* _agent, const String& className) {
-	agent = _agent;
-	result = AiMap::SUSPEND;
+Behavior::Behavior(const String& className) {
 	parent = NULL;
 	interface = AiMap::instance()->getBehavior(className);
 	id = 0;
+	index = 0;
 
 	if (interface == NULL) {
-		_agent->error("Null interface in Behavior: " + className);
+		AiMap::instance()->error("Null interface in Behavior: " + className);
 	}
 }
 
-void Behavior::start() {
-	if (!checkConditions()) {
-		endWithFailure();
+BehaviorNodeState& Behavior::getState(AiAgent* agent) {
+	return agent->getBehaviorState()->get(index);
+}
+
+void Behavior::start(AiAgent* agent) {
+	if (!checkConditions(agent)) {
+		endWithFailure(agent);
 		return;
 	}
 
-	result = AiMap::RUNNING;
+	setStatus(agent, AiMap::RUNNING);
 
-	if (interface != NULL) {
-		Reference<AiAgent*> strongReference = agent.get();
-
-		interface->start(strongReference);
-	}
+	if (interface != NULL)
+		interface->start(agent);
 }
 
-void Behavior::end() {
-	if (interface != NULL) {
-		Reference<AiAgent*> strongReference = agent.get();
-
-		interface->end(strongReference);
-	}
+void Behavior::end(AiAgent* agent) {
+	if (interface != NULL)
+		interface->end(agent);
 }
 
-void Behavior::doAction(bool directlyExecuted) {
-	Reference<AiAgent*> agent = this->agent.get();
-
+void Behavior::doAction(AiAgent* agent, bool directlyExecuted) {
 	if (agent->isDead() || agent->isIncapacitated() || (agent->getZone() == NULL)) {
 		agent->setFollowObject(NULL);
 		return;
@@ -56,21 +51,19 @@ void Behavior::doAction(bool directlyExecuted) {
 	//agent->info(id, true);
 	agent->setCurrentBehavior(id);
 
-	if (!started())
-		this->start();
-	else if (!this->checkConditions())
-		endWithFailure();
-
-	agent = this->agent.get();
+	if (!started(agent))
+		this->start(agent);
+	else if (!this->checkConditions(agent))
+		endWithFailure(agent);
 
-	if (finished()) {
+	if (finished(agent)) {
 		if (parent == NULL) {
-			this->end();
-			result = AiMap::SUSPEND;
+			this->end(agent);
+			setStatus(agent, AiMap::SUSPEND);
 			agent->activateMovementEvent(); // this is an automatic recycle decorator for the root node
 		} else if (directlyExecuted) {
 			agent->setCurrentBehavior(parent->id);
-			parent->doAction(true);
+			parent->doAction(agent, true);
 		}
 
 		return;
@@ -82,57 +75,53 @@ void Behavior::doAction(bool directlyExecuted) {
 
 	switch(res) {
 	case AiMap::SUCCESS:
-		endWithSuccess();
+		endWithSuccess(agent);
 		break;
 	case AiMap::FAILURE:
-		endWithFailure();
+		endWithFailure(agent);
 		break;
 	case AiMap::INVALID:
-		if (agent == NULL)
-			return;
-
 		agent->resetBehaviorList();
 		break;
 	default:
-		if (agent == NULL)
-			return;
-
 		break;
 	}
 
-	if (!finished() || parent == NULL)
+	if (!finished(agent) || parent == NULL)
 		agent->activateMovementEvent();
 	else if (directlyExecuted) {
 		agent->setCurrentBehavior(parent->id);
 
-		parent->doAction(true);
+		parent->doAction(agent, true);
 	}
 }
 
-void Behavior::endWithFailure() {
-	this->result = AiMap::FAILURE;
+void Behavior::endWithFailure(AiAgent* agent) {
+	setStatus(agent, AiMap::FAILURE);
 }
 
-void Behavior::endWithSuccess() {
-	this->result = AiMap::SUCCESS;
+void Behavior::endWithSuccess(AiAgent* agent) {
+	setStatus(agent, AiMap::SUCCESS);
 }
 
-void Behavior::endWithError() {
-	this->result = AiMap::INVALID;
+void Behavior::endWithError(AiAgent* agent) {
+	setStatus(agent, AiMap::INVALID);
 }
 
-bool Behavior::succeeded() {
-	return result == AiMap::SUCCESS;
+bool Behavior::succeeded(AiAgent* agent) {
+	return getStatus(agent) == AiMap::SUCCESS;
 }
 
-bool Behavior::failed() {
-	return result == AiMap::FAILURE;
+bool Behavior::failed(AiAgent* agent) {
+	return getStatus(agent) == AiMap::FAILURE;
 }
 
-bool Behavior::finished() {
+bool Behavior::finished(AiAgent* agent) {
+	uint8 result = getStatus(agent);
+
 	return result == AiMap::SUCCESS || result == AiMap::FAILURE || result == AiMap::INVALID;
 }
 
-bool Behavior::started() {
-	return result != AiMap::SUSPEND;
+bool Behavior::started(AiAgent* agent) {
+	return getStatus(agent) != AiMap::SUSPEND;
 }
@@ -11,6 +11,7 @@
 #include "engine/engine.h"
 #include "server/zone/objects/creature/ai/AiAgent.h"
 #include "server/zone/objects/creature/ai/bt/LuaBehavior.h"
+#include "server/zone/objects/creature/ai/bt/BehaviorState.h"
 
 namespace server {
 namespace zone {
@@ -29,47 +30,42 @@ namespace bt {
 
 class CompositeBehavior;
 
+/**
+ * Node of a BehaviorTree. Nodes are shared by every agent running the tree
+ * and never change once it is built, the status of a node for an agent
+ * lives in the BehaviorState of that agent.
+ */
 class Behavior {
 protected:
-	WeakReference<AiAgent*> agent; // this is like the blackboard
-	uint8 result;
 	Behavior* parent; // the parent must be a composite
 	Reference<LuaBehavior*> interface;
 	uint32 id;
+	uint16 index; // slot of this node in the BehaviorState
 
 public:
 	/**
 	 * Creates a new instance of the Behavior class
-	 * @param _agent Reference to the AI agent (as a blackboard)
+	 * @param className name of the lua behavior it runs
 	 */
-	Behavior(AiAgent* _agent, const String& className);
-
-	Behavior(const Behavior& b) {
-		agent = b.agent;
-		result = b.result;
-		parent = b.parent;
-		interface = b.interface;
-		id = b.id;
-	}
+	Behavior(const String& className);
 
-	Behavior& operator=(const Behavior& b) {
-		if (this == &b)
-			return *this;
+	virtual ~Behavior() {
+	}
 
-		agent = b.agent;
-		result = b.result;
-		parent = b.parent;
-		interface = b.interface;
-		id = b.id;
+	inline void setID(uint32 _id) {
+		this->id = _id;
+	}
 
-		return *this;
+	inline uint32 getID() {
+		return id;
 	}
 
-	virtual ~Behavior() {
+	inline void setIndex(uint16 _index) {
+		this->index = _index;
 	}
 
-	inline void setID(uint32 _id) {
-		this->id = _id;
+	inline uint16 getIndex() {
+		return index;
 	}
 
 	virtual bool isComposite() {
@@ -90,14 +86,9 @@ public:
 	 * @post { agent is locked }
 	 * @return true if we can update, false if not
 	 */
-	virtual bool checkConditions() {
-		if (interface != NULL) {
-			Reference<AiAgent*> strongReference = agent.get();
-
-			if (strongReference != NULL) {
-				return interface->checkConditions(strongReference);
-			}
-		}
+	virtual bool checkConditions(AiAgent* agent) {
+		if (interface != NULL && agent != NULL)
+			return interface->checkConditions(agent);
 
 		return false;
 	}
@@ -107,14 +98,14 @@ public:
 	 * @pre { agent is locked }
 	 * @post { agent is locked }
 	 */
-	virtual void start();
+	virtual void start(AiAgent* agent);
 
 	/**
 	 * Virtual to provide termination logic
 	 * @pre { agent is locked }
 	 * @post { agent is locked }
 	 */
-	virtual void end();
+	virtual void end(AiAgent* agent);
 
 	/**
 	 * Virtual to provide logic for each update
@@ -122,23 +113,18 @@ public:
 	 * @post { agent is locked, action is exectued }
 	 * @param directlyExecuted boolean that is true if the parent is to be executed immediately after this finishes
 	 */
-	virtual void doAction(bool directlyExecuted = false);
-
-	virtual int interrupt(SceneObject* source, int64 msg) {
-		Reference<AiAgent*> strongReference = agent.get();
+	virtual void doAction(AiAgent* agent, bool directlyExecuted = false);
 
-		return interface->interrupt(strongReference, source, msg);
+	virtual int interrupt(AiAgent* agent, SceneObject* source, int64 msg) {
+		return interface->interrupt(agent, source, msg);
 	}
 
 	/**
 	 * Virtual to ensure that we should do an awareness check
 	 */
-	virtual bool doAwarenessCheck(SceneObject* target) {
-		if (interface != NULL) {
-			Reference<AiAgent*> strongReference = agent.get();
-
-			return interface->doAwarenessCheck(strongReference, target);
-		}
+	virtual bool doAwarenessCheck(AiAgent* agent, SceneObject* target) {
+		if (interface != NULL)
+			return interface->doAwarenessCheck(agent, target);
 
 		return false;
 	}
@@ -148,21 +134,21 @@ public:
 	 * @pre { agent is locked }
 	 * @post { agent is locked }
 	 */
-	void endWithSuccess();
+	void endWithSuccess(AiAgent* agent);
 
 	/**
 	 * End the behavior with failure
 	 * @pre { agent is locked }
 	 * @post { agent is locked }
 	 */
-	void endWithFailure();
+	void endWithFailure(AiAgent* agent);
 
 	/**
 	 * End the behavior with an error
 	 * @pre { agent is locked }
 	 * @post { agent is locked }
 	 */
-	void endWithError();
+	void endWithError(AiAgent* agent);
 
 	/**
 	 * setter and getter for the parent (to set up the actual tree)
@@ -175,24 +161,30 @@ public:
 		return parent;
 	}
 
-	uint8 getStatus() {
-		return result;
+	/**
+	 * State of this node in the blackboard of agent
+	 * @pre { agent is running the tree of this node }
+	 */
+	BehaviorNodeState& getState(AiAgent* agent);
+
+	uint8 getStatus(AiAgent* agent) {
+		return getState(agent).status;
 	}
 
-	void setStatus(uint8 s) {
-		this->result = s;
+	void setStatus(AiAgent* agent, uint8 s) {
+		getState(agent).status = s;
 	}
 
 	/**
 	 * Status getters
 	 */
-	bool succeeded();
+	bool succeeded(AiAgent* agent);
 
-	bool failed();
+	bool failed(AiAgent* agent);
 
-	bool finished();
+	bool finished(AiAgent* agent);
 
-	bool started();
+	bool started(AiAgent* agent);
 
 };
 
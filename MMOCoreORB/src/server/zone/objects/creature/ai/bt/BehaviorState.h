@@ -0,0 +1,102 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#ifndef BEHAVIORSTATE_H_
+#define BEHAVIORSTATE_H_
+
+#include <cassert>
+
+#include "engine/engine.h"
+
+namespace server {
+namespace zone {
+namespace objects {
+namespace creature {
+namespace ai {
+namespace bt {
+
+/**
+ * Runtime state one agent keeps for one node of its behavior tree
+ */
+class BehaviorNodeState {
+public:
+	uint8 status;
+
+	// a parallel parent is done with this child
+	bool ended;
+
+	// running child of a composite
+	uint16 position;
+
+	// finished children of a parallel composite
+	uint16 numFailed;
+	uint16 numSucceeded;
+};
+
+/**
+ * Blackboard of an agent running a shared BehaviorTree, one node state for
+ * every node of the tree indexed by Behavior::getIndex plus the child order
+ * of its non deterministic composites.
+ */
+class BehaviorState : public Object {
+	BehaviorNodeState* nodes;
+	int nodeCount;
+
+	uint16* orders;
+	int orderCount;
+
+public:
+	BehaviorState(int nodeCount, int orderCount, uint8 status) : nodeCount(nodeCount), orderCount(orderCount) {
+		nodes = new BehaviorNodeState[MAX(nodeCount, 1)];
+		orders = new uint16[MAX(orderCount, 1)];
+
+		for (int i = 0; i < nodeCount; ++i) {
+			nodes[i].status = status;
+			nodes[i].ended = false;
+			nodes[i].position = 0;
+			nodes[i].numFailed = 0;
+			nodes[i].numSucceeded = 0;
+		}
+
+		for (int i = 0; i < orderCount; ++i)
+			orders[i] = 0;
+	}
+
+	~BehaviorState() {
+		delete [] nodes;
+		delete [] orders;
+	}
+
+	inline BehaviorNodeState& get(int index) {
+		assert(index >= 0 && index < nodeCount);
+
+		return nodes[index];
+	}
+
+	inline uint16* getOrder(int offset) {
+		return orders + offset;
+	}
+
+	inline int getNodeCount() const {
+		return nodeCount;
+	}
+
+	/**
+	 * Heap memory the state takes for one agent
+	 */
+	int getMemorySize() const {
+		return sizeof(BehaviorState) + nodeCount * sizeof(BehaviorNodeState) + orderCount * sizeof(uint16);
+	}
+};
+
+}
+}
+}
+}
+}
+}
+
+using namespace server::zone::objects::creature::ai::bt;
+
+#endif /* BEHAVIORSTATE_H_ */
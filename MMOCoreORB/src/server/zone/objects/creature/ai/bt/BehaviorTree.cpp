@@ -0,0 +1,186 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#include "BehaviorTree.h"
+#include "Behavior.h"
+#include "CompositeBehavior.h"
+#include "server/zone/managers/creature/AiMap.h"
+#include "templates/AiTemplate.h"
+
+BehaviorTree::BehaviorTree(const String& name) : Logger("BehaviorTree " + name) {
+	ids.setNoDuplicateInsertPlan();
+	ids.setNullValue(NULL);
+
+	rootID = 0;
+	orderCount = 0;
+}
+
+BehaviorTree::~BehaviorTree() {
+	for (int i = 0; i < nodes.size(); ++i)
+		delete nodes.get(i);
+}
+
+BehaviorTree* BehaviorTree::create(AiTemplate* aiTemplate) {
+	BehaviorTree* tree = new BehaviorTree(aiTemplate->getTemplateName());
+
+	tree->rootID = tree->addTemplate(aiTemplate);
+
+	if (tree->rootID == 0) {
+		delete tree;
+		return NULL;
+	}
+
+	tree->finish();
+
+	return tree;
+}
+
+BehaviorTree* BehaviorTree::create(const String& name, AiTemplate* getTarget, AiTemplate* selectAttack, AiTemplate* combatMove, AiTemplate* idle) {
+	BehaviorTree* tree = new BehaviorTree(name);
+
+	CompositeBehavior* rootSelector = cast<CompositeBehavior*>(tree->addBehavior(STRING_HASHCODE("root"), name, AiMap::SELECTORBEHAVIOR));
+	CompositeBehavior* attackSequence = cast<CompositeBehavior*>(tree->addBehavior(STRING_HASHCODE("attackSequence"), name, AiMap::SEQUENCEBEHAVIOR));
+
+	tree->addChild(attackSequence, rootSelector);
+
+	AiTemplate* templates[] = { getTarget, selectAttack, combatMove, idle };
+
+	// a template that fails to load adds the previous root again, as trees built per agent did
+	uint32 currentID = 0;
+
+	for (int i = 0; i < 4; ++i) {
+		if (templates[i] == NULL)
+			tree->error("Invalid aiTemplate in BehaviorTree::create");
+		else {
+			uint32 templateRootID = tree->addTemplate(templates[i]);
+
+			if (templateRootID != 0)
+				currentID = templateRootID;
+		}
+
+		tree->addChild(tree->getBehavior(currentID), i < 3 ? attackSequence : rootSelector);
+	}
+
+	tree->ids.put(STRING_HASHCODE("root"), rootSelector);
+	tree->ids.put(STRING_HASHCODE("attackSequence"), attackSequence);
+
+	tree->rootID = STRING_HASHCODE("root");
+
+	tree->finish();
+
+	return tree;
+}
+
+Reference<BehaviorState*> BehaviorTree::createState() {
+	return new BehaviorState(nodes.size(), orderCount, AiMap::SUSPEND);
+}
+
+Behavior* BehaviorTree::addBehavior(uint32 id, const String& className, uint16 classType) {
+	Behavior* behavior = AiMap::createNewInstance(className, classType);
+	behavior->setID(id);
+	behavior->setIndex(nodes.size());
+
+	nodes.add(behavior);
+
+	return behavior;
+}
+
+uint32 BehaviorTree::addTemplate(AiTemplate* aiTemplate) {
+	Vector<Reference<LuaAiTemplate*> >* treeTemplate = aiTemplate->getTree();
+
+	VectorMap<uint32, Vector<uint32> > parents; // id's keyed by parents
+	parents.setAllowOverwriteInsertPlan();
+
+	// first build the maps
+	for (int i = 0; i < treeTemplate->size(); i++) {
+		LuaAiTemplate* temp = treeTemplate->get(i).get();
+		if (temp == NULL) {
+			error("Null AI template, contact dannuic if this occurs"); // FIXME (dannuic): Is this still happening?
+			continue;
+		}
+
+		// ids seen before keep their first node
+		if (!ids.contains(temp->id))
+			ids.put(temp->id, addBehavior(temp->id, temp->className, temp->classType));
+
+		Vector<uint32> children = parents.get(temp->parent);
+		children.add(temp->id);
+		parents.put(temp->parent, children);
+	}
+
+	// now set parents
+	for (int i = 0; i < parents.size(); i++) {
+		VectorMapEntry<uint32, Vector<uint32> >& element = parents.elementAt(i);
+		if (element.getKey() == STRING_HASHCODE("none")) // this is the parent of the root node, just skip it.
+			continue;
+
+		Behavior* b = getBehavior(element.getKey());
+
+		if (b == NULL || !b->isComposite()) { // parent is not composite, this will probably break the tree
+			error("Failed to load " + String::valueOf(element.getKey()) + " as a parent in tree: " + aiTemplate->getTemplateName());
+			continue;
+		}
+
+		CompositeBehavior* par = cast<CompositeBehavior*>(b);
+
+		Vector<uint32>& children = element.getValue();
+
+		for (int j = 0; j < children.size(); j++) {
+			Behavior* child = getBehavior(children.get(j));
+
+			if (child == NULL) {
+				error("Failed to load " + String::valueOf(children.get(j)) + " as a child in tree: " + aiTemplate->getTemplateName());
+				continue;
+			}
+
+			addChild(child, par);
+		}
+	}
+
+	// now tree is complete, return the root node
+	Vector<uint32>& roots = parents.get(STRING_HASHCODE("none"));
+	if (roots.size() > 1) {
+		error("Multiple root nodes in tree: " + aiTemplate->getTemplateName());
+		return 0;
+	} else if (roots.size() <= 0) {
+		error("No root nodes in tree: " + aiTemplate->getTemplateName());
+		return 0;
+	}
+
+	uint32 templateRootID = roots.get(0);
+	if (getBehavior(templateRootID) == NULL) {
+		error("Failed to get root instance in " + aiTemplate->getTemplateName());
+		return 0;
+	}
+
+	return templateRootID;
+}
+
+void BehaviorTree::addChild(Behavior* child, CompositeBehavior* parent) {
+	if (child == NULL || parent == NULL) {
+		error("NULL child or parent adding a behavior to the tree");
+		return;
+	}
+
+	child->setParent(parent);
+	parent->addChild(child);
+}
+
+void BehaviorTree::finish() {
+	for (int i = 0; i < nodes.size(); ++i) {
+		Behavior* behavior = nodes.get(i);
+
+		if (!behavior->isComposite())
+			continue;
+
+		CompositeBehavior* composite = cast<CompositeBehavior*>(behavior);
+
+		int size = composite->getOrderSize();
+
+		if (size > 0) {
+			composite->setOrderOffset(orderCount);
+			orderCount += size;
+		}
+	}
+}
@@ -0,0 +1,103 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#ifndef BEHAVIORTREE_H_
+#define BEHAVIORTREE_H_
+
+#include "engine/engine.h"
+
+#include "server/zone/objects/creature/ai/bt/BehaviorState.h"
+
+class AiTemplate;
+
+namespace server {
+namespace zone {
+namespace objects {
+namespace creature {
+namespace ai {
+namespace bt {
+
+class Behavior;
+class CompositeBehavior;
+
+/**
+ * Behavior nodes built once from AI templates and shared by every agent
+ * using the same templates. The tree never changes after it is built,
+ * agents keep what they need to run it in a BehaviorState of their own.
+ */
+class BehaviorTree : public Object, public Logger {
+	// owned, indexed by Behavior::getIndex
+	Vector<Behavior*> nodes;
+
+	// the first node built with each id
+	VectorMap<uint32, Behavior*> ids;
+
+	uint32 rootID;
+
+	int orderCount;
+
+public:
+	BehaviorTree(const String& name);
+	~BehaviorTree();
+
+	/**
+	 * Builds the tree of a single template
+	 * @return NULL if the template has no single root
+	 */
+	static BehaviorTree* create(AiTemplate* aiTemplate);
+
+	/**
+	 * Builds the default tree, a root selector over an attack sequence of
+	 * getTarget, selectAttack and combatMove and then idle
+	 * @param name class of the root composites
+	 */
+	static BehaviorTree* create(const String& name, AiTemplate* getTarget, AiTemplate* selectAttack, AiTemplate* combatMove, AiTemplate* idle);
+
+	/**
+	 * @return the node with id, NULL if there is none
+	 */
+	inline Behavior* getBehavior(uint32 id) {
+		return ids.get(id);
+	}
+
+	inline uint32 getRootID() {
+		return rootID;
+	}
+
+	inline int getNodeCount() {
+		return nodes.size();
+	}
+
+	/**
+	 * @return new blackboard for an agent starting to run the tree
+	 */
+	Reference<BehaviorState*> createState();
+
+protected:
+	Behavior* addBehavior(uint32 id, const String& className, uint16 classType);
+
+	/**
+	 * Adds the nodes of aiTemplate
+	 * @return id of its root, 0 if it has no single root
+	 */
+	uint32 addTemplate(AiTemplate* aiTemplate);
+
+	void addChild(Behavior* child, CompositeBehavior* parent);
+
+	/**
+	 * Lays out the child orders in the BehaviorState once all nodes are added
+	 */
+	void finish();
+};
+
+}
+}
+}
+}
+}
+}
+
+using namespace server::zone::objects::creature::ai::bt;
+
+#endif /* BEHAVIORTREE_H_ */
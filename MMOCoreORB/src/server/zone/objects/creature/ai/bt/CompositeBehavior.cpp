@@ -9,84 +9,77 @@
 #include "Behavior.h"
 #include "server/zone/managers/creature/AiMap.h"
 
-CompositeBehavior::CompositeBehavior(AiAgent* _agent, const String& className) : Behavior(_agent, className) {
-	currentPos = 0;
+CompositeBehavior::CompositeBehavior(const String& className) : Behavior(className) {
 }
 
-CompositeBehavior::CompositeBehavior(const CompositeBehavior& b) : Behavior(b) {
-	children = b.children;
-	currentPos = b.currentPos;
-}
-
-void CompositeBehavior::start() {
-	currentPos = 0;
+void CompositeBehavior::start(AiAgent* agent) {
+	getState(agent).position = 0;
 
 	for (int i = 0; i < children.size(); i++) {
 		Behavior* currentChild = children.get(i);
 
 		if (currentChild == NULL) {
-			Reference<AiAgent*> agent = this->agent.get();
-
 			agent->error("NULL child in CompositeBehavior");
 			continue;
 		}
 
-		currentChild->setStatus(AiMap::SUSPEND);
+		BehaviorNodeState& childState = currentChild->getState(agent);
+		childState.status = AiMap::SUSPEND;
+		childState.ended = false;
 	}
 
-	Behavior::start();
+	Behavior::start(agent);
 }
 
-void CompositeBehavior::doAction(bool directlyExecuted) {
-	Reference<AiAgent*> agent = this->agent.get();
-
+void CompositeBehavior::doAction(AiAgent* agent, bool directlyExecuted) {
 	if (agent->isDead() || agent->isIncapacitated() || (agent->getZone() == NULL)) {
 		agent->setFollowObject(NULL);
 		return;
 	}
 
-	if (!started())
-		this->start();
-	else if (!checkConditions())
-		endWithFailure();
+	if (!started(agent))
+		this->start(agent);
+	else if (!checkConditions(agent))
+		endWithFailure(agent);
 
-	if (finished()) {
-		Behavior::doAction(directlyExecuted);
+	if (finished(agent)) {
+		Behavior::doAction(agent, directlyExecuted);
 		return;
 	}
 
+	BehaviorNodeState& state = getState(agent);
 	Behavior* currentChild;
 
 	do {
-		currentChild = children.get(currentPos);
+		currentChild = getChild(agent, state.position);
 
 		if (currentChild == NULL) {
 			agent->error("NULL child or empty children list in CompositeBehavior");
-			endWithError();
-			Behavior::doAction(directlyExecuted);
+			endWithError(agent);
+			Behavior::doAction(agent, directlyExecuted);
 			return;
 		}
 
-		if (!currentChild->started())
-			currentChild->start();
-		else if (!currentChild->checkConditions()) // if this isn't here, I can get a single recursion where the child will call the parent's (this) doAction()
-			endWithFailure();
+		if (!currentChild->started(agent))
+			currentChild->start(agent);
+		else if (!currentChild->checkConditions(agent)) // if this isn't here, I can get a single recursion where the child will call the parent's (this) doAction()
+			endWithFailure(agent);
 
-		if (!currentChild->finished())
-			currentChild->doAction();
+		if (!currentChild->finished(agent))
+			currentChild->doAction(agent);
 
-		if (currentChild->finished()) {
-			if (currentChild->succeeded())
-				this->childSucceeded();
-			else if (currentChild->failed())
-				this->childFailed();
+		if (currentChild->finished(agent)) {
+			if (currentChild->succeeded(agent))
+				this->childSucceeded(agent);
+			else if (currentChild->failed(agent))
+				this->childFailed(agent);
 
-			currentChild->end();
+			currentChild->end(agent);
 		}
-	} while (currentChild != NULL && currentChild->finished() && !this->finished() && currentPos < children.size());
+	} while (currentChild != NULL && currentChild->finished(agent) && !this->finished(agent) && state.position < children.size());
 
-	if (currentChild->finished())
-		Behavior::doAction(directlyExecuted);
+	if (currentChild->finished(agent))
+		Behavior::doAction(agent, directlyExecuted);
 }
 
 String CompositeBehavior::print() {
@@ -99,8 +92,6 @@ String CompositeBehavior::print() {
 	return stream.toString();
 }
 
-bool CompositeBehavior::checkConditions() {
-	return children.size() > 0 && Behavior::checkConditions();
+bool CompositeBehavior::checkConditions(AiAgent* agent) {
+	return children.size() > 0 && Behavior::checkConditions(agent);
 }
-
-
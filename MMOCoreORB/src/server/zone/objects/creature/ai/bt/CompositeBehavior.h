@@ -23,7 +23,6 @@ namespace bt {
 class CompositeBehavior : public Behavior {
 protected:
 	Vector<Behavior*> children;
-	uint32 currentPos;
 
 public:
 	virtual void addChild(Behavior* child) {
@@ -32,31 +31,11 @@ public:
 		children.add(child);
 	}
 
-	Vector<Behavior*> getChildren() {
+	const Vector<Behavior*>& getChildren() {
 		return children;
 	}
 
-	void clearChildren() {
-		children.removeAll();
-	}
-
-	CompositeBehavior(AiAgent* _agent, const String& className);
-
-	CompositeBehavior(const CompositeBehavior& b);
-
-	CompositeBehavior& operator=(const CompositeBehavior& b) {
-		if (this == &b)
-			return *this;
-
-		agent = b.agent;
-		result = b.result;
-		parent = b.parent;
-		interface = b.interface;
-		children = b.children;
-		currentPos = b.currentPos;
-
-		return *this;
-	}
+	CompositeBehavior(const String& className);
 
 	virtual ~CompositeBehavior() {
 	}
@@ -67,19 +46,36 @@ public:
 
 	String print();
 
-	virtual void childSucceeded() {
-		endWithSuccess();
+	/**
+	 * Child an agent runs at position
+	 */
+	virtual Behavior* getChild(AiAgent* agent, int position) {
+		return children.get(position);
+	}
+
+	/**
+	 * Child order slots the node needs in every BehaviorState
+	 */
+	virtual int getOrderSize() {
+		return 0;
+	}
+
+	virtual void setOrderOffset(int offset) {
+	}
+
+	virtual void childSucceeded(AiAgent* agent) {
+		endWithSuccess(agent);
 	}
 
-	virtual void childFailed() {
-		endWithFailure();
+	virtual void childFailed(AiAgent* agent) {
+		endWithFailure(agent);
 	}
 
-	virtual bool checkConditions();
+	virtual bool checkConditions(AiAgent* agent);
 
-	virtual void start();
+	virtual void start(AiAgent* agent);
 
-	virtual void doAction(bool directlyExecuted = false);
+	virtual void doAction(AiAgent* agent, bool directlyExecuted = false);
 };
 
 }
@@ -0,0 +1,254 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#include "NativeBehavior.h"
+#include "server/zone/managers/creature/AiMap.h"
+#include "server/zone/objects/creature/ai/AiAgent.h"
+#include "server/zone/objects/creature/ai/PatrolPoint.h"
+#include "server/zone/objects/scene/SceneObject.h"
+#include "templates/params/ObserverEventType.h"
+#include "templates/params/creature/CreaturePosture.h"
+#include "templates/params/creature/CreatureState.h"
+
+NativeBehavior::NativeBehavior(const String& className, bool awareness) : LuaBehavior(className) {
+	this->awareness = awareness;
+}
+
+NativeBehavior* NativeBehavior::create(const String& nativeName, const String& className, bool awareness) {
+	if (nativeName == "Composite")
+		return new NativeCompositeBehavior(className, awareness);
+	else if (nativeName == "Wait")
+		return new NativeWaitBehavior(className, awareness);
+	else if (nativeName == "Wait10")
+		return new NativeWait10Behavior(className, awareness);
+	else if (nativeName == "Move")
+		return new NativeMoveBehavior(className, awareness);
+	else if (nativeName == "Walk")
+		return new NativeWalkBehavior(className, awareness);
+	else if (nativeName == "CombatMove")
+		return new NativeCombatMoveBehavior(className, awareness);
+	else if (nativeName == "GeneratePatrol")
+		return new NativeGeneratePatrolBehavior(className, awareness);
+	else if (nativeName == "GetTarget")
+		return new NativeGetTargetBehavior(className, awareness);
+	else if (nativeName == "SelectWeapon")
+		return new NativeSelectWeaponBehavior(className, awareness);
+	else if (nativeName == "SelectAttack")
+		return new NativeSelectAttackBehavior(className, awareness);
+
+	return NULL;
+}
+
+bool NativeBehavior::checkConditions(AiAgent* agent) {
+	return agent != NULL;
+}
+
+int NativeBehavior::doAction(AiAgent* agent) {
+	return AiMap::SUCCESS;
+}
+
+bool NativeBehavior::doAwarenessCheck(AiAgent* agent, SceneObject* target) {
+	if (!awareness)
+		return false;
+
+	return agent->runAwarenessLogicCheck(target);
+}
+
+int NativeCompositeBehavior::doAction(AiAgent* agent) {
+	return agent->getBehaviorStatus();
+}
+
+void NativeWaitBehavior::start(AiAgent* agent) {
+	agent->setWait(getWait(agent) * 1000);
+}
+
+float NativeWaitBehavior::end(AiAgent* agent) {
+	agent->setWait(0);
+
+	return 0;
+}
+
+int NativeWaitBehavior::doAction(AiAgent* agent) {
+	if (agent->isWaiting())
+		return AiMap::RUNNING;
+
+	return AiMap::SUCCESS;
+}
+
+int NativeWait10Behavior::getWait(AiAgent* agent) {
+	return System::random(9) + 6;
+}
+
+bool NativeMoveBehavior::checkConditions(AiAgent* agent) {
+	if (agent->getPosture() != CreaturePosture::UPRIGHT || agent->setDestination() <= 0)
+		return false;
+
+	if (shouldRetreat(agent, 256)) {
+		agent->leash();
+		return false;
+	}
+
+	return true;
+}
+
+int NativeMoveBehavior::doAction(AiAgent* agent) {
+	if (agent->getCurrentSpeed() > 0)
+		agent->completeMove();
+
+	if (findNextPosition(agent))
+		return AiMap::RUNNING;
+
+	return AiMap::SUCCESS;
+}
+
+bool NativeMoveBehavior::findNextPosition(AiAgent* agent) {
+	return agent->findNextPosition(agent->getMaxDistance(), false);
+}
+
+bool NativeMoveBehavior::shouldRetreat(AiAgent* agent, float range) {
+	if (agent->isRetreating())
+		return false;
+
+	PatrolPoint* homeLocation = agent->getHomeLocation();
+	SceneObject* target = agent->getFollowObject().get();
+
+	if (target != NULL)
+		return !homeLocation->isInRange(target, range);
+
+	return !homeLocation->isInRange(agent, range);
+}
+
+bool NativeWalkBehavior::findNextPosition(AiAgent* agent) {
+	return agent->findNextPosition(agent->getMaxDistance(), true);
+}
+
+int NativeCombatMoveBehavior::doAction(AiAgent* agent) {
+	if (agent->getCurrentSpeed() > 0)
+		agent->completeMove();
+
+	findNextPosition(agent);
+
+	SceneObject* target = agent->getFollowObject().get();
+
+	if (target != NULL && target->isCreatureObject() && target->asCreatureObject()->getTargetID() == agent->getObjectID())
+		agent->broadcastInterrupt(ObserverEventType::STARTCOMBAT);
+
+	return AiMap::SUCCESS;
+}
+
+int NativeGeneratePatrolBehavior::doAction(AiAgent* agent) {
+	if (agent->generatePatrol(5, 10))
+		return AiMap::SUCCESS;
+
+	return AiMap::FAILURE;
+}
+
+bool NativeGetTargetBehavior::checkConditions(AiAgent* agent) {
+	if (agent->isDead()) {
+		agent->clearCombatState(true);
+		agent->setOblivious();
+		agent->info("check conditions target for skipped dead target", true);
+		return false;
+	}
+
+	return true;
+}
+
+int NativeGetTargetBehavior::doAction(AiAgent* agent) {
+	int ranLevel = System::random(agent->getLevel() - 1) + 1;
+
+	ManagedReference<SceneObject*> target = agent->getTargetFromMap();
+
+	int result = selectTarget(agent, target, ranLevel);
+
+	if (result != AiMap::RUNNING)
+		return result;
+
+	target = agent->getTargetFromDefenders();
+
+	result = selectTarget(agent, target, ranLevel);
+
+	if (result != AiMap::RUNNING)
+		return result;
+
+	if (agent->isInCombat()) {
+		agent->clearCombatState(true);
+		agent->setOblivious();
+	}
+
+	return AiMap::FAILURE;
+}
+
+int NativeGetTargetBehavior::selectTarget(AiAgent* agent, SceneObject* target, int ranLevel) {
+	if (target == NULL)
+		return AiMap::RUNNING;
+
+	if (target != agent->getFollowObject().get()) {
+		if (!agent->validateTarget(target))
+			return AiMap::RUNNING;
+
+		agent->setFollowObject(target);
+		agent->setDefender(target);
+
+		return AiMap::SUCCESS;
+	}
+
+	if (!agent->validateTarget())
+		return AiMap::RUNNING;
+
+	SceneObject* follow = agent->getFollowObject().get();
+	bool followInPeace = follow != NULL && follow->isCreatureObject() && follow->asCreatureObject()->hasState(CreatureState::PEACE);
+
+	if (followInPeace && ranLevel == 1 && !(target->isCreatureObject() && agent->isAggressiveTo(target->asCreatureObject()))) {
+		agent->clearCombatState(true);
+		agent->setOblivious();
+
+		return AiMap::FAILURE;
+	}
+
+	agent->setDefender(target);
+
+	return AiMap::SUCCESS;
+}
+
+bool NativeSelectWeaponBehavior::checkConditions(AiAgent* agent) {
+	if (agent->isDead()) {
+		agent->removeDefenders();
+		agent->setFollowObject(NULL);
+		return false;
+	}
+
+	return true;
+}
+
+int NativeSelectWeaponBehavior::doAction(AiAgent* agent) {
+	agent->selectWeapon();
+
+	return AiMap::SUCCESS;
+}
+
+int NativeSelectAttackBehavior::doAction(AiAgent* agent) {
+	if (agent->getCommandQueueSize() > 3)
+		return AiMap::SUCCESS;
+
+	if (agent->isCreature()) {
+		if (System::random(4) != 0) {
+			agent->selectDefaultAttack();
+		} else {
+			agent->selectSpecialAttack();
+
+			if (!agent->validateStateAttack())
+				agent->selectDefaultAttack();
+		}
+	} else {
+		agent->selectSpecialAttack();
+
+		if (!agent->validateStateAttack() || System::random(2) == 0)
+			agent->selectDefaultAttack();
+	}
+
+	agent->enqueueAttack();
+
+	return AiMap::SUCCESS;
+}
@@ -0,0 +1,184 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#ifndef NATIVEBEHAVIOR_H_
+#define NATIVEBEHAVIOR_H_
+
+#include "engine/engine.h"
+#include "server/zone/objects/creature/ai/bt/LuaBehavior.h"
+
+namespace server {
+namespace zone {
+namespace objects {
+namespace creature {
+namespace ai {
+namespace bt {
+
+/**
+ * C++ version of one of the Lua base behaviors in scripts/ai, used in its
+ * place by the templates for the Lua class it was registered with. Only the
+ * tick is native, interrupts still run the interrupt class of the Lua class.
+ */
+class NativeBehavior : public LuaBehavior {
+protected:
+	// run the awareness logic check instead of asking the Lua class
+	bool awareness;
+
+public:
+	/**
+	 * @param className Lua class the templates use, still used for interrupts
+	 * @param awareness true if the Lua class derives from DefaultInterrupt
+	 */
+	NativeBehavior(const String& className, bool awareness);
+
+	/**
+	 * @return new native behavior nativeName for className, NULL if there is no such native behavior
+	 */
+	static NativeBehavior* create(const String& nativeName, const String& className, bool awareness);
+
+	// Ai
+	bool checkConditions(AiAgent* agent);
+
+	void start(AiAgent* agent) {
+	}
+
+	float end(AiAgent* agent) {
+		return 0;
+	}
+
+	int doAction(AiAgent* agent);
+
+	bool doAwarenessCheck(AiAgent* agent, SceneObject* target);
+};
+
+// CompositeBase
+class NativeCompositeBehavior : public NativeBehavior {
+public:
+	NativeCompositeBehavior(const String& className, bool awareness) : NativeBehavior(className, awareness) {
+	}
+
+	int doAction(AiAgent* agent);
+};
+
+// WaitBase, waits until stopped
+class NativeWaitBehavior : public NativeBehavior {
+public:
+	NativeWaitBehavior(const String& className, bool awareness) : NativeBehavior(className, awareness) {
+	}
+
+	void start(AiAgent* agent);
+
+	float end(AiAgent* agent);
+
+	int doAction(AiAgent* agent);
+
+	/**
+	 * @return seconds to wait, negative to wait until stopped
+	 */
+	virtual int getWait(AiAgent* agent) {
+		return -1;
+	}
+};
+
+// Wait10Base
+class NativeWait10Behavior : public NativeWaitBehavior {
+public:
+	NativeWait10Behavior(const String& className, bool awareness) : NativeWaitBehavior(className, awareness) {
+	}
+
+	int getWait(AiAgent* agent);
+};
+
+// MoveBase, runs to the destination
+class NativeMoveBehavior : public NativeBehavior {
+public:
+	NativeMoveBehavior(const String& className, bool awareness) : NativeBehavior(className, awareness) {
+	}
+
+	bool checkConditions(AiAgent* agent);
+
+	int doAction(AiAgent* agent);
+
+	virtual bool findNextPosition(AiAgent* agent);
+
+	/**
+	 * @return true if the agent or what it follows is further than range from home
+	 */
+	static bool shouldRetreat(AiAgent* agent, float range);
+};
+
+// WalkBase
+class NativeWalkBehavior : public NativeMoveBehavior {
+public:
+	NativeWalkBehavior(const String& className, bool awareness) : NativeMoveBehavior(className, awareness) {
+	}
+
+	bool findNextPosition(AiAgent* agent);
+};
+
+// CombatMoveBase
+class NativeCombatMoveBehavior : public NativeMoveBehavior {
+public:
+	NativeCombatMoveBehavior(const String& className, bool awareness) : NativeMoveBehavior(className, awareness) {
+	}
+
+	int doAction(AiAgent* agent);
+};
+
+// GeneratePatrolBase
+class NativeGeneratePatrolBehavior : public NativeBehavior {
+public:
+	NativeGeneratePatrolBehavior(const String& className, bool awareness) : NativeBehavior(className, awareness) {
+	}
+
+	int doAction(AiAgent* agent);
+};
+
+// GetTargetBase
+class NativeGetTargetBehavior : public NativeBehavior {
+public:
+	NativeGetTargetBehavior(const String& className, bool awareness) : NativeBehavior(className, awareness) {
+	}
+
+	bool checkConditions(AiAgent* agent);
+
+	int doAction(AiAgent* agent);
+
+	/**
+	 * Follows and defends against target if it is still valid
+	 * @return behavior status, RUNNING if another target should be tried
+	 */
+	int selectTarget(AiAgent* agent, SceneObject* target, int ranLevel);
+};
+
+// SelectWeaponBase
+class NativeSelectWeaponBehavior : public NativeBehavior {
+public:
+	NativeSelectWeaponBehavior(const String& className, bool awareness) : NativeBehavior(className, awareness) {
+	}
+
+	bool checkConditions(AiAgent* agent);
+
+	int doAction(AiAgent* agent);
+};
+
+// SelectAttackBase
+class NativeSelectAttackBehavior : public NativeSelectWeaponBehavior {
+public:
+	NativeSelectAttackBehavior(const String& className, bool awareness) : NativeSelectWeaponBehavior(className, awareness) {
+	}
+
+	int doAction(AiAgent* agent);
+};
+
+}
+}
+}
+}
+}
+}
+
+using namespace server::zone::objects::creature::ai::bt;
+
+#endif /* NATIVEBEHAVIOR_H_ */
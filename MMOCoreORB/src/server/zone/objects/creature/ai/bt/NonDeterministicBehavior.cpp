@@ -7,21 +7,34 @@
 
 #include "NonDeterministicBehavior.h"
 
-NonDeterministicBehavior::NonDeterministicBehavior(AiAgent* _agent, const String& className) : CompositeBehavior(_agent, className) {
-
+NonDeterministicBehavior::NonDeterministicBehavior(const String& className) : CompositeBehavior(className) {
+	orderOffset = 0;
 }
 
-void NonDeterministicBehavior::start() {
+void NonDeterministicBehavior::start(AiAgent* agent) {
+	uint16* order = agent->getBehaviorState()->getOrder(orderOffset);
+
+	for (int i = 0; i < children.size(); i++)
+		order[i] = i;
+
 	// this is literally just a shuffle algorithm
-	Behavior* temp;
+	uint16 temp;
 	int index;
 	for (int i = 0; i < children.size(); i++) {
 		index = (int) System::random(children.size() - 1 - i) + i;
-		temp = children.set(i, children.get(index));
-		children.set(index, temp);
+		temp = order[i];
+		order[i] = order[index];
+		order[index] = temp;
 	}
 
-	CompositeBehavior::start();
+	CompositeBehavior::start(agent);
+}
+
+Behavior* NonDeterministicBehavior::getChild(AiAgent* agent, int position) {
+	if (position < 0 || position >= children.size())
+		return children.get(position);
+
+	return children.get(agent->getBehaviorState()->getOrder(orderOffset)[position]);
 }
 
 
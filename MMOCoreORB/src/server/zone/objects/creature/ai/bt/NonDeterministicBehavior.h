@@ -18,9 +18,23 @@ namespace ai {
 namespace bt {
 
 class NonDeterministicBehavior : public virtual CompositeBehavior {
+protected:
+	// first slot of the child order in the BehaviorState
+	int orderOffset;
+
 public:
-	NonDeterministicBehavior(AiAgent* _agent, const String& className);
-	void start();
+	NonDeterministicBehavior(const String& className);
+	void start(AiAgent* agent);
+
+	Behavior* getChild(AiAgent* agent, int position);
+
+	int getOrderSize() {
+		return children.size();
+	}
+
+	void setOrderOffset(int offset) {
+		orderOffset = offset;
+	}
 };
 
 }
@@ -20,7 +20,7 @@ namespace bt {
 
 class NonDeterministicSequenceBehavior : public SequenceBehavior, public NonDeterministicBehavior {
 public:
-	NonDeterministicSequenceBehavior(AiAgent* _agent, const String& className) : CompositeBehavior(_agent, className), SequenceBehavior(_agent, className), NonDeterministicBehavior(_agent, className) {
+	NonDeterministicSequenceBehavior(const String& className) : CompositeBehavior(className), SequenceBehavior(className), NonDeterministicBehavior(className) {
 	}
 };
 
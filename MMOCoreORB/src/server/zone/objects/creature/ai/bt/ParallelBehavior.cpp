@@ -6,73 +6,86 @@
  */
 
 #include "ParallelBehavior.h"
+#include "server/zone/managers/creature/AiMap.h"
 
-ParallelBehavior::ParallelBehavior(AiAgent* _agent, const String& className) : CompositeBehavior(_agent, className) {
-	numFailed = 0;
-	numSucceeded = 0;
+ParallelBehavior::ParallelBehavior(const String& className) : CompositeBehavior(className) {
 }
 
-void ParallelBehavior::start() {
-	unfinishedChildren = children;
-	numFailed = 0;
-	numSucceeded = 0;
+void ParallelBehavior::start(AiAgent* agent) {
+	BehaviorNodeState& state = getState(agent);
+	state.numFailed = 0;
+	state.numSucceeded = 0;
 
-	CompositeBehavior::start();
+	// resets the ended flag of every child
+	CompositeBehavior::start(agent);
 }
 
-void ParallelBehavior::end() {
-	unfinishedChildren.removeAll();
-	CompositeBehavior::end();
+void ParallelBehavior::end(AiAgent* agent) {
+	for (int i = 0; i < children.size(); i++) {
+		Behavior* currentChild = children.get(i);
+
+		if (currentChild != NULL)
+			currentChild->getState(agent).ended = true;
+	}
+
+	CompositeBehavior::end(agent);
 }
 
-void ParallelBehavior::doAction(bool directlyExecuted) {
-	if (finished()) {
-		Behavior::doAction(directlyExecuted);
+void ParallelBehavior::doAction(AiAgent* agent, bool directlyExecuted) {
+	if (finished(agent)) {
+		Behavior::doAction(agent, directlyExecuted);
 		return;
 	}
 
-	if (!started())
-		this->start();
+	if (!started(agent))
+		this->start(agent);
+
+	int unfinishedChildren = 0;
 
 	for (int i = 0; i < children.size(); i++) {
 		Behavior* currentChild = children.get(i);
 
 		if (currentChild == NULL) { // this shouldn't happen. Bail.
-			Reference<AiAgent*> agent = this->agent.get();
 			agent->error("NULL child or empty children list in ParallelBehavior");
-			endWithError();
-			Behavior::doAction(directlyExecuted);
+			endWithError(agent);
+			Behavior::doAction(agent, directlyExecuted);
 			return;
 		}
 
-		if (!unfinishedChildren.contains(currentChild)) // we don't want to process a child after it has already ended
+		BehaviorNodeState& childState = currentChild->getState(agent);
+
+		if (childState.ended) // we don't want to process a child after it has already ended
 			continue;
 
-		if (!currentChild->started())
-			currentChild->start();
-		else if (currentChild->finished()) {
-			if (currentChild->succeeded())
-				this->childSucceeded();
-			else if (currentChild->failed())
-				this->childFailed();
+		if (!currentChild->started(agent))
+			currentChild->start(agent);
+		else if (currentChild->finished(agent)) {
+			if (currentChild->succeeded(agent))
+				this->childSucceeded(agent);
+			else if (currentChild->failed(agent))
+				this->childFailed(agent);
+
+			currentChild->end(agent);
+			childState.ended = true;
 
-			currentChild->end();
-			unfinishedChildren.removeElement(currentChild);
+			continue;
 		} else {
-			currentChild->doAction();
+			currentChild->doAction(agent);
 		}
+
+		unfinishedChildren++;
 	}
 
-	if (unfinishedChildren.isEmpty())
-		this->finish();
+	if (unfinishedChildren == 0)
+		this->finish(agent);
 
-	Behavior::doAction(directlyExecuted);
+	Behavior::doAction(agent, directlyExecuted);
 }
 
-void ParallelBehavior::childFailed() {
-	numFailed++;
+void ParallelBehavior::childFailed(AiAgent* agent) {
+	getState(agent).numFailed++;
 }
 
-void ParallelBehavior::childSucceeded() {
-	numSucceeded++;
+void ParallelBehavior::childSucceeded(AiAgent* agent) {
+	getState(agent).numSucceeded++;
 }
@@ -18,20 +18,15 @@ namespace ai {
 namespace bt {
 
 class ParallelBehavior : public CompositeBehavior {
-protected:
-	Vector<Behavior*> unfinishedChildren;
-	uint16 numFailed;
-	uint16 numSucceeded;
-
 public:
-	ParallelBehavior(AiAgent* _agent, const String& className);
-	void start();
-	void end();
-	void doAction(bool directlyExecuted = false);
-	void childSucceeded();
-	void childFailed();
-
-	virtual void finish() = 0;
+	ParallelBehavior(const String& className);
+	void start(AiAgent* agent);
+	void end(AiAgent* agent);
+	void doAction(AiAgent* agent, bool directlyExecuted = false);
+	void childSucceeded(AiAgent* agent);
+	void childFailed(AiAgent* agent);
+
+	virtual void finish(AiAgent* agent) = 0;
 };
 
 }
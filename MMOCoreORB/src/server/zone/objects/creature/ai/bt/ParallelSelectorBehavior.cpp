@@ -7,14 +7,14 @@
 
 #include "ParallelSelectorBehavior.h"
 
-ParallelSelectorBehavior::ParallelSelectorBehavior(AiAgent* _agent, const String& className) : ParallelBehavior(_agent, className) {
+ParallelSelectorBehavior::ParallelSelectorBehavior(const String& className) : ParallelBehavior(className) {
 }
 
-void ParallelSelectorBehavior::finish() {
-	if (numSucceeded > 0)
-		endWithSuccess();
+void ParallelSelectorBehavior::finish(AiAgent* agent) {
+	if (getState(agent).numSucceeded > 0)
+		endWithSuccess(agent);
 	else
-		endWithFailure();
+		endWithFailure(agent);
 }
 
 
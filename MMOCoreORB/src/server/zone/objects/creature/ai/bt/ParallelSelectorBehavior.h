@@ -19,8 +19,8 @@ namespace bt {
 
 class ParallelSelectorBehavior : public ParallelBehavior {
 public:
-	ParallelSelectorBehavior(AiAgent* _agent, const String& className);
-	void finish();
+	ParallelSelectorBehavior(const String& className);
+	void finish(AiAgent* agent);
 };
 
 }
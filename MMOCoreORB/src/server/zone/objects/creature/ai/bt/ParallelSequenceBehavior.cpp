@@ -8,14 +8,14 @@
 
 #include "ParallelSequenceBehavior.h"
 
-ParallelSequenceBehavior::ParallelSequenceBehavior(AiAgent* _agent, const String& className) : ParallelBehavior(_agent, className) {
+ParallelSequenceBehavior::ParallelSequenceBehavior(const String& className) : ParallelBehavior(className) {
 }
 
-void ParallelSequenceBehavior::finish() {
-	if (numFailed > 0)
-		endWithFailure();
+void ParallelSequenceBehavior::finish(AiAgent* agent) {
+	if (getState(agent).numFailed > 0)
+		endWithFailure(agent);
 	else
-		endWithSuccess();
+		endWithSuccess(agent);
 }
 
 
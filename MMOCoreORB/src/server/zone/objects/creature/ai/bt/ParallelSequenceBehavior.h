@@ -19,8 +19,8 @@ namespace bt {
 
 class ParallelSequenceBehavior : public ParallelBehavior {
 public:
-	ParallelSequenceBehavior(AiAgent* _agent, const String& className);
-	void finish();
+	ParallelSequenceBehavior(const String& className);
+	void finish(AiAgent* agent);
 };
 
 }
@@ -8,41 +8,42 @@
 #include "SelectorBehavior.h"
 #include "server/zone/managers/creature/AiMap.h"
 
-SelectorBehavior::SelectorBehavior(AiAgent* _agent, const String& className) : CompositeBehavior(_agent, className) {
+SelectorBehavior::SelectorBehavior(const String& className) : CompositeBehavior(className) {
 
 }
 
-void SelectorBehavior::childSucceeded() {
-	endWithSuccess();
+void SelectorBehavior::childSucceeded(AiAgent* agent) {
+	endWithSuccess(agent);
 }
 
-void SelectorBehavior::childFailed() {
+void SelectorBehavior::childFailed(AiAgent* agent) {
+	BehaviorNodeState& state = getState(agent);
 	Behavior* currentChild;
 
 	try {
 		do {
-			currentPos++;
+			state.position++;
 
 			// TODO (dannuic): This if block is here because the out of bounds exception doesn't work like expected
-			if (currentPos >= children.size()) {
+			if (state.position >= children.size()) {
 				currentChild = NULL;
-				currentPos = 0;
-				endWithFailure();
+				state.position = 0;
+				endWithFailure(agent);
 				return;
 			}
 
-			currentChild = children.get(currentPos);
+			currentChild = getChild(agent, state.position);
 
 			if (currentChild == NULL) { // uh oh, this shouldn't happen
-				currentPos = 0;
-				endWithError();
+				state.position = 0;
+				endWithError(agent);
 				return;
 			}
 
-		} while (!currentChild->checkConditions());
+		} while (!currentChild->checkConditions(agent));
 	} catch (ArrayIndexOutOfBoundsException &e) { // TODO (dannuic): Why doesn't this ever happen? currentPos just decrements and no exception is thrown...
 		currentChild = NULL;
-		currentPos = 0;
-		endWithFailure();
+		state.position = 0;
+		endWithFailure(agent);
 	}
 }
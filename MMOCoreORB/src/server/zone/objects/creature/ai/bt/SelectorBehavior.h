@@ -19,9 +19,9 @@ namespace bt {
 
 class SelectorBehavior : public virtual CompositeBehavior {
 public:
-	SelectorBehavior(AiAgent* _agent, const String& className);
-	void childSucceeded();
-	void childFailed();
+	SelectorBehavior(const String& className);
+	void childSucceeded(AiAgent* agent);
+	void childFailed(AiAgent* agent);
 };
 
 }
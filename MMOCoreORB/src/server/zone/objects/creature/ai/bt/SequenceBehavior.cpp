@@ -8,22 +8,24 @@
 #include "SequenceBehavior.h"
 #include "server/zone/managers/creature/AiMap.h"
 
-SequenceBehavior::SequenceBehavior(AiAgent* _agent, const String& className) : CompositeBehavior(_agent, className) {
+SequenceBehavior::SequenceBehavior(const String& className) : CompositeBehavior(className) {
 
 }
 
-void SequenceBehavior::childSucceeded() {
-	if (currentPos == children.size() - 1)
-		endWithSuccess();
+void SequenceBehavior::childSucceeded(AiAgent* agent) {
+	BehaviorNodeState& state = getState(agent);
+
+	if (state.position == children.size() - 1)
+		endWithSuccess(agent);
 	else {
-		currentPos++;
-		Behavior* currentChild = children.get(currentPos);
-		if (currentChild == NULL || !currentChild->checkConditions())
-			endWithFailure();
+		state.position++;
+		Behavior* currentChild = getChild(agent, state.position);
+		if (currentChild == NULL || !currentChild->checkConditions(agent))
+			endWithFailure(agent);
 	}
 }
 
-void SequenceBehavior::childFailed() {
-	endWithFailure();
+void SequenceBehavior::childFailed(AiAgent* agent) {
+	endWithFailure(agent);
 }
 
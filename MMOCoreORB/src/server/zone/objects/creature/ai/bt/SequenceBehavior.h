@@ -19,9 +19,9 @@ namespace bt {
 
 class SequenceBehavior : public virtual CompositeBehavior {
 public:
-	SequenceBehavior(AiAgent* _agent, const String& className);
-	void childSucceeded();
-	void childFailed();
+	SequenceBehavior(const String& className);
+	void childSucceeded(AiAgent* agent);
+	void childFailed(AiAgent* agent);
 };
 
 }
@@ -0,0 +1,455 @@
+/*
+ * BehaviourTest.cpp
+ *
+ *  Created on: Aug 24, 2013
+ *      Author: swgemu
+ */
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "MockBehavior.h"
+#include "server/zone/managers/creature/AiMap.h"
+#include "server/zone/objects/creature/ai/bt/BehaviorTree.h"
+#include "server/zone/objects/creature/ai/bt/NativeBehavior.h"
+#include "server/zone/objects/creature/ai/bt/SequenceBehavior.h"
+#include "server/zone/objects/creature/ai/bt/SelectorBehavior.h"
+#include "server/zone/objects/creature/ai/bt/NonDeterministicSelectorBehavior.h"
+#include "server/zone/Zone.h"
+#include "server/zone/ZoneServer.h"
+#include "server/zone/ZoneProcessServer.h"
+#include "server/zone/managers/director/DirectorManager.h"
+#include "conf/ConfigManager.h"
+
+using ::testing::_;
+using ::testing::AtLeast;
+using ::testing::AnyNumber;
+using ::testing::Return;
+using ::testing::Invoke;
+using ::testing::Sequence;
+using ::testing::Assign;
+using ::testing::DoAll;
+using ::testing::Mock;
+using ::testing::NiceMock;
+
+namespace server {
+namespace zone {
+namespace objects {
+namespace creature {
+namespace ai {
+namespace bt {
+namespace test {
+
+/**
+ * Leaf that takes ticks turns running, succeeding and failing without any lua
+ */
+class TickLeafBehavior : public LuaBehavior {
+	AtomicInteger ticks;
+
+public:
+	TickLeafBehavior() : LuaBehavior("tickleaf") {
+	}
+
+	bool checkConditions(AiAgent* agent) {
+		return true;
+	}
+
+	void start(AiAgent* agent) {
+	}
+
+	float end(AiAgent* agent) {
+		return 0;
+	}
+
+	int doAction(AiAgent* agent) {
+		switch (ticks.increment() % 3) {
+		case 0:
+			return AiMap::RUNNING;
+		case 1:
+			return AiMap::SUCCESS;
+		default:
+			return AiMap::FAILURE;
+		}
+	}
+};
+
+class BehaviorTest : public ::testing::Test {
+public:
+	Reference<MockAiAgent*> agent;
+	BehaviorTest() {
+		// Perform creation setup here.
+	}
+
+	~BehaviorTest() {
+		// Clean up.
+	}
+
+	void SetUp() {
+		agent = new MockAiAgent();
+	}
+
+	void TearDown() {
+		// Perform clean up of common constructs here.
+	}
+
+	void addNode(AiTemplate* aiTemplate, const String& id, const String& parent, uint16 classType, const String& className = "test") {
+		Reference<LuaAiTemplate*> node = new LuaAiTemplate();
+		node->id = id.hashCode();
+		node->className = className;
+		node->parent = parent.hashCode();
+		node->classType = classType;
+
+		aiTemplate->getTree()->add(node);
+	}
+
+	/**
+	 * Sequence root with a selector and a non deterministic selector of leaves under it
+	 */
+	Reference<AiTemplate*> createTemplate(const String& name, int leaves, const String& className = "test") {
+		Reference<AiTemplate*> aiTemplate = new AiTemplate(name);
+
+		addNode(aiTemplate, name + "root", "none", AiMap::SEQUENCEBEHAVIOR, className);
+		addNode(aiTemplate, name + "selector", name + "root", AiMap::SELECTORBEHAVIOR, className);
+		addNode(aiTemplate, name + "random", name + "root", AiMap::NONDETERMINISTICSELECTORBEHAVIOR, className);
+
+		for (int i = 0; i < leaves; ++i)
+			addNode(aiTemplate, name + "leaf" + String::valueOf(i), name + (i % 2 ? "selector" : "random"), AiMap::BEHAVIOR, className);
+
+		return aiTemplate;
+	}
+
+	/**
+	 * Bytes the nodes under node take, what every agent used to pay for a tree of its own
+	 */
+	int getNodeSize(Behavior* node) {
+		int size = sizeof(Behavior);
+
+		if (dynamic_cast<NonDeterministicSelectorBehavior*>(node) != NULL)
+			size = sizeof(NonDeterministicSelectorBehavior);
+		else if (dynamic_cast<SequenceBehavior*>(node) != NULL)
+			size = sizeof(SequenceBehavior);
+		else if (dynamic_cast<SelectorBehavior*>(node) != NULL)
+			size = sizeof(SelectorBehavior);
+
+		CompositeBehavior* composite = dynamic_cast<CompositeBehavior*>(node);
+
+		if (composite == NULL)
+			return size;
+
+		const Vector<Behavior*>& children = composite->getChildren();
+
+		size += children.size() * sizeof(Behavior*);
+
+		// order of the children of a non deterministic composite
+		if (dynamic_cast<NonDeterministicSelectorBehavior*>(node) != NULL)
+			size += children.size() * sizeof(uint16);
+
+		for (int i = 0; i < children.size(); ++i)
+			size += getNodeSize(children.get(i));
+
+		return size;
+	}
+
+	/**
+	 * Ticks behavior through a whole run iterations times
+	 * @return time taken in ms
+	 */
+	uint64 runBehavior(LuaBehavior* behavior, int iterations, int* results) {
+		Time start;
+
+		for (int i = 0; i < iterations; ++i) {
+			results[0] += behavior->checkConditions(agent);
+			behavior->start(agent);
+			results[1] += behavior->doAction(agent);
+			behavior->end(agent);
+			results[2] += behavior->doAction(agent);
+		}
+
+		return start.miliDifference();
+	}
+};
+
+TEST_F(BehaviorTest, SharedBehaviorTree) {
+	const int leaves = 64;
+	const int agents = 1000;
+
+	Reference<AiTemplate*> aiTemplate = createTemplate("shared", leaves);
+
+	Reference<BehaviorTree*> tree = AiMap::instance()->getBehaviorTree(aiTemplate);
+	ASSERT_TRUE(tree != NULL);
+
+	// every agent of a template gets the same nodes
+	EXPECT_EQ(tree.get(), AiMap::instance()->getBehaviorTree(aiTemplate).get());
+
+	EXPECT_EQ(leaves + 3, tree->getNodeCount());
+	EXPECT_EQ(String("sharedroot").hashCode(), tree->getRootID());
+
+	CompositeBehavior* root = cast<CompositeBehavior*>(tree->getBehavior(tree->getRootID()));
+	ASSERT_TRUE(root != NULL);
+	ASSERT_EQ(2, root->getChildren().size());
+	EXPECT_EQ(leaves / 2, cast<CompositeBehavior*>(root->getChildren().get(0))->getChildren().size());
+	EXPECT_EQ(root, root->getChildren().get(1)->getParent());
+
+	// indices address the blackboard slots
+	for (int i = 0; i < root->getChildren().size(); ++i)
+		EXPECT_LT(root->getChildren().get(i)->getIndex(), tree->getNodeCount());
+
+	Vector<Reference<BehaviorState*> > states;
+
+	Time stateStart;
+
+	for (int i = 0; i < agents; ++i)
+		states.add(tree->createState());
+
+	uint64 stateTime = stateStart.miliDifference();
+
+	Vector<Reference<BehaviorTree*> > trees;
+
+	Time treeStart;
+
+	for (int i = 0; i < agents; ++i)
+		trees.add(BehaviorTree::create(aiTemplate));
+
+	uint64 treeTime = treeStart.miliDifference();
+
+	int stateSize = states.get(0)->getMemorySize();
+	int treeSize = getNodeSize(root);
+
+	EXPECT_EQ(tree->getNodeCount(), states.get(0)->getNodeCount());
+	EXPECT_LT(stateSize, treeSize);
+
+	for (int i = 0; i < tree->getNodeCount(); ++i)
+		EXPECT_EQ(AiMap::SUSPEND, states.get(0)->get(i).status);
+
+	RecordProperty("state_bytes_per_agent", stateSize);
+	RecordProperty("tree_bytes_per_agent", treeSize);
+	RecordProperty("state_setup_ms", (int) stateTime);
+	RecordProperty("tree_setup_ms", (int) treeTime);
+}
+
+TEST_F(BehaviorTest, SharedBehaviorTreeTick) {
+	const int leaves = 64;
+	const int agents = 1000;
+	const int ticks = 50;
+
+	ConfigManager::instance()->loadConfigData();
+	ConfigManager::instance()->setProgressMonitors(false);
+
+	Reference<ZoneServer*> zoneServer = new ZoneServer(ConfigManager::instance());
+	Reference<ZoneProcessServer*> processServer = new ZoneProcessServer(zoneServer);
+	Reference<Zone*> zone = new Zone(processServer, "test_zone");
+	zone->createContainerComponent();
+	zone->_setObjectID(1);
+
+	AiMap::instance()->putBehavior("tickleaf", new TickLeafBehavior());
+
+	Reference<AiTemplate*> aiTemplate = createTemplate("tick", leaves, "tickleaf");
+	Reference<BehaviorTree*> tree = AiMap::instance()->getBehaviorTree(aiTemplate);
+	ASSERT_TRUE(tree != NULL);
+
+	Behavior* root = tree->getBehavior(tree->getRootID());
+	ASSERT_TRUE(root != NULL);
+
+	Vector<Reference<MockAiAgent*> > mockAgents;
+	Vector<Reference<BehaviorState*> > states;
+
+	for (int i = 0; i < agents; ++i) {
+		Reference<MockAiAgent*> mockAgent = agent;
+
+		if (i > 0)
+			mockAgent = new NiceMock<MockAiAgent>();
+		Reference<BehaviorState*> state = tree->createState();
+
+		ON_CALL(*mockAgent, getBehaviorState()).WillByDefault(Return(state.get()));
+		ON_CALL(*mockAgent, getZone()).WillByDefault(Return(zone.get()));
+
+		mockAgents.add(mockAgent);
+		states.add(state);
+	}
+
+	int finishedRuns = 0;
+
+	Time start;
+
+	for (int t = 0; t < ticks; ++t) {
+		for (int i = 0; i < agents; ++i) {
+			root->doAction(mockAgents.get(i), true);
+
+			if (!root->started(mockAgents.get(i)))
+				++finishedRuns;
+		}
+	}
+
+	uint64 tickTime = start.miliDifference();
+
+	// runs get through the whole tree, each agent on a state of its own
+	EXPECT_GT(finishedRuns, 0);
+
+	for (int i = 0; i < agents; ++i)
+		EXPECT_EQ(tree->getNodeCount(), states.get(i)->getNodeCount());
+
+	RecordProperty("agents", agents);
+	RecordProperty("tick_ms", (int) tickTime);
+	RecordProperty("ticks_per_ms", (int) (agents * ticks / MAX(tickTime, (uint64) 1)));
+}
+
+TEST_F(BehaviorTest, DefaultBehaviorTree) {
+	Reference<AiTemplate*> getTarget = createTemplate("getTarget", 4);
+	Reference<AiTemplate*> selectAttack = createTemplate("selectAttack", 4);
+	Reference<AiTemplate*> combatMove = createTemplate("combatMove", 4);
+	Reference<AiTemplate*> idle = createTemplate("idle", 4);
+
+	Reference<BehaviorTree*> tree = AiMap::instance()->getBehaviorTree("CompositeDefault", getTarget, selectAttack, combatMove, idle);
+	ASSERT_TRUE(tree != NULL);
+
+	EXPECT_EQ(tree.get(), AiMap::instance()->getBehaviorTree("CompositeDefault", getTarget, selectAttack, combatMove, idle).get());
+	EXPECT_NE(tree.get(), AiMap::instance()->getBehaviorTree("CompositePack", getTarget, selectAttack, combatMove, idle).get());
+
+	EXPECT_EQ(2 + 4 * 7, tree->getNodeCount());
+
+	CompositeBehavior* root = cast<CompositeBehavior*>(tree->getBehavior(STRING_HASHCODE("root")));
+	ASSERT_TRUE(root != NULL);
+	ASSERT_EQ(2, root->getChildren().size());
+	EXPECT_EQ(String("idleroot").hashCode(), root->getChildren().get(1)->getID());
+
+	CompositeBehavior* attackSequence = cast<CompositeBehavior*>(root->getChildren().get(0));
+	ASSERT_EQ(3, attackSequence->getChildren().size());
+	EXPECT_EQ(String("getTargetroot").hashCode(), attackSequence->getChildren().get(0)->getID());
+	EXPECT_EQ(String("combatMoveroot").hashCode(), attackSequence->getChildren().get(2)->getID());
+}
+TEST_F(BehaviorTest, NativeBehaviorBenchmark) {
+	const int iterations = 10000;
+
+	ConfigManager::instance()->loadConfigData();
+
+	// loads the lua AI classes and templates
+	DirectorManager::instance()->getLuaInstance();
+
+	// idlewait runs the Wait leaf under a composite
+	const char* classNames[] = { "CompositeDefault", "WaitDefault" };
+	const char* nativeNames[] = { "Composite", "Wait" };
+
+	uint64 luaTime = 0, nativeTime = 0;
+
+	for (int i = 0; i < 2; ++i) {
+		// the templates get the native version
+		EXPECT_TRUE(dynamic_cast<NativeBehavior*>(AiMap::instance()->getBehavior(classNames[i]).get()) != NULL);
+
+		Reference<LuaBehavior*> luaBehavior = new LuaBehavior(classNames[i]);
+		Reference<LuaBehavior*> nativeBehavior = NativeBehavior::create(nativeNames[i], classNames[i], true);
+		ASSERT_TRUE(nativeBehavior != NULL);
+
+		int luaResults[3] = { 0, 0, 0 };
+		int nativeResults[3] = { 0, 0, 0 };
+
+		luaTime += runBehavior(luaBehavior, iterations, luaResults);
+		nativeTime += runBehavior(nativeBehavior, iterations, nativeResults);
+
+		for (int j = 0; j < 3; ++j)
+			EXPECT_EQ(luaResults[j], nativeResults[j]) << classNames[i] << " result " << j;
+	}
+
+	EXPECT_TRUE(NativeBehavior::create("Unknown", "WaitDefault", true) == NULL);
+
+	RecordProperty("lua_ms", (int) luaTime);
+	RecordProperty("native_ms", (int) nativeTime);
+}
+
+/*TEST_F(BehaviorTest, testInitialize) {
+	MockBehavior mock;
+	BehaviorTree tree;
+	ON_CALL(mock,update(_)).WillByDefault(Return(Behavior::RUNNING));
+	EXPECT_CALL(mock,onInitialize(_)).Times(AtLeast(1));
+	EXPECT_CALL(mock,update(_)).Times(AtLeast(1));
+	EXPECT_CALL(mock,canObserve()).Times(AtLeast(1));
+	tree.start(&mock,actor);
+	tree.tick(actor);
+
+}
+TEST_F(BehaviorTest, testUpdate) {
+	MockBehavior mock;
+	BehaviorTree tree;
+	EXPECT_CALL(mock,onTerminate(_,_)).Times(AtLeast(0));
+	EXPECT_CALL(mock,onInitialize(_)).Times(AtLeast(1));
+	EXPECT_CALL(mock,update(_)).WillOnce(Return(Behavior::RUNNING));
+	EXPECT_CALL(mock,canObserve()).Times(AtLeast(1));
+	tree.start(&mock,actor);
+	tree.tick(actor);
+	EXPECT_CALL(mock,update(_)).WillOnce(Return(Behavior::RUNNING));
+	tree.tick(actor);
+}
+TEST_F(BehaviorTest, testTerminate) {
+	MockBehavior mock;
+	BehaviorTree tree;
+	EXPECT_CALL(mock,onTerminate(_,_)).Times(AtLeast(1));
+	EXPECT_CALL(mock,canObserve()).Times(AtLeast(1));
+	EXPECT_CALL(mock,onInitialize(_)).Times(AtLeast(1));
+	EXPECT_CALL(mock,update(_)).WillOnce(Return(Behavior::RUNNING));
+	tree.start(&mock,actor);
+	tree.tick(actor);
+	EXPECT_CALL(mock,update(_)).WillOnce(Return(Behavior::SUCCESS));
+	tree.tick(actor);
+}
+TEST_F(BehaviorTest, testAbort) {
+	MockBehavior mock;
+	BehaviorTree tree;
+	EXPECT_CALL(mock,onTerminate(_,_)).Times(AtLeast(0));
+	EXPECT_CALL(mock,canObserve()).Times(AtLeast(0));
+	EXPECT_CALL(mock,onInitialize(_)).Times(AtLeast(0));
+	EXPECT_CALL(mock,update(_)).Times(AtLeast(0));
+	tree.start(&mock,actor);
+	tree.tick(NULL);
+
+}
+TEST_F(BehaviorTest, testSingleNodeTreePassAndFail) {
+	int status[2] = { Behavior::SUCCESS,Behavior::FAILURE };
+	for (int i=0; i<2; ++i) {
+		BehaviorTree tree;
+		MockSequenceBehavior mock(&tree,1);
+		EXPECT_CALL(mock,onInitialize(_)).Times(AtLeast(1));
+		EXPECT_CALL(mock,update(_)).WillOnce(Return(Behavior::RUNNING));
+		EXPECT_CALL(mock,canObserve()).Times(AtLeast(1));
+		tree.start(&mock,actor);
+		tree.tick(actor);
+		EXPECT_CALL(mock,update(_)).WillOnce(Return(status[i]));
+		EXPECT_CALL(mock,onTerminate(_,_)).Times(AtLeast(1));
+		EXPECT_CALL(mock,canObserve()).Times(AtLeast(1));
+		tree.tick(actor);
+		Mock::VerifyAndClearExpectations(&mock);
+		actor->resetBehaviorList(&tree);
+	}
+
+}
+TEST_F(BehaviorTest, testTwoNodesWithFailingBehavior) {
+	BehaviorTree tree;
+	MockSequenceBehavior mock(&tree,2);
+	EXPECT_CALL(mock,onInitialize(_)).Times(AtLeast(1));
+	EXPECT_CALL(mock,update(_)).WillOnce(Return(Behavior::RUNNING));
+	EXPECT_CALL(mock,onTerminate(_,_)).Times(AtLeast(1));
+	EXPECT_CALL(mock,canObserve()).Times(AtLeast(1));
+	tree.start(&mock,actor);
+	tree.tick(actor);
+	EXPECT_CALL(mock,canObserve()).Times(AtLeast(1));
+	EXPECT_CALL(mock,update(_)).WillOnce(Return(Behavior::FAILURE));
+	tree.tick(actor);
+
+}
+TEST_F(BehaviorTest, testTwoNodeWithRunningBehavior) {
+	BehaviorTree tree;
+	MockSequenceBehavior mock(&tree,2);
+	EXPECT_CALL(mock,onInitialize(_)).Times(AtLeast(1));
+	EXPECT_CALL(mock,update(_)).WillOnce(Return(Behavior::RUNNING));
+	EXPECT_CALL(mock,onTerminate(_,_)).Times(AtLeast(0));
+	EXPECT_CALL(mock,canObserve()).Times(AtLeast(0));
+	tree.start(&mock,actor);
+	tree.tick(actor);
+	EXPECT_CALL(mock,update(_)).WillOnce(Return(Behavior::RUNNING));
+	tree.tick(actor);
+}*/
+
+}
+}
+}
+}
+}
+}
+}
@@ -0,0 +1,39 @@
+/*
+ * MockBehaviour.h
+ *
+ *  Created on: Aug 24, 2013
+ *      Author: swgemu
+ */
+#include "gmock/gmock.h"
+#include "server/zone/objects/creature/ai/bt/Behavior.h"
+
+#ifndef MOCKBEHAVIOUR_H_
+#define MOCKBEHAVIOUR_H_
+
+namespace server {
+namespace zone {
+namespace objects {
+namespace creature {
+namespace ai {
+namespace bt {
+
+class MockBehavior: public Behavior {
+public:
+	MockBehavior(String className) : Behavior(className) {
+	}
+
+	MOCK_METHOD1(checkConditions, bool(AiAgent*));
+	MOCK_METHOD1(start, void(AiAgent*));
+	MOCK_METHOD1(end, void(AiAgent*));
+	MOCK_METHOD2(doAction, void(AiAgent*, bool));
+};
+
+}
+}
+}
+}
+}
+}
+
+
+#endif /* MOCKBEHAVIOUR_H_ */
@@ -0,0 +1,49 @@
+/*
+ * MockBehaviorSequence.h
+ *
+ *  Created on: Aug 28, 2013
+ *      Author: swgemu
+ */
+
+#ifndef MOCKCOMPOSITEBEHAVIOR_H_
+#define MOCKCOMPOSITEBEHAVIOR_H_
+#include "gmock/gmock.h"
+#include "server/zone/objects/creature/ai/bt/Behavior.h"
+#include "MockBehavior.h"
+#include "server/zone/objects/creature/ai/bt/CompositeBehavior.h"
+
+
+namespace server {
+namespace zone {
+namespace objects {
+namespace creature {
+namespace ai {
+namespace bt {
+
+class MockCompositeBehavior: public CompositeBehavior {
+public:
+	MockCompositeBehavior(String className, uint32 size) : CompositeBehavior(className) {
+		for(uint32 i=0; i<size; i++) {
+			children.add(new MockBehavior(className));
+		}
+	}
+
+	~MockCompositeBehavior() {
+		children.removeAll();
+	}
+
+	MOCK_METHOD1(checkConditions, bool(AiAgent*));
+	MOCK_METHOD1(start, void(AiAgent*));
+	MOCK_METHOD1(end, void(AiAgent*));
+	MOCK_METHOD2(doAction, void(AiAgent*, bool));
+};
+
+}
+}
+}
+}
+}
+}
+
+
+#endif /* MOCKCOMPOSITEBEHAVIOR_H_ */
@@ -0,0 +1,588 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "server/zone/managers/creature/AiMap.h"
+#include "server/zone/objects/creature/ai/AiAgent.h"
+#include "server/zone/objects/creature/ai/PatrolPoint.h"
+#include "server/zone/objects/creature/ai/bt/BehaviorTree.h"
+#include "server/zone/objects/creature/ai/bt/CompositeBehavior.h"
+#include "server/zone/objects/creature/ai/bt/NativeBehavior.h"
+#include "server/zone/Zone.h"
+#include "server/zone/ZoneServer.h"
+#include "server/zone/ZoneProcessServer.h"
+#include "server/zone/managers/director/DirectorManager.h"
+#include "templates/params/creature/CreatureState.h"
+#include "conf/ConfigManager.h"
+
+using ::testing::_;
+using ::testing::Return;
+using ::testing::Invoke;
+using ::testing::NiceMock;
+
+namespace server {
+namespace zone {
+namespace objects {
+namespace creature {
+namespace ai {
+namespace bt {
+namespace test {
+
+/**
+ * Agent that takes the creature branches of the behaviors
+ */
+class CreatureMockAiAgent : public NiceMock<MockAiAgent> {
+public:
+	bool isCreature() {
+		return true;
+	}
+};
+
+/**
+ * What the agent sees during a tick, the lua and the native run get the same
+ */
+class AiScenario {
+public:
+	SceneObject* mapTarget;
+	SceneObject* defenderTarget;
+	SceneObject* followObject;
+
+	// validateTarget(target) fails for this one only
+	SceneObject* invalidTarget;
+
+	bool followValid;
+	bool aggressive;
+	int destination;
+	bool retreating;
+	bool nextPosition;
+	bool stateAttackValid;
+
+	PatrolPoint homeLocation;
+
+	AiScenario() : homeLocation(0, 0, 0) {
+		mapTarget = NULL;
+		defenderTarget = NULL;
+		followObject = NULL;
+		invalidTarget = NULL;
+
+		followValid = true;
+		aggressive = false;
+		destination = 1;
+		retreating = false;
+		nextPosition = false;
+		stateAttackValid = true;
+	}
+};
+
+class NativeBehaviorTest : public ::testing::Test {
+public:
+	static const uint64 AGENTID = 100;
+
+	void SetUp() {
+		ConfigManager::instance()->loadConfigData();
+		ConfigManager::instance()->setProgressMonitors(false);
+
+		// loads the lua AI classes and templates
+		DirectorManager::instance()->getLuaInstance();
+	}
+
+	void TearDown() {
+	}
+
+	Reference<CreatureObject*> createTarget(uint64 objectID, float x, float y) {
+		Reference<CreatureObject*> target = new CreatureObject();
+		target->_setObjectID(objectID);
+		target->initializePosition(x, 0, y);
+
+		return target;
+	}
+
+	/**
+	 * Agent answering from scenario, actions it takes are added to log in the order they are taken
+	 */
+	Reference<MockAiAgent*> createAgent(AiScenario* scenario, Vector<String>* log, bool creature = false) {
+		Reference<MockAiAgent*> agent;
+
+		if (creature)
+			agent = new CreatureMockAiAgent();
+		else
+			agent = new NiceMock<MockAiAgent>();
+
+		agent->_setObjectID(AGENTID);
+		agent->initializePosition(0, 0, 0);
+
+		ON_CALL(*agent, getTargetFromMap()).WillByDefault(Invoke([scenario]() { return scenario->mapTarget; }));
+		ON_CALL(*agent, getTargetFromDefenders()).WillByDefault(Invoke([scenario]() { return scenario->defenderTarget; }));
+		ON_CALL(*agent, getFollowObject()).WillByDefault(Invoke([scenario]() { return ManagedWeakReference<SceneObject*>(scenario->followObject); }));
+		ON_CALL(*agent, getHomeLocation()).WillByDefault(Return(&scenario->homeLocation));
+		ON_CALL(*agent, isRetreating()).WillByDefault(Invoke([scenario]() { return scenario->retreating; }));
+		ON_CALL(*agent, getMaxDistance()).WillByDefault(Return(10.f));
+
+		ON_CALL(*agent, validateTarget(_)).WillByDefault(Invoke([scenario, log](SceneObject* target) {
+			logAction(log, "validateTarget " + String::valueOf(target->getObjectID()));
+			return target != scenario->invalidTarget;
+		}));
+
+		ON_CALL(*agent, validateTarget()).WillByDefault(Invoke([scenario, log]() {
+			logAction(log, "validateFollow");
+			return scenario->followValid;
+		}));
+
+		ON_CALL(*agent, isAggressiveTo(_)).WillByDefault(Invoke([scenario, log](CreatureObject* target) {
+			logAction(log, "isAggressiveTo " + String::valueOf(target->getObjectID()));
+			return scenario->aggressive;
+		}));
+
+		ON_CALL(*agent, setDestination()).WillByDefault(Invoke([scenario, log]() {
+			logAction(log, "setDestination");
+			return scenario->destination;
+		}));
+
+		ON_CALL(*agent, findNextPosition(_, _)).WillByDefault(Invoke([scenario, log](float maxDistance, bool walk) {
+			logAction(log, "findNextPosition " + String::valueOf((int) walk));
+			return scenario->nextPosition;
+		}));
+
+		ON_CALL(*agent, validateStateAttack()).WillByDefault(Invoke([scenario, log]() {
+			logAction(log, "validateStateAttack");
+			return scenario->stateAttackValid;
+		}));
+
+		ON_CALL(*agent, setFollowObject(_)).WillByDefault(Invoke([log](SceneObject* target) {
+			logAction(log, "setFollowObject " + String::valueOf(target == NULL ? 0 : target->getObjectID()));
+		}));
+
+		ON_CALL(*agent, setDefender(_)).WillByDefault(Invoke([log](SceneObject* target) {
+			logAction(log, "setDefender " + String::valueOf(target->getObjectID()));
+		}));
+
+		ON_CALL(*agent, clearCombatState(_)).WillByDefault(Invoke([log](bool clearDefenders) {
+			logAction(log, "clearCombatState " + String::valueOf((int) clearDefenders));
+		}));
+
+		ON_CALL(*agent, setOblivious()).WillByDefault(Invoke([log]() { logAction(log, "setOblivious"); }));
+		ON_CALL(*agent, leash()).WillByDefault(Invoke([log]() { logAction(log, "leash"); }));
+
+		ON_CALL(*agent, completeMove()).WillByDefault(Invoke([log]() {
+			logAction(log, "completeMove");
+			return true;
+		}));
+
+		ON_CALL(*agent, broadcastInterrupt(_)).WillByDefault(Invoke([log](int64 msg) {
+			logAction(log, "broadcastInterrupt " + String::valueOf(msg));
+		}));
+
+		ON_CALL(*agent, selectDefaultAttack()).WillByDefault(Invoke([log]() { logAction(log, "selectDefaultAttack"); }));
+		ON_CALL(*agent, selectSpecialAttack()).WillByDefault(Invoke([log]() { logAction(log, "selectSpecialAttack"); }));
+		ON_CALL(*agent, enqueueAttack(_)).WillByDefault(Invoke([log](int priority) { logAction(log, "enqueueAttack"); }));
+
+		return agent;
+	}
+
+	static String getResultName(int result) {
+		switch (result) {
+		case AiMap::SUCCESS:
+			return "success";
+		case AiMap::FAILURE:
+			return "failure";
+		case AiMap::RUNNING:
+			return "running";
+		default:
+			return "result " + String::valueOf(result);
+		}
+	}
+
+	static void logAction(Vector<String>* log, const String& action) {
+		if (log != NULL)
+			log->add(action);
+	}
+
+	/**
+	 * Runs a tick of behavior on agent
+	 * @return actions taken and the result
+	 */
+	String tick(LuaBehavior* behavior, MockAiAgent* agent, Vector<String>& log) {
+		log.removeAll();
+
+		if (behavior->checkConditions(agent))
+			log.add(getResultName(behavior->doAction(agent)));
+		else
+			log.add("conditions failed");
+
+		StringBuffer actions;
+
+		for (int i = 0; i < log.size(); ++i)
+			actions << (i > 0 ? ", " : "") << log.get(i);
+
+		return actions.toString();
+	}
+
+	String tick(LuaBehavior* behavior, AiScenario& scenario, bool creature = false) {
+		Vector<String> log;
+		Reference<MockAiAgent*> agent = createAgent(&scenario, &log, creature);
+
+		return tick(behavior, agent, log);
+	}
+
+	/**
+	 * Ticks the lua class and its native version once on the same scenario
+	 * @return actions of the native run
+	 */
+	String compare(const String& className, const String& nativeName, AiScenario& scenario, const char* description) {
+		Reference<LuaBehavior*> luaBehavior = new LuaBehavior(className);
+		Reference<LuaBehavior*> nativeBehavior = NativeBehavior::create(nativeName, className, false);
+
+		EXPECT_TRUE(luaBehavior->initialize()) << className.toCharArray();
+		EXPECT_TRUE(nativeBehavior != NULL) << nativeName.toCharArray();
+
+		if (nativeBehavior == NULL)
+			return "";
+
+		String luaActions = tick(luaBehavior, scenario);
+		String nativeActions = tick(nativeBehavior, scenario);
+
+		EXPECT_STREQ(luaActions.toCharArray(), nativeActions.toCharArray()) << className.toCharArray() << ": " << description;
+
+		return nativeActions;
+	}
+
+	/**
+	 * Ticks the lua class and its native version ticks times each
+	 * @return how often each list of actions came up, lua and native apart
+	 */
+	void countActions(const String& className, const String& nativeName, AiScenario& scenario, bool creature, int ticks,
+			VectorMap<String, int>& luaCounts, VectorMap<String, int>& nativeCounts) {
+		Reference<LuaBehavior*> behaviors[] = { new LuaBehavior(className), NativeBehavior::create(nativeName, className, false) };
+		VectorMap<String, int>* counts[] = { &luaCounts, &nativeCounts };
+
+		ASSERT_TRUE(behaviors[0]->initialize());
+		ASSERT_TRUE(behaviors[1] != NULL);
+
+		for (int i = 0; i < 2; ++i) {
+			counts[i]->setAllowOverwriteInsertPlan();
+			counts[i]->setNullValue(0);
+
+			Vector<String> log;
+			Reference<MockAiAgent*> agent = createAgent(&scenario, &log, creature);
+
+			for (int j = 0; j < ticks; ++j) {
+				String actions = tick(behaviors[i], agent, log);
+
+				counts[i]->put(actions, counts[i]->get(actions) + 1);
+			}
+		}
+	}
+
+	void collectNativeBehaviors(Behavior* node, VectorMap<String, Reference<LuaBehavior*> >& natives) {
+		LuaBehavior* behavior = node->getInterface();
+
+		if (dynamic_cast<NativeBehavior*>(behavior) != NULL)
+			natives.put(behavior->print(), behavior);
+
+		CompositeBehavior* composite = dynamic_cast<CompositeBehavior*>(node);
+
+		if (composite == NULL)
+			return;
+
+		const Vector<Behavior*>& children = composite->getChildren();
+
+		for (int i = 0; i < children.size(); ++i)
+			collectNativeBehaviors(children.get(i), natives);
+	}
+
+	/**
+	 * Ticks agents through tree
+	 * @return time taken in ms
+	 */
+	uint64 tickTree(BehaviorTree* tree, Zone* zone, AiScenario* scenario, int agents, int ticks, int& finishedRuns) {
+		Behavior* root = tree->getBehavior(tree->getRootID());
+
+		Vector<Reference<MockAiAgent*> > mockAgents;
+		Vector<Reference<BehaviorState*> > states;
+
+		for (int i = 0; i < agents; ++i) {
+			Reference<MockAiAgent*> mockAgent = createAgent(scenario, NULL);
+			Reference<BehaviorState*> state = tree->createState();
+
+			ON_CALL(*mockAgent, getBehaviorState()).WillByDefault(Return(state.get()));
+			ON_CALL(*mockAgent, getZone()).WillByDefault(Return(zone));
+
+			mockAgents.add(mockAgent);
+			states.add(state);
+		}
+
+		Time start;
+
+		for (int t = 0; t < ticks; ++t) {
+			for (int i = 0; i < agents; ++i) {
+				root->doAction(mockAgents.get(i), true);
+
+				if (!root->started(mockAgents.get(i)))
+					++finishedRuns;
+			}
+		}
+
+		return start.miliDifference();
+	}
+};
+
+TEST_F(NativeBehaviorTest, GetTargetMatchesLua) {
+	Reference<CreatureObject*> first = createTarget(2, 10, 10);
+	Reference<CreatureObject*> second = createTarget(3, 20, 20);
+	Reference<CreatureObject*> peaceful = createTarget(4, 30, 30);
+	peaceful->setState(CreatureState::PEACE, false);
+
+	// agents are level 1, the random level check always passes
+	{
+		AiScenario scenario;
+		EXPECT_STREQ("failure", compare("GetTarget", "GetTarget", scenario, "no targets").toCharArray());
+	}
+
+	{
+		AiScenario scenario;
+		scenario.mapTarget = first;
+		EXPECT_STREQ("validateTarget 2, setFollowObject 2, setDefender 2, success",
+				compare("GetTarget", "GetTarget", scenario, "new target from the map").toCharArray());
+	}
+
+	{
+		AiScenario scenario;
+		scenario.mapTarget = first;
+		scenario.defenderTarget = second;
+		scenario.invalidTarget = first;
+		compare("GetTarget", "GetTarget", scenario, "invalid map target, defender taken");
+	}
+
+	{
+		AiScenario scenario;
+		scenario.mapTarget = first;
+		scenario.followObject = first;
+		compare("GetTarget", "GetTarget", scenario, "map target already followed");
+	}
+
+	{
+		AiScenario scenario;
+		scenario.mapTarget = first;
+		scenario.followObject = first;
+		scenario.followValid = false;
+		scenario.defenderTarget = second;
+		compare("GetTarget", "GetTarget", scenario, "followed target no longer valid, defender taken");
+	}
+
+	{
+		AiScenario scenario;
+		scenario.mapTarget = first;
+		scenario.followObject = first;
+		scenario.followValid = false;
+		scenario.defenderTarget = first;
+		compare("GetTarget", "GetTarget", scenario, "followed target no longer valid, nothing else");
+	}
+
+	{
+		AiScenario scenario;
+		scenario.mapTarget = peaceful;
+		scenario.followObject = peaceful;
+		EXPECT_STREQ("validateFollow, isAggressiveTo 4, clearCombatState 1, setOblivious, failure",
+				compare("GetTarget", "GetTarget", scenario, "followed target at peace").toCharArray());
+	}
+
+	{
+		AiScenario scenario;
+		scenario.mapTarget = peaceful;
+		scenario.followObject = peaceful;
+		scenario.aggressive = true;
+		compare("GetTarget", "GetTarget", scenario, "aggressive to followed target at peace");
+	}
+
+	{
+		AiScenario scenario;
+		scenario.defenderTarget = peaceful;
+		scenario.followObject = peaceful;
+		compare("GetTarget", "GetTarget", scenario, "followed defender at peace");
+	}
+}
+
+TEST_F(NativeBehaviorTest, MoveMatchesLua) {
+	Reference<CreatureObject*> nearby = createTarget(2, 200, 0);
+	Reference<CreatureObject*> distant = createTarget(3, 500, 500);
+
+	{
+		AiScenario scenario;
+		scenario.destination = 0;
+		compare("Move", "Move", scenario, "no destination");
+	}
+
+	{
+		AiScenario scenario;
+		scenario.nextPosition = true;
+		EXPECT_STREQ("setDestination, findNextPosition 0, running", compare("Move", "Move", scenario, "at home").toCharArray());
+		compare("Walk", "Walk", scenario, "walking at home");
+	}
+
+	{
+		AiScenario scenario;
+		scenario.homeLocation = PatrolPoint(1000, 0, 1000);
+		EXPECT_STREQ("setDestination, leash, conditions failed", compare("Move", "Move", scenario, "left home").toCharArray());
+	}
+
+	{
+		AiScenario scenario;
+		scenario.homeLocation = PatrolPoint(1000, 0, 1000);
+		scenario.retreating = true;
+		compare("Move", "Move", scenario, "retreating home");
+	}
+
+	{
+		AiScenario scenario;
+		scenario.followObject = distant;
+		compare("Move", "Move", scenario, "followed target left home");
+	}
+
+	{
+		// the agent is out of range but the target it follows is not
+		AiScenario scenario;
+		scenario.homeLocation = PatrolPoint(300, 0, 0);
+		scenario.followObject = nearby;
+		compare("Move", "Move", scenario, "followed target near home");
+	}
+}
+
+TEST_F(NativeBehaviorTest, CombatMoveMatchesLua) {
+	Reference<CreatureObject*> attacker = createTarget(2, 10, 10);
+	attacker->setTargetID(AGENTID, false);
+
+	Reference<CreatureObject*> bystander = createTarget(3, 10, 10);
+	bystander->setTargetID(4, false);
+
+	{
+		AiScenario scenario;
+		scenario.followObject = attacker;
+		EXPECT_STREQ("setDestination, findNextPosition 0, broadcastInterrupt 31, success",
+				compare("CombatMove", "CombatMove", scenario, "target of target is the agent").toCharArray());
+	}
+
+	{
+		AiScenario scenario;
+		scenario.followObject = bystander;
+		compare("CombatMove", "CombatMove", scenario, "target of target is someone else");
+	}
+
+	{
+		AiScenario scenario;
+		compare("CombatMove", "CombatMove", scenario, "nothing followed");
+	}
+
+	{
+		AiScenario scenario;
+		scenario.followObject = attacker;
+		scenario.homeLocation = PatrolPoint(1000, 0, 1000);
+		compare("CombatMove", "CombatMove", scenario, "target left home");
+	}
+}
+
+TEST_F(NativeBehaviorTest, SelectAttackMatchesLua) {
+	const int ticks = 3000;
+	const float tolerance = 0.05f;
+
+	for (int i = 0; i < 4; ++i) {
+		bool creature = i & 1;
+
+		AiScenario scenario;
+		scenario.stateAttackValid = i < 2;
+
+		VectorMap<String, int> luaCounts, nativeCounts;
+
+		countActions("SelectAttack", "SelectAttack", scenario, creature, ticks, luaCounts, nativeCounts);
+
+		// both take the same branches about as often
+		EXPECT_EQ(luaCounts.size(), nativeCounts.size()) << "creature " << creature << ", state attack " << scenario.stateAttackValid;
+
+		for (int j = 0; j < luaCounts.size(); ++j) {
+			const String& actions = luaCounts.elementAt(j).getKey();
+
+			float luaRate = luaCounts.elementAt(j).getValue() / (float) ticks;
+			float nativeRate = nativeCounts.get(actions) / (float) ticks;
+
+			EXPECT_NEAR(luaRate, nativeRate, tolerance) << actions.toCharArray() << ", creature " << creature;
+		}
+	}
+}
+
+TEST_F(NativeBehaviorTest, TemplateTickBenchmark) {
+	const int agents = 200;
+	const int ticks = 50;
+
+	Reference<ZoneServer*> zoneServer = new ZoneServer(ConfigManager::instance());
+	Reference<ZoneProcessServer*> processServer = new ZoneProcessServer(zoneServer);
+	Reference<Zone*> zone = new Zone(processServer, "test_zone");
+	zone->createContainerComponent();
+	zone->_setObjectID(1);
+
+	AiMap* aiMap = AiMap::instance();
+
+	Reference<AiTemplate*> getTarget = aiMap->getGetTargetTemplate(0);
+	Reference<AiTemplate*> selectAttack = aiMap->getSelectAttackTemplate(0);
+	Reference<AiTemplate*> combatMove = aiMap->getCombatMoveTemplate(0);
+	Reference<AiTemplate*> idle = aiMap->getIdleTemplate(0);
+
+	ASSERT_TRUE(getTarget != NULL && selectAttack != NULL && combatMove != NULL && idle != NULL);
+
+	Reference<BehaviorTree*> nativeTree = BehaviorTree::create("CompositeDefault", getTarget, selectAttack, combatMove, idle);
+	ASSERT_TRUE(nativeTree != NULL);
+
+	VectorMap<String, Reference<LuaBehavior*> > natives;
+	natives.setNoDuplicateInsertPlan();
+
+	collectNativeBehaviors(nativeTree->getBehavior(nativeTree->getRootID()), natives);
+	EXPECT_GT(natives.size(), 0);
+
+	// the same tree with every native class swapped back to lua
+	for (int i = 0; i < natives.size(); ++i) {
+		Reference<LuaBehavior*> luaBehavior = new LuaBehavior(natives.elementAt(i).getKey());
+		ASSERT_TRUE(luaBehavior->initialize());
+
+		aiMap->putBehavior(natives.elementAt(i).getKey(), luaBehavior);
+	}
+
+	Reference<BehaviorTree*> luaTree = BehaviorTree::create("CompositeDefault", getTarget, selectAttack, combatMove, idle);
+
+	for (int i = 0; i < natives.size(); ++i)
+		aiMap->putBehavior(natives.elementAt(i).getKey(), natives.elementAt(i).getValue());
+
+	ASSERT_TRUE(luaTree != NULL);
+	EXPECT_EQ(nativeTree->getNodeCount(), luaTree->getNodeCount());
+
+	VectorMap<String, Reference<LuaBehavior*> > luaNatives;
+	luaNatives.setNoDuplicateInsertPlan();
+
+	collectNativeBehaviors(luaTree->getBehavior(luaTree->getRootID()), luaNatives);
+	EXPECT_EQ(0, luaNatives.size());
+
+	// idle agents, nothing to attack
+	AiScenario scenario;
+
+	int luaRuns = 0, nativeRuns = 0;
+
+	uint64 luaTime = tickTree(luaTree, zone, &scenario, agents, ticks, luaRuns);
+	uint64 nativeTime = tickTree(nativeTree, zone, &scenario, agents, ticks, nativeRuns);
+
+	EXPECT_GT(luaRuns, 0);
+	EXPECT_GT(nativeRuns, 0);
+
+	EXPECT_LE(nativeTime, luaTime);
+
+	RecordProperty("agents", agents);
+	RecordProperty("native_classes", natives.size());
+	RecordProperty("lua_ms", (int) luaTime);
+	RecordProperty("native_ms", (int) nativeTime);
+}
+
+}
+}
+}
+}
+}
+}
+}
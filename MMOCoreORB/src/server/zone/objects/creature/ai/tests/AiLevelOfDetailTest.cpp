@@ -0,0 +1,226 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#include "gtest/gtest.h"
+
+#include "server/zone/objects/creature/ai/AiLevelOfDetail.h"
+#include "server/zone/ZoneServer.h"
+
+static const int AGENTS = 2000;
+static const int PLAYERS = 40;
+
+static const float AREASIZE = 4096.f;
+
+// players are noticed at twice the default aggro radius, see AiAgent::runAwarenessLogicCheck
+static const float AWARENESSRANGE = 24 * 2 * 1.2f;
+
+static const float PLAYERSPEED = 6.f; // m/s
+static const int MOVEMENTINTERVAL = 500; // AiAgent::UPDATEMOVEMENTINTERVAL
+
+static const int DURATION = 300000; // msec
+static const int STEP = 100; // msec
+
+class SimulatedAgent {
+public:
+	float x, y;
+
+	int tier;
+
+	// a player is in close object range, the agent only ticks then
+	bool active;
+
+	uint64 nextAwarenessCheck;
+	uint64 nextMovement;
+
+	// time a player came in awareness range without being checked yet, 0 if none
+	uint64 playerInRangeTime;
+};
+
+class SimulatedPlayer {
+public:
+	float x, y;
+	float heading;
+};
+
+class SimulationResult {
+public:
+	uint64 movements;
+	uint64 awarenessChecks;
+
+	uint64 maxNoticeTime;
+
+	SimulationResult() : movements(0), awarenessChecks(0), maxNoticeTime(0) {
+	}
+};
+
+class AiLevelOfDetailTest : public ::testing::Test {
+protected:
+	uint32 seed;
+
+public:
+	AiLevelOfDetailTest() : seed(0) {
+	}
+
+	void SetUp() {
+	}
+
+	void TearDown() {
+	}
+
+	// both runs need the same players and agents
+	float random() {
+		seed = seed * 1103515245 + 12345;
+
+		return (seed >> 8) / float(1 << 24);
+	}
+
+	/**
+	 * Headless zone, players wandering between agents standing still. Agents tick
+	 * like AiAgent, movement and awareness events only while a player is in
+	 * close object range.
+	 */
+	SimulationResult simulate(bool levelOfDetail) {
+		seed = 42;
+
+		SimulationResult result;
+
+		Vector<SimulatedAgent> agents;
+		Vector<SimulatedPlayer> players;
+
+		for (int i = 0; i < AGENTS; ++i) {
+			SimulatedAgent agent;
+			agent.x = random() * AREASIZE;
+			agent.y = random() * AREASIZE;
+			agent.tier = AiLevelOfDetail::NEAR;
+			agent.active = false;
+			agent.nextAwarenessCheck = 0;
+			agent.nextMovement = 0;
+			agent.playerInRangeTime = 0;
+
+			agents.add(agent);
+		}
+
+		for (int i = 0; i < PLAYERS; ++i) {
+			SimulatedPlayer player;
+			player.x = random() * AREASIZE;
+			player.y = random() * AREASIZE;
+			player.heading = random() * 2 * M_PI;
+
+			players.add(player);
+		}
+
+		for (uint64 time = STEP; time <= DURATION; time += STEP) {
+			for (int i = 0; i < players.size(); ++i) {
+				SimulatedPlayer& player = players.get(i);
+
+				if (random() < 0.02f)
+					player.heading = random() * 2 * M_PI;
+
+				player.x = MIN(MAX(player.x + cos(player.heading) * PLAYERSPEED * STEP / 1000.f, 0.f), AREASIZE);
+				player.y = MIN(MAX(player.y + sin(player.heading) * PLAYERSPEED * STEP / 1000.f, 0.f), AREASIZE);
+			}
+
+			for (int i = 0; i < agents.size(); ++i) {
+				SimulatedAgent& agent = agents.get(i);
+
+				float nearestSquared = -1;
+
+				for (int j = 0; j < players.size(); ++j) {
+					float dx = players.get(j).x - agent.x;
+					float dy = players.get(j).y - agent.y;
+					float distanceSquared = dx * dx + dy * dy;
+
+					if (nearestSquared < 0 || distanceSquared < nearestSquared)
+						nearestSquared = distanceSquared;
+				}
+
+				bool inCloseRange = nearestSquared <= ZoneServer::CLOSEOBJECTRANGE * ZoneServer::CLOSEOBJECTRANGE;
+				bool inAwarenessRange = nearestSquared <= AWARENESSRANGE * AWARENESSRANGE;
+
+				if (!inAwarenessRange)
+					agent.playerInRangeTime = 0;
+				else if (agent.playerInRangeTime == 0)
+					agent.playerInRangeTime = time;
+
+				if (!inCloseRange) {
+					agent.active = false;
+					continue;
+				}
+
+				// AiAgent::notifyInsert
+				if (!agent.active) {
+					agent.active = true;
+					agent.nextAwarenessCheck = time + 500 + (int) (random() * 1000);
+					agent.nextMovement = time + MOVEMENTINTERVAL * AiLevelOfDetail::getScale(agent.tier);
+				}
+
+				if (time >= agent.nextAwarenessCheck) {
+					++result.awarenessChecks;
+
+					if (agent.playerInRangeTime != 0) {
+						result.maxNoticeTime = MAX(result.maxNoticeTime, time - agent.playerInRangeTime);
+						agent.playerInRangeTime = 0;
+					}
+
+					if (levelOfDetail)
+						agent.tier = AiLevelOfDetail::getTier(nearestSquared, AWARENESSRANGE, agent.tier);
+
+					agent.nextAwarenessCheck = time + AiLevelOfDetail::getAwarenessInterval(agent.tier);
+				}
+
+				if (time >= agent.nextMovement) {
+					++result.movements;
+
+					agent.nextMovement = time + MOVEMENTINTERVAL * AiLevelOfDetail::getScale(agent.tier);
+				}
+			}
+		}
+
+		return result;
+	}
+};
+
+TEST_F(AiLevelOfDetailTest, Tiers) {
+	float nearRange = AWARENESSRANGE + AiLevelOfDetail::NEARMARGIN;
+	float midRange = nearRange * 2;
+
+	EXPECT_EQ(AiLevelOfDetail::NEAR, AiLevelOfDetail::getTier(10 * 10, AWARENESSRANGE, AiLevelOfDetail::FAR));
+	EXPECT_EQ(AiLevelOfDetail::NEAR, AiLevelOfDetail::getTier(nearRange * nearRange, AWARENESSRANGE, AiLevelOfDetail::FAR));
+	EXPECT_EQ(AiLevelOfDetail::MID, AiLevelOfDetail::getTier((nearRange + 1) * (nearRange + 1), AWARENESSRANGE, AiLevelOfDetail::FAR));
+	EXPECT_EQ(AiLevelOfDetail::FAR, AiLevelOfDetail::getTier((midRange + 1) * (midRange + 1), AWARENESSRANGE, AiLevelOfDetail::FAR));
+
+	// moving away only changes the tier once past the hysteresis
+	float border = nearRange + AiLevelOfDetail::HYSTERESIS / 2;
+	EXPECT_EQ(AiLevelOfDetail::NEAR, AiLevelOfDetail::getTier(border * border, AWARENESSRANGE, AiLevelOfDetail::NEAR));
+	EXPECT_EQ(AiLevelOfDetail::MID, AiLevelOfDetail::getTier(border * border, AWARENESSRANGE, AiLevelOfDetail::MID));
+
+	border = midRange + AiLevelOfDetail::HYSTERESIS / 2;
+	EXPECT_EQ(AiLevelOfDetail::MID, AiLevelOfDetail::getTier(border * border, AWARENESSRANGE, AiLevelOfDetail::MID));
+	EXPECT_EQ(AiLevelOfDetail::FAR, AiLevelOfDetail::getTier(border * border, AWARENESSRANGE, AiLevelOfDetail::FAR));
+
+	EXPECT_EQ(AiLevelOfDetail::FAR, AiLevelOfDetail::getTier(1000 * 1000, AWARENESSRANGE, AiLevelOfDetail::NEAR));
+
+	EXPECT_EQ(1, AiLevelOfDetail::getScale(AiLevelOfDetail::NEAR));
+	EXPECT_EQ(2, AiLevelOfDetail::getScale(AiLevelOfDetail::MID));
+	EXPECT_EQ(4, AiLevelOfDetail::getScale(AiLevelOfDetail::FAR));
+	EXPECT_EQ(AiLevelOfDetail::AWARENESSINTERVAL, AiLevelOfDetail::getAwarenessInterval(AiLevelOfDetail::NEAR));
+}
+
+TEST_F(AiLevelOfDetailTest, Simulation) {
+	SimulationResult fullRate = simulate(false);
+	SimulationResult scaled = simulate(true);
+
+	EXPECT_LT(scaled.movements, fullRate.movements);
+	EXPECT_LT(scaled.awarenessChecks, fullRate.awarenessChecks);
+
+	// a player coming closer is still noticed within two full rate awareness checks
+	EXPECT_LE(scaled.maxNoticeTime, (uint64) AiLevelOfDetail::AWARENESSINTERVAL * 2);
+
+	RecordProperty("full_rate_movements", (int) fullRate.movements);
+	RecordProperty("scaled_movements", (int) scaled.movements);
+	RecordProperty("full_rate_awareness_checks", (int) fullRate.awarenessChecks);
+	RecordProperty("scaled_awareness_checks", (int) scaled.awarenessChecks);
+	RecordProperty("full_rate_max_notice_ms", (int) fullRate.maxNoticeTime);
+	RecordProperty("scaled_max_notice_ms", (int) scaled.maxNoticeTime);
+}
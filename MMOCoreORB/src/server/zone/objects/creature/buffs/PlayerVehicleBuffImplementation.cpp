@@ -45,7 +45,7 @@ void PlayerVehicleBuffImplementation::activate(bool applyModifiers) {
 		//Send start message to mount rider
 		if (!startMessage.isEmpty()) {
 
-			ManagedReference<CreatureObject*> rider = creature.get()->getSlottedObject("rider").castTo<CreatureObject*>();
+			ManagedReference<CreatureObject*> rider = creature.get()->getKnownSlottedObject(SlotIndex::RIDER).castTo<CreatureObject*>();
 
 			if(rider != NULL) {
 				rider->sendSystemMessage(startMessage);
@@ -59,7 +59,7 @@ void PlayerVehicleBuffImplementation::deactivate(bool removeModifiers) {
 		//Send end message to mount rider
 		if (!endMessage.isEmpty()) {
 
-			ManagedReference<CreatureObject*> rider = creature.get()->getSlottedObject("rider").castTo<CreatureObject*>();
+			ManagedReference<CreatureObject*> rider = creature.get()->getKnownSlottedObject(SlotIndex::RIDER).castTo<CreatureObject*>();
 
 			if(rider != NULL) {
 				rider->sendSystemMessage(endMessage);
@@ -71,7 +71,7 @@ void PlayerVehicleBuffImplementation::deactivate(bool removeModifiers) {
 void PlayerVehicleBuffImplementation::updateRiderSpeeds() {
 
 	ManagedReference<CreatureObject*> vehicle = creature.get();
-	ManagedReference<CreatureObject*> rider = vehicle->getSlottedObject("rider").castTo<CreatureObject*>();
+	ManagedReference<CreatureObject*> rider = vehicle->getKnownSlottedObject(SlotIndex::RIDER).castTo<CreatureObject*>();
 
 	if(rider == NULL) // Our rider is gone
 		return;
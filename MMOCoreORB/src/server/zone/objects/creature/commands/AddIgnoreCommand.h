@@ -32,7 +32,7 @@ public:
 
 		String nameLower = arguments.toString().toLowerCase();
 
-		Reference<PlayerObject*> ghost = creature->getSlottedObject("ghost").castTo<PlayerObject*>();
+		Reference<PlayerObject*> ghost = creature->getKnownSlottedObject(SlotIndex::GHOST).castTo<PlayerObject*>();
 
 		if (ghost->isIgnoring(nameLower)) {
 			StringIdChatParameter param("cmnty", "ignore_duplicate");
@@ -48,7 +48,7 @@ public:
 		if (!pup->isASubChildOf(creature))
 			return GENERALERROR;
 
-		ManagedReference<SceneObject*> inventory = creature->getSlottedObject("inventory");
+		ManagedReference<SceneObject*> inventory = creature->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 		if (inventory == NULL)
 			return GENERALERROR;
@@ -56,7 +56,7 @@ public:
 		if (!inventory->hasObjectInContainer(weapon->getObjectID()) && weapon->getParent().get() != creature)
 			return GENERALERROR;
 
-		if (creature->getSlottedObject("default_weapon") == weapon)
+		if (creature->getKnownSlottedObject(SlotIndex::DEFAULT_WEAPON) == weapon)
 			return GENERALERROR;
 
 		if (weapon->isJediWeapon())
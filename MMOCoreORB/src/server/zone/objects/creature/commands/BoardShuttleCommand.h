@@ -222,7 +222,7 @@ private:
 	SortedVector<ManagedReference<TicketObject*> > findTicketsInInventory(CreatureObject* creature, PlanetTravelPoint* departurePoint) const {
 		SortedVector<ManagedReference<TicketObject*> > tickets;
 
-		ManagedReference<SceneObject*> inventory = creature->getSlottedObject("inventory");
+		ManagedReference<SceneObject*> inventory = creature->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 		if (inventory == NULL)
 			return tickets;
@@ -37,10 +37,7 @@ public:
 		}
 
 		ChatManager* chatManager = server->getZoneServer()->getChatManager();
-		Locker chatManagerLocker(chatManager);
-
-		PlayerMap* playerMap = chatManager->getPlayerMap();
-		playerMap->resetIterator(false);
+		Reference<PlayerMapSnapshot*> players = chatManager->getPlayerMap()->getSnapshot();
 
 		//The first argument is the message type, which displays different versions of a broadcast
 		String messageType;
@@ -70,8 +67,8 @@ public:
 					message = message + messageParts + " ";
 				}
 
-				while (playerMap->hasNext(false)) {
-					ManagedReference<CreatureObject*> playerObject = playerMap->getNextValue(false);
+				for (int i = 0; i < players->size(); ++i) {
+					ManagedReference<CreatureObject*> playerObject = players->get(i);
 
 					if (creature->getPlanetCRC() == playerObject->getPlanetCRC()) {
 						playerObject->sendSystemMessage(type + message);
@@ -97,8 +94,8 @@ public:
 					message = message + messageParts + " ";
 				}
 
-				while (playerMap->hasNext(false)) {
-					ManagedReference<CreatureObject*> playerObject = playerMap->getNextValue(false);
+				for (int i = 0; i < players->size(); ++i) {
+					ManagedReference<CreatureObject*> playerObject = players->get(i);
 
 					if (creature->getPlanetCRC() == playerObject->getPlanetCRC()) {
 						if (playerObject->getFaction() == faction.hashCode() || playerObject->getPlayerObject()->hasGodMode())
@@ -125,8 +122,8 @@ public:
 					message = message + messageParts + " ";
 				}
 
-				while (playerMap->hasNext(false)) {
-					ManagedReference<CreatureObject*> playerObject = playerMap->getNextValue(false);
+				for (int i = 0; i < players->size(); ++i) {
+					ManagedReference<CreatureObject*> playerObject = players->get(i);
 
 					if (creature->getPlanetCRC() == playerObject->getPlanetCRC()) {
 						if (playerObject->getFaction() == faction.hashCode() || playerObject->getPlayerObject()->hasGodMode())
@@ -149,8 +146,8 @@ public:
 			message = message + messageParts + " ";
 		}
 
-		while (playerMap->hasNext(false)) {
-			ManagedReference<CreatureObject*> playerObject = playerMap->getNextValue(false);
+		for (int i = 0; i < players->size(); ++i) {
+			ManagedReference<CreatureObject*> playerObject = players->get(i);
 
 			if (creature->getPlanetCRC() == playerObject->getPlanetCRC()) {
 				playerObject->sendSystemMessage(message);
@@ -81,7 +81,7 @@ public:
 
 		String zoneName = creature->getZone()->getZoneName();
 
-		ManagedReference<SceneObject*> inventory = creature->getSlottedObject("inventory");
+		ManagedReference<SceneObject*> inventory = creature->getKnownSlottedObject(SlotIndex::INVENTORY);
 		if(inventory == NULL)
 			return GENERALERROR;
 
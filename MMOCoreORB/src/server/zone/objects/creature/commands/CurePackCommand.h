@@ -49,7 +49,7 @@ public:
 	}
 
 	CurePack* findCurePack(CreatureObject* creature) const {
-		SceneObject* inventory = creature->getSlottedObject("inventory");
+		SceneObject* inventory = creature->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 		int medicineUse = creature->getSkillMod("healing_ability");
 
@@ -368,7 +368,7 @@ public:
 		if (objectId == 0) {
 			curePack = findCurePack(creature);
 		} else {
-			SceneObject* inventory = creature->getSlottedObject("inventory");
+			SceneObject* inventory = creature->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 			if (inventory != NULL) {
 				curePack = inventory->getContainerObject(objectId).castTo<CurePack*>();
@@ -80,7 +80,7 @@ public:
 		zone->transferObject(creature, -1, false);
 
 		IntersectionResults intersections;
-		CollisionManager::getWorldFloorCollisions(creature->getPositionX(), creature->getPositionY(), zone, &intersections, (CloseObjectsVector*) creature->getCloseObjects());
+		CollisionManager::getWorldFloorCollisions(creature->getPositionX(), creature->getPositionY(), zone, &intersections);
 		float z = planetManager->findClosestWorldFloor(creature->getPositionX(), creature->getPositionY(), creature->getPositionZ(), creature->getSwimHeight(), &intersections, (CloseObjectsVector*) creature->getCloseObjects());
 
 		creature->teleport(creature->getPositionX(), z, creature->getPositionY(), 0);
@@ -236,7 +236,7 @@ public:
 		parseModifier(arguments.toString(), objectId);
 		ManagedReference<DotPack*> dotPack = NULL;
 
-		SceneObject* inventory = creature->getSlottedObject("inventory");
+		SceneObject* inventory = creature->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 		if (inventory != NULL) {
 			dotPack = inventory->getContainerObject(objectId).castTo<DotPack*>();
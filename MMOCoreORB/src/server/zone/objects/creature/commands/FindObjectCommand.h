@@ -31,7 +31,7 @@ public:
 			StringTokenizer tokenizer(arguments.toString());
 
 			Reference<SceneObject*> targetObject = NULL;
-			Reference<PlayerObject*> ghost = creature->getSlottedObject("ghost").castTo<PlayerObject*>();
+			Reference<PlayerObject*> ghost = creature->getKnownSlottedObject(SlotIndex::GHOST).castTo<PlayerObject*>();
 
 			if (!tokenizer.hasMoreTokens()) {
 				targetObject = server->getZoneServer()->getObject(creature->getTargetID());
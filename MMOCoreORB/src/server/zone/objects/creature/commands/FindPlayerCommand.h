@@ -44,10 +44,7 @@ public:
 			}
 
 			ChatManager* chatManager = server->getZoneServer()->getChatManager();
-			Locker chatManagerLocker(chatManager);
-
-			PlayerMap* playerMap = chatManager->getPlayerMap();
-			playerMap->resetIterator(false);
+			Reference<PlayerMapSnapshot*> players = chatManager->getPlayerMap()->getSnapshot();
 
 			ManagedReference<SuiListBox*> findResults = new SuiListBox(creature, SuiWindowType::ADMIN_FIND_PLAYER);
 			findResults->setCallback(new FindObjectSuiCallback(server->getZoneServer()));
@@ -57,8 +54,8 @@ public:
 			findResults->setOkButton(true, "@treasure_map/treasure_map:store_waypoint");
 			findResults->setOtherButton(true, "@go");
 
-			while (playerMap->hasNext(false)) {
-				ManagedReference<CreatureObject*> player = playerMap->getNextValue(false);
+			for (int i = 0; i < players->size(); ++i) {
+				ManagedReference<CreatureObject*> player = players->get(i);
 				String name = player->getDisplayedName();
 
 				if (filter.isEmpty() || name.toLowerCase().contains(filter.toLowerCase())) {
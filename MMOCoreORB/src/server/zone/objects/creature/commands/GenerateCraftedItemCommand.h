@@ -37,7 +37,7 @@ public:
 			return GENERALERROR;
 		}
 
-		ManagedReference<SceneObject*> inventory = creature->getSlottedObject("inventory");
+		ManagedReference<SceneObject*> inventory = creature->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 		if (inventory == NULL) {
 			creature->sendSystemMessage("Error locating target inventory");
@@ -26,7 +26,7 @@ public:
 		if (!checkInvalidLocomotions(creature))
 			return INVALIDLOCOMOTION;
 
-		Reference<PlayerObject*> admin = creature->getSlottedObject("ghost").castTo<PlayerObject*>();
+		Reference<PlayerObject*> admin = creature->getKnownSlottedObject(SlotIndex::GHOST).castTo<PlayerObject*>();
 
 		if(admin == NULL)
 			return GENERALERROR;
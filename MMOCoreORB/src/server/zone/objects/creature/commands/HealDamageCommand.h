@@ -83,7 +83,7 @@ public:
 	}
 
 	StimPack* findStimPack(CreatureObject* creature) const {
-		SceneObject* inventory = creature->getSlottedObject("inventory");
+		SceneObject* inventory = creature->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 		if (inventory == NULL)
 			return NULL;
@@ -409,7 +409,7 @@ public:
 		if (pharmaceuticalObjectID == 0) {
 			stimPack = findStimPack(creature);
 		} else {
-			SceneObject* inventory = creature->getSlottedObject("inventory");
+			SceneObject* inventory = creature->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 			if (inventory != NULL) {
 				stimPack = inventory->getContainerObject(pharmaceuticalObjectID).castTo<StimPack*>();
@@ -37,7 +37,7 @@ public:
 	}
 
 	StimPack* findStimPack(CreatureObject* creature) const {
-		SceneObject* inventory = creature->getSlottedObject("inventory");
+		SceneObject* inventory = creature->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 		if (inventory != NULL) {
 			for (int i = 0; i < inventory->getContainerObjectsSize(); ++i) {
@@ -163,7 +163,7 @@ public:
 		if (objectID == 0) {
 			stimPack = findStimPack(creature);
 		} else {
-			SceneObject* inventory = creature->getSlottedObject("inventory");
+			SceneObject* inventory = creature->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 			if (inventory != NULL) {
 				stimPack = inventory->getContainerObject(objectID).castTo<StimPack*>();
@@ -135,7 +135,7 @@ public:
 	}
 
 	WoundPack* findWoundPack(CreatureObject* creature) const {
-		SceneObject* inventory = creature->getSlottedObject("inventory");
+		SceneObject* inventory = creature->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 		if (inventory != NULL) {
 			for (int i = 0; i < inventory->getContainerObjectsSize(); i++) {
@@ -205,7 +205,7 @@ public:
 		ManagedReference<WoundPack*> woundPack = NULL;
 
 		if (objectId != 0) {
-			SceneObject* inventory = creature->getSlottedObject("inventory");
+			SceneObject* inventory = creature->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 			if (inventory != NULL) {
 				woundPack = inventory->getContainerObject(objectId).castTo<WoundPack*>();
@@ -52,7 +52,7 @@ public:
 	}
 
 	EnhancePack* findEnhancePack(CreatureObject* enhancer, uint8 attribute) const {
-		SceneObject* inventory = enhancer->getSlottedObject("inventory");
+		SceneObject* inventory = enhancer->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 		int medicineUse = enhancer->getSkillMod("healing_ability");
 
@@ -295,7 +295,7 @@ public:
 		ManagedReference<EnhancePack*> enhancePack = NULL;
 
 		if (objectId != 0) {
-			SceneObject* inventory = creature->getSlottedObject("inventory");
+			SceneObject* inventory = creature->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 			if (inventory != NULL) {
 				enhancePack = inventory->getContainerObject(objectId).castTo<EnhancePack*>();
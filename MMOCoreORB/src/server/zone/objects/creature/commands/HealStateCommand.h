@@ -128,7 +128,7 @@ public:
 	}
 
 	StatePack* findStatePack(CreatureObject* creature, uint64 state) const {
-		SceneObject* inventory = creature->getSlottedObject("inventory");
+		SceneObject* inventory = creature->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 		int medicineUse = creature->getSkillMod("healing_ability");
 
@@ -208,7 +208,7 @@ public:
 
 		parseModifier(arguments.toString(), state, objectId);
 
-		SceneObject* inventory = creature->getSlottedObject("inventory");
+		SceneObject* inventory = creature->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 		ManagedReference<StatePack*> statePack = NULL;
 
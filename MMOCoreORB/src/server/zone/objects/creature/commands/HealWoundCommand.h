@@ -194,7 +194,7 @@ public:
 
 
 	WoundPack* findWoundPack(CreatureObject* creature, uint8 attribute) const {
-		SceneObject* inventory = creature->getSlottedObject("inventory");
+		SceneObject* inventory = creature->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 		int medicineUse = creature->getSkillMod("healing_ability");
 
@@ -261,7 +261,7 @@ public:
 		ManagedReference<WoundPack*> woundPack = NULL;
 
 		if (objectId != 0) {
-			SceneObject* inventory = creature->getSlottedObject("inventory");
+			SceneObject* inventory = creature->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 			if (inventory != NULL) {
 				woundPack = inventory->getContainerObject(objectId).castTo<WoundPack*>();
@@ -27,7 +27,7 @@ public:
 		if (!creature->isPlayerCreature())
 			return GENERALERROR;
 
-		Reference<PlayerObject*> ghost = creature->getSlottedObject("ghost").castTo<PlayerObject*>();
+		Reference<PlayerObject*> ghost = creature->getKnownSlottedObject(SlotIndex::GHOST).castTo<PlayerObject*>();
 
 		if (ghost != NULL)
 			ghost->toggleCharacterBit(PlayerObject::LFG);
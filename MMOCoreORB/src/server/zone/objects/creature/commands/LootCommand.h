@@ -50,7 +50,7 @@ public:
 		bool lootAll = arguments.toString().beginsWith("all");
 
 		//Get the corpse's inventory.
-		SceneObject* lootContainer = ai->getSlottedObject("inventory");
+		SceneObject* lootContainer = ai->getKnownSlottedObject(SlotIndex::INVENTORY);
 		if (lootContainer == NULL)
 			return GENERALERROR;
 
@@ -131,7 +131,7 @@ public:
 		ContainerPermissions* contPerms = lootContainer->getContainerPermissions();
 		if (contPerms == NULL) return NOPICKUPITEMS;
 
-		SceneObject* playerInventory = creature->getSlottedObject("inventory");
+		SceneObject* playerInventory = creature->getKnownSlottedObject(SlotIndex::INVENTORY);
 		if (playerInventory == NULL) return NOPICKUPITEMS;
 
 		//Check each loot item to see if the player owns it.
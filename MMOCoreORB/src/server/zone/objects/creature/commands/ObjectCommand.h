@@ -49,7 +49,7 @@ public:
 					return INVALIDPARAMETERS;
 				}
 
-				ManagedReference<SceneObject*> inventory = creature->getSlottedObject("inventory");
+				ManagedReference<SceneObject*> inventory = creature->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 				if (inventory == NULL || inventory->isContainerFullRecursive()) {
 					creature->sendSystemMessage("Your inventory is full, so the item could not be created.");
@@ -114,7 +114,7 @@ public:
 				if (args.hasMoreTokens())
 					level = args.getIntToken();
 
-				ManagedReference<SceneObject*> inventory = creature->getSlottedObject("inventory");
+				ManagedReference<SceneObject*> inventory = creature->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 				if (inventory == NULL || inventory->isContainerFullRecursive()) {
 					creature->sendSystemMessage("Your inventory is full, so the item could not be created.");
@@ -182,7 +182,7 @@ public:
 						CreatureObject* targetPlayer = cast<CreatureObject*>(targetObject);
 						Locker tlock( targetPlayer, creature );
 
-						ManagedReference<SceneObject*> inventory = targetPlayer->getSlottedObject("inventory");
+						ManagedReference<SceneObject*> inventory = targetPlayer->getKnownSlottedObject(SlotIndex::INVENTORY);
 						if (inventory != NULL) {
 							if( lootManager->createLoot(inventory, lootGroup, level) )
 								targetPlayer->sendSystemMessage( "You have received a loot item!");
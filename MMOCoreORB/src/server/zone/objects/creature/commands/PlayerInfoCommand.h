@@ -127,9 +127,9 @@ public:
 			promptText << "ERROR: PlayerObject NULL" << endl;
 		}
 
-		ManagedReference<SceneObject*> inventory = targetObject->getSlottedObject("inventory");
-		ManagedReference<SceneObject*> bank = targetObject->getSlottedObject("bank");
-		ManagedReference<SceneObject*> datapad = targetObject->getSlottedObject("datapad");
+		ManagedReference<SceneObject*> inventory = targetObject->getKnownSlottedObject(SlotIndex::INVENTORY);
+		ManagedReference<SceneObject*> bank = targetObject->getKnownSlottedObject(SlotIndex::BANK);
+		ManagedReference<SceneObject*> datapad = targetObject->getKnownSlottedObject(SlotIndex::DATAPAD);
 
 		promptText << "Inventory: " << (inventory == NULL ? String("NULL") : String::valueOf(inventory->getObjectID()));
 		promptText << endl;
@@ -59,7 +59,7 @@ public:
 				departureTax = currentCity->getTravelTax();
 			}
 		}
-		ManagedReference<SceneObject*> inventory = creature->getSlottedObject("inventory");
+		ManagedReference<SceneObject*> inventory = creature->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 		if (inventory == NULL)
 			return GENERALERROR;
@@ -30,6 +30,7 @@ QueueCommand::QueueCommand(const String& skillname, ZoneProcessServer* serv) : L
 
 	defaultTime = 0.f;
 	cooldown = 0;
+	characterAbilityCRC = 0;
 	defaultPriority = NORMAL;
 
 	setLogging(true);
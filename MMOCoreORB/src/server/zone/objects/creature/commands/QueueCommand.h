@@ -46,6 +46,7 @@ protected:
 	float defaultTime;
 
 	String characterAbility;
+	uint32 characterAbilityCRC;
 
 	int defaultPriority;
 
@@ -197,6 +198,7 @@ public:
 
 	inline void setCharacterAbility(const String& ability) {
 		characterAbility = ability;
+		characterAbilityCRC = ability.toLowerCase().hashCode();
 
 		if(ability == "admin")
 			admin = true;
@@ -253,6 +255,10 @@ public:
 		return characterAbility;
 	}
 
+	inline uint32 getCharacterAbilityCRC() const {
+		return characterAbilityCRC;
+	}
+
 	inline float getDefaultTime() const {
 		return defaultTime;
 	}
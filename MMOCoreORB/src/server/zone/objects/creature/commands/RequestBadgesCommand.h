@@ -33,7 +33,7 @@ public:
 
 		CreatureObject* playerCreature = cast<CreatureObject*>( object.get());
 
-		Reference<PlayerObject*> playerObject = playerCreature->getSlottedObject("ghost").castTo<PlayerObject*>();
+		Reference<PlayerObject*> playerObject = playerCreature->getKnownSlottedObject(SlotIndex::GHOST).castTo<PlayerObject*>();
 
 		if (playerObject != NULL)
 			playerObject->sendBadgesResponseTo(creature);
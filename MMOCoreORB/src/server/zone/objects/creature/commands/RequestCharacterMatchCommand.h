@@ -60,7 +60,7 @@ public:
 					if (obj != NULL && (obj->isPlayerCreature() || (obj->isMount() || obj->isVehicleObject()))) {
 						ManagedReference<CreatureObject*> playerCreature;
 						if (obj->isMount() || obj->isVehicleObject()) {
-							SceneObject* rider = obj->getSlottedObject("rider");
+							SceneObject* rider = obj->getKnownSlottedObject(SlotIndex::RIDER);
 							if (rider == NULL)
 								continue;
 
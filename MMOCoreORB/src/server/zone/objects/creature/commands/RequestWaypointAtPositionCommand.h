@@ -47,7 +47,7 @@ public:
 			y = (y < -8192) ? -8192 : y;
 			y = (y > 8192) ? 8192 : y;
 
-			Reference<PlayerObject*> playerObject = creature->getSlottedObject("ghost").castTo<PlayerObject*>( );
+			Reference<PlayerObject*> playerObject = creature->getKnownSlottedObject(SlotIndex::GHOST).castTo<PlayerObject*>( );
 
 			ManagedReference<WaypointObject*> obj = ( server->getZoneServer()->createObject(0xc456e788, 1)).castTo<WaypointObject*>();
 
@@ -116,7 +116,7 @@ public:
 	}
 
 	RevivePack* findRevivePack(CreatureObject* creature) const {
-		SceneObject* inventory = creature->getSlottedObject("inventory");
+		SceneObject* inventory = creature->getKnownSlottedObject(SlotIndex::INVENTORY);
 		int medicineUse = creature->getSkillMod("healing_ability");
 
 		if (inventory != NULL) {
@@ -196,7 +196,7 @@ public:
 
 		ManagedReference<RevivePack*> revivePack = NULL;
 
-		SceneObject* inventory = creature->getSlottedObject("inventory");
+		SceneObject* inventory = creature->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 		if (inventory != NULL) {
 			revivePack = inventory->getContainerObject(objectId).castTo<RevivePack*>();
@@ -45,7 +45,7 @@ public:
 		// need to add checks.. inventory, datapad, bank, waypoint
 
 		if (object->isWaypointObject()) {
-			Reference<PlayerObject*> playerObject = creature->getSlottedObject("ghost").castTo<PlayerObject*>( );
+			Reference<PlayerObject*> playerObject = creature->getKnownSlottedObject(SlotIndex::GHOST).castTo<PlayerObject*>( );
 
 			if (playerObject != NULL)
 				playerObject->removeWaypoint(target);
@@ -78,7 +78,7 @@ public:
 				ManagedReference<TangibleObject*> tano = cast<TangibleObject*>(object.get());
 
 				if(tano->hasAntiDecayKit()){
-					ManagedReference<SceneObject*> inventory = creature->getSlottedObject("inventory");
+					ManagedReference<SceneObject*> inventory = creature->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 					if(inventory == NULL){
 						creature->sendSystemMessage("@veteran_new:failed_kit_create"); // "This item has Anti Decay applied to it but there was a failure to recreate the Anti Decay Kit."
@@ -58,7 +58,7 @@ public:
 			args.getStringToken(xpType);
 			int amount = args.getIntToken();
 
-			int num = (player->getSlottedObject("ghost").castTo<PlayerObject*>())->getExperience(xpType);
+			int num = (player->getKnownSlottedObject(SlotIndex::GHOST).castTo<PlayerObject*>())->getExperience(xpType);
 			amount -= num;
 			player->getZoneServer()->getPlayerManager()->awardExperience(player, xpType, amount);
 
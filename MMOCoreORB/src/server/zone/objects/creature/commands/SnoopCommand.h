@@ -62,7 +62,7 @@ public:
 			targetObj->sendWithoutParentTo(creature);
 			targetObj->openContainerTo(creature);
 		} else if (container == "datapad") {
-			SceneObject* creatureDatapad = targetObj->getSlottedObject("datapad");
+			SceneObject* creatureDatapad = targetObj->getKnownSlottedObject(SlotIndex::DATAPAD);
 
 			if (creatureDatapad == NULL)
 				return GENERALERROR;
@@ -70,7 +70,7 @@ public:
 			creatureDatapad->sendWithoutParentTo(creature);
 			creatureDatapad->openContainerTo(creature);
 		}  else if (container == "bank") {
-			SceneObject* creatureBank = targetObj->getSlottedObject("bank");
+			SceneObject* creatureBank = targetObj->getKnownSlottedObject(SlotIndex::BANK);
 
 			if (creatureBank == NULL)
 				return GENERALERROR;
@@ -133,7 +133,7 @@ public:
 		} else if (container == "buffs") {
 			return sendBuffs(creature, targetObj);
 		} else {
-			SceneObject* creatureInventory = targetObj->getSlottedObject("inventory");
+			SceneObject* creatureInventory = targetObj->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 			if (creatureInventory == NULL)
 				return GENERALERROR;
@@ -54,7 +54,7 @@ public:
 		if (!canPlayInstrument(creature, creature->getTargetID()))
 			return GENERALERROR;
 
-		Reference<PlayerObject*> ghost = creature->getSlottedObject("ghost").castTo<PlayerObject*> ();
+		Reference<PlayerObject*> ghost = creature->getKnownSlottedObject(SlotIndex::GHOST).castTo<PlayerObject*> ();
 
 		String args = arguments.toString();
 
@@ -125,7 +125,7 @@ public:
 					continue;
 				}
 
-				Reference<Instrument*> instrument = groupMember->getSlottedObject("hold_r").castTo<Instrument*> ();
+				Reference<Instrument*> instrument = groupMember->getKnownSlottedObject(SlotIndex::HOLD_R).castTo<Instrument*> ();
 				bool targetedInstrument = false;
 
 				if (instrument == NULL) {
@@ -195,9 +195,9 @@ public:
 	}
 
 	bool canPlayInstrument(CreatureObject* creature, const uint64& target) const {
-		Reference<PlayerObject*> ghost = creature->getSlottedObject("ghost").castTo<PlayerObject*> ();
+		Reference<PlayerObject*> ghost = creature->getKnownSlottedObject(SlotIndex::GHOST).castTo<PlayerObject*> ();
 
-		Reference<Instrument*> instrument = creature->getSlottedObject("hold_r").castTo<Instrument*> ();
+		Reference<Instrument*> instrument = creature->getKnownSlottedObject(SlotIndex::HOLD_R).castTo<Instrument*> ();
 
 		if (instrument == NULL) {
 			ManagedReference<SceneObject*> nala = server->getZoneServer()->getObject(target);
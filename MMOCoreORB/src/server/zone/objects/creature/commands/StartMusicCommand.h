@@ -98,9 +98,9 @@ public:
 			}
 		}
 
-		Reference<PlayerObject*> ghost = creature->getSlottedObject("ghost").castTo<PlayerObject*> ();
+		Reference<PlayerObject*> ghost = creature->getKnownSlottedObject(SlotIndex::GHOST).castTo<PlayerObject*> ();
 
-		Reference<Instrument*> instrument = creature->getSlottedObject("hold_r").castTo<Instrument*> ();
+		Reference<Instrument*> instrument = creature->getKnownSlottedObject(SlotIndex::HOLD_R).castTo<Instrument*> ();
 		bool targetedInstrument = false;
 
 		if (instrument == NULL) {
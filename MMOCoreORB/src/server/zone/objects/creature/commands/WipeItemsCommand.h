@@ -56,7 +56,7 @@ public:
 
 			Locker clocker(player, creature);
 
-			SceneObject* inventory = player->getSlottedObject("inventory");
+			SceneObject* inventory = player->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 			if (inventory == NULL)
 				return GENERALERROR;
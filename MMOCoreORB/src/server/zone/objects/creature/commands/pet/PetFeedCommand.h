@@ -55,7 +55,7 @@ public:
 		if (!args.hasMoreTokens()){
 
 			// Find food in player inventory
-			ManagedReference<SceneObject*> inventory = player->getSlottedObject("inventory");
+			ManagedReference<SceneObject*> inventory = player->getKnownSlottedObject(SlotIndex::INVENTORY);
 			if (inventory == NULL){
 				player->sendSystemMessage("Player inventory not found");
 				return GENERALERROR;
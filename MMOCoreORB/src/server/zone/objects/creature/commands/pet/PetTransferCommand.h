@@ -97,7 +97,7 @@ public:
 			return GENERALERROR;
 		}
 
-		ManagedReference<SceneObject*> targetDatapad = targetPlayer->getSlottedObject("datapad");
+		ManagedReference<SceneObject*> targetDatapad = targetPlayer->getKnownSlottedObject(SlotIndex::DATAPAD);
 
 		if (targetDatapad == NULL)
 			return GENERALERROR;
@@ -193,7 +193,7 @@ void PetMenuComponent::fillObjectMenuResponse(SceneObject* sceneObject, ObjectMe
 		}
 
 		if (controlDevice->isTrainedAsMount() && !pet->isDead() && !pet->isIncapacitated()) {
-			Reference<SceneObject*> rider = pet->getSlottedObject("rider");
+			Reference<SceneObject*> rider = pet->getKnownSlottedObject(SlotIndex::RIDER);
 
 			if (rider == NULL) {
 				menuResponse->addRadialMenuItem(205, 3, "@pet/pet_menu:menu_mount"); // Climb Aboard Pet
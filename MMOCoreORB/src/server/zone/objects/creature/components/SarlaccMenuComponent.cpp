@@ -16,7 +16,7 @@ int SarlaccMenuComponent::handleObjectMenuSelect(SceneObject* sceneObject, Creat
 	if (selectedID == 20) {
 		Locker plocker(player, sceneObject);
 
-		ManagedReference<SceneObject*> inventory = player->getSlottedObject("inventory");
+		ManagedReference<SceneObject*> inventory = player->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 		if (inventory->isContainerFullRecursive()) {
 			player->sendSystemMessage("@error_message:inv_full"); // Your inventory is full.
@@ -13,7 +13,7 @@ MissionObject* DeliverMissionScreenHandler::getRelevantMissionObject(CreatureObj
 		return NULL;
 	}
 
-	SceneObject* datapad = player->getSlottedObject("datapad");
+	SceneObject* datapad = player->getKnownSlottedObject(SlotIndex::DATAPAD);
 
 	if (datapad == NULL) {
 		return NULL;
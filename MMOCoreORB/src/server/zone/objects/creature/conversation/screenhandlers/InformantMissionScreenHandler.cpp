@@ -13,7 +13,7 @@ MissionObject* InformantMissionScreenHandler::getBountyMissionObject(CreatureObj
 		return NULL;
 	}
 
-	SceneObject* datapad = player->getSlottedObject("datapad");
+	SceneObject* datapad = player->getKnownSlottedObject(SlotIndex::DATAPAD);
 
 	if (datapad == NULL) {
 		return NULL;
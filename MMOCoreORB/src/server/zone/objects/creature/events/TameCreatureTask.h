@@ -116,7 +116,7 @@ public:
 		if (objectString == "")
 			objectString = "object/intangible/pet/pet_control.iff";
 
-		SceneObject* datapad = player->getSlottedObject("datapad");
+		SceneObject* datapad = player->getKnownSlottedObject(SlotIndex::DATAPAD);
 		PlayerManager* playerManager = zoneServer->getPlayerManager();
 		ObjectManager* objectManager = zoneServer->getObjectManager();
 
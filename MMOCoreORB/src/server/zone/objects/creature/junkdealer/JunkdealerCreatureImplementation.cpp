@@ -638,7 +638,7 @@ void JunkdealerCreatureImplementation::selectConversationOption(int option, Scen
 		}
 
 	} else if (ghost->getLastNpcConvMessStr() == "junkdealer_kit5") {
-		ManagedReference<SceneObject*> inventory = player->getSlottedObject("inventory");
+		ManagedReference<SceneObject*> inventory = player->getKnownSlottedObject(SlotIndex::INVENTORY);
 		bool found = false;
 		uint32 CRC = 0;
 		switch (option) {
@@ -672,7 +672,7 @@ void JunkdealerCreatureImplementation::selectConversationOption(int option, Scen
 			}
 		}
 
-		ManagedReference<SceneObject*> bank = player->getSlottedObject("bank");
+		ManagedReference<SceneObject*> bank = player->getKnownSlottedObject(SlotIndex::BANK);
 
 		Locker blocker(bank);
 
@@ -716,7 +716,7 @@ void JunkdealerCreatureImplementation::createSellJunkLootSelection(CreatureObjec
 	}else{
 		int dealerType= _this.getReferenceUnsafeStaticCast()->getJunkDealerBuyerType();
 		bool bHaveStuffToSell = false;
-		ManagedReference<SceneObject*> inventory = player->getSlottedObject("inventory");
+		ManagedReference<SceneObject*> inventory = player->getKnownSlottedObject(SlotIndex::INVENTORY);
 		for (int i = 0; i < inventory->getContainerObjectsSize(); i++) {
 			ManagedReference<TangibleObject*>  item = cast<TangibleObject*>(inventory->getContainerObject(i).get());
 			if (canInventoryItemBeSoldAsJunk(item,dealerType)==true){
@@ -33,7 +33,7 @@ public:
 		int index = Integer::valueOf(args->get(1).toString());
 
 		SuiListBox* listBox = cast<SuiListBox*>(suiBox);
-		ManagedReference<SceneObject*> inventory = player->getSlottedObject("inventory");
+		ManagedReference<SceneObject*> inventory = player->getKnownSlottedObject(SlotIndex::INVENTORY);
 		ManagedReference<SceneObject*> dealerScene = suiBox->getUsingObject().get();
 
 		if (inventory == NULL || dealerScene == NULL || !dealerScene->isJunkDealer())
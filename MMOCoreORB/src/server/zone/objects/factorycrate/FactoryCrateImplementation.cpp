@@ -141,7 +141,7 @@ bool FactoryCrateImplementation::extractObjectToInventory(CreatureObject* player
 	}
 
 	Reference<TangibleObject*> prototype = getPrototype();
-	ManagedReference<SceneObject*> inventory = player->getSlottedObject("inventory").get();
+	ManagedReference<SceneObject*> inventory = player->getKnownSlottedObject(SlotIndex::INVENTORY).get();
 
 	if (prototype == NULL || !prototype->isTangibleObject() || inventory == NULL) {
 		error("FactoryCrateImplementation::extractObjectToInventory has a NULL or non-tangible item");
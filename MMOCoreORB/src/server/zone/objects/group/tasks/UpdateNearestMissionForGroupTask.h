@@ -81,7 +81,7 @@ public:
 			CreatureObject* groupMember = groupMembersOnPlanet.get(i);
 
 			if (groupMember != NULL) {
-				SceneObject* datapad = groupMember->getSlottedObject("datapad");
+				SceneObject* datapad = groupMember->getKnownSlottedObject(SlotIndex::DATAPAD);
 				if (datapad == NULL) {
 					continue;
 				}
@@ -20,7 +20,7 @@ void TurretDataComponent::initializeTransientMembers() {
 
 	templateData = dynamic_cast<SharedInstallationObjectTemplate*>(turret->getObjectTemplate());
 
-	SceneObject* sceneObject = turret->getSlottedObject("hold_r");
+	SceneObject* sceneObject = turret->getKnownSlottedObject(SlotIndex::HOLD_R);
 
 	if (sceneObject == NULL) {
 		return;
@@ -72,7 +72,7 @@ public:
 		ManagedReference<ObjectController*> objectController = turret->getZoneServer()->getObjectController();
 
 		CombatQueueCommand* command = cast<CombatQueueCommand*>(objectController->getQueueCommand(STRING_HASHCODE("turretfire")));
-		ManagedReference<WeaponObject*> weapon = turret->getSlottedObject("hold_r").castTo<WeaponObject*>();
+		ManagedReference<WeaponObject*> weapon = turret->getKnownSlottedObject(SlotIndex::HOLD_R).castTo<WeaponObject*>();
 
 		if (command != NULL && weapon != NULL) {
 			CombatManager::instance()->doCombatAction(turret, weapon, target, command);
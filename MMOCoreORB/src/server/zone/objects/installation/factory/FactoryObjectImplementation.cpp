@@ -156,7 +156,7 @@ void FactoryObjectImplementation::sendInsertManuSui(CreatureObject* player){
 	/*
 	 * Insert only the schematics that can be used in this type of factory
 	 */
-	ManagedReference<SceneObject* > datapad = player->getSlottedObject("datapad");
+	ManagedReference<SceneObject* > datapad = player->getKnownSlottedObject(SlotIndex::DATAPAD);
 
 	for (int i = 0; i < datapad->getContainerObjectsSize(); ++i) {
 
@@ -341,7 +341,7 @@ void FactoryObjectImplementation::handleRemoveFactorySchem(CreatureObject* playe
 		return;
 	}
 
-	ManagedReference<SceneObject*> datapad = player->getSlottedObject("datapad");
+	ManagedReference<SceneObject*> datapad = player->getKnownSlottedObject(SlotIndex::DATAPAD);
 
 	ManagedReference<SceneObject*> schematic = getContainerObject(0);
 
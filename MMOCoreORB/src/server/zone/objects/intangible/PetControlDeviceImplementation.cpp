@@ -628,14 +628,14 @@ void PetControlDeviceImplementation::destroyObjectFromDatabase(bool destroyConta
 	if (controlledObject != NULL) {
 		Locker locker(controlledObject);
 
-		ManagedReference<CreatureObject*> object = controlledObject->getSlottedObject("rider").castTo<CreatureObject*>();
+		ManagedReference<CreatureObject*> object = controlledObject->getKnownSlottedObject(SlotIndex::RIDER).castTo<CreatureObject*>();
 
 		if (object != NULL) {
 			Locker clocker(object, controlledObject);
 
 			object->executeObjectControllerAction(STRING_HASHCODE("dismount"));
 
-			object = controlledObject->getSlottedObject("rider").castTo<CreatureObject*>();
+			object = controlledObject->getKnownSlottedObject(SlotIndex::RIDER).castTo<CreatureObject*>();
 
 			if (object != NULL) {
 				controlledObject->removeObject(object, NULL, true);
@@ -678,7 +678,7 @@ int PetControlDeviceImplementation::canBeDestroyed(CreatureObject* player) {
 }
 
 bool PetControlDeviceImplementation::canBeTradedTo(CreatureObject* player, CreatureObject* receiver, int numberInTrade) {
-	ManagedReference<SceneObject*> datapad = receiver->getSlottedObject("datapad");
+	ManagedReference<SceneObject*> datapad = receiver->getKnownSlottedObject(SlotIndex::DATAPAD);
 
 	if (datapad == NULL)
 		return false;
@@ -79,7 +79,7 @@ void ShipControlDeviceImplementation::fillObjectMenuResponse(ObjectMenuResponse*
 }
 
 bool ShipControlDeviceImplementation::canBeTradedTo(CreatureObject* player, CreatureObject* receiver, int numberInTrade) {
-	ManagedReference<SceneObject*> datapad = receiver->getSlottedObject("datapad");
+	ManagedReference<SceneObject*> datapad = receiver->getKnownSlottedObject(SlotIndex::DATAPAD);
 
 	if (datapad == NULL)
 		return false;
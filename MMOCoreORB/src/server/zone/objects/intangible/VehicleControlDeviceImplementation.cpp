@@ -56,7 +56,7 @@ void VehicleControlDeviceImplementation::generateObject(CreatureObject* player)
 		return;
 	}
 
-	ManagedReference<SceneObject*> datapad = player->getSlottedObject("datapad");
+	ManagedReference<SceneObject*> datapad = player->getKnownSlottedObject(SlotIndex::DATAPAD);
 
 	if (datapad == NULL)
 		return;
@@ -226,14 +226,14 @@ void VehicleControlDeviceImplementation::destroyObjectFromDatabase(bool destroyC
 		Locker locker(controlledObject);
 
 		//ManagedReference<CreatureObject*> object = controlledObject.castTo<CreatureObject*>()->getLinkedCreature();
-		ManagedReference<CreatureObject*> object = controlledObject->getSlottedObject("rider").castTo<CreatureObject*>();
+		ManagedReference<CreatureObject*> object = controlledObject->getKnownSlottedObject(SlotIndex::RIDER).castTo<CreatureObject*>();
 
 		if (object != NULL) {
 			Locker clocker(object, controlledObject);
 
 			object->executeObjectControllerAction(STRING_HASHCODE("dismount"));
 
-			object = controlledObject->getSlottedObject("rider").castTo<CreatureObject*>();
+			object = controlledObject->getKnownSlottedObject(SlotIndex::RIDER).castTo<CreatureObject*>();
 
 			if (object != NULL) {
 				controlledObject->removeObject(object, NULL, true);
@@ -263,7 +263,7 @@ int VehicleControlDeviceImplementation::canBeDestroyed(CreatureObject* player) {
 }
 
 bool VehicleControlDeviceImplementation::canBeTradedTo(CreatureObject* player, CreatureObject* receiver, int numberInTrade) {
-	ManagedReference<SceneObject*> datapad = receiver->getSlottedObject("datapad");
+	ManagedReference<SceneObject*> datapad = receiver->getKnownSlottedObject(SlotIndex::DATAPAD);
 
 	if (datapad == NULL)
 		return false;
@@ -179,7 +179,7 @@ public:
 				continue;
 			}
 
-			SceneObject* parent = player->getSlottedObject("inventory");
+			SceneObject* parent = player->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 			if(parent == NULL) {
 				warning("Can't return object, inventory is null");
@@ -549,7 +549,7 @@ void BountyMissionObjectiveImplementation::handleNpcTargetKilled(Observable* obs
 	if (owner == NULL || target == NULL)
 		return;
 
-	SceneObject* targetInventory = target->getSlottedObject("inventory");
+	SceneObject* targetInventory = target->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 	if (targetInventory == NULL)
 		return;
@@ -14,7 +14,7 @@ void CraftingMissionObjectiveImplementation::updateMissionStatus(CreatureObject*
 
 	if(mission == NULL)
 		return;
-	ManagedReference<SceneObject*> inventory = player->getSlottedObject("inventory");
+	ManagedReference<SceneObject*> inventory = player->getKnownSlottedObject(SlotIndex::INVENTORY);
 	if (inventory == NULL) {
 		return;
 	}
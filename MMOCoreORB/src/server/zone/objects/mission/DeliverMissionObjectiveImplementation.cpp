@@ -177,7 +177,7 @@ void DeliverMissionObjectiveImplementation::updateMissionStatus(CreatureObject*
 	StringBuffer itemEntry;
 	itemEntry << "m" << mission->getMissionNumber();
 
-	ManagedReference<SceneObject*> inventory = player->getSlottedObject("inventory");
+	ManagedReference<SceneObject*> inventory = player->getKnownSlottedObject(SlotIndex::INVENTORY);
 	StringId itemName;
 
 	Locker lock(player);
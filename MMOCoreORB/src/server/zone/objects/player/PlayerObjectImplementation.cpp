@@ -176,7 +176,7 @@ void PlayerObjectImplementation::notifyLoadFromDatabase() {
 }
 
 void PlayerObjectImplementation::unloadSpawnedChildren() {
-	ManagedReference<SceneObject*> datapad = getParent().get()->getSlottedObject("datapad");
+	ManagedReference<SceneObject*> datapad = getParent().get()->getKnownSlottedObject(SlotIndex::DATAPAD);
 	ManagedReference<CreatureObject*> creo = dynamic_cast<CreatureObject*>(parent.get().get());
 
 	if (datapad == NULL)
@@ -1971,7 +1971,7 @@ void PlayerObjectImplementation::activateMissions() {
 		return;
 	}
 
-	SceneObject* datapad = creature->getSlottedObject("datapad");
+	SceneObject* datapad = creature->getKnownSlottedObject(SlotIndex::DATAPAD);
 
 	if (datapad == NULL) {
 		return;
@@ -311,7 +311,7 @@ Instrument* EntertainingSessionImplementation::getInstrument(CreatureObject* cre
 		else
 			return instrument;
 	} else {
-		SceneObject* object = creature->getSlottedObject("hold_r");
+		SceneObject* object = creature->getKnownSlottedObject(SlotIndex::HOLD_R);
 
 		return dynamic_cast<Instrument*>(object);
 	}
@@ -957,7 +957,7 @@ void EntertainingSessionImplementation::updateEntertainerMissionStatus(bool ente
 		return;
 	}
 
-	SceneObject* datapad = entertainer->getSlottedObject("datapad");
+	SceneObject* datapad = entertainer->getKnownSlottedObject(SlotIndex::DATAPAD);
 
 	if (datapad == NULL) {
 		return;
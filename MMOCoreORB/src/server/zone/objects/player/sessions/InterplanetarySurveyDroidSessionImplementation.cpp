@@ -30,7 +30,7 @@ bool InterplanetarySurveyDroidSessionImplementation::hasSurveyTool() {
 	if (player == NULL)
 		return false;
 
-	ManagedReference<SceneObject*> inventory = player->getSlottedObject("inventory");
+	ManagedReference<SceneObject*> inventory = player->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 	if (inventory == NULL)
 		return false;
@@ -60,7 +60,7 @@ void InterplanetarySurveyDroidSessionImplementation::initalizeDroid(TangibleObje
 		return;
 	}
 
-	ManagedReference<SceneObject*> inventory = player->getSlottedObject("inventory");
+	ManagedReference<SceneObject*> inventory = player->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 	if (inventory == NULL) {
 		cancelSession();
@@ -56,7 +56,7 @@ void LootLotterySessionImplementation::doLotteryDraw() {
 	}
 
 	//Get the corpse's inventory and container permissions.
-	SceneObject* lootContainer = corpse.get()->getSlottedObject("inventory");
+	SceneObject* lootContainer = corpse.get()->getKnownSlottedObject(SlotIndex::INVENTORY);
 	if (lootContainer == NULL)
 		return;
 
@@ -146,7 +146,7 @@ int PlaceStructureSessionImplementation::completeSession() {
 	removeTemporaryNoBuildZone();
 
 	if (structureObject == NULL) {
-		ManagedReference<SceneObject*> inventory = creature->getSlottedObject("inventory");
+		ManagedReference<SceneObject*> inventory = creature->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 		if (inventory != NULL)
 			inventory->transferObject(deed, -1, true);
@@ -69,7 +69,7 @@ void SlicingSessionImplementation::initalizeSlicingMenu(CreatureObject* pl, Tang
 	}
 
 	//bugfix 814,819
-	ManagedReference<SceneObject*> inventory = player->getSlottedObject("inventory");
+	ManagedReference<SceneObject*> inventory = player->getKnownSlottedObject(SlotIndex::INVENTORY);
 	if (inventory == NULL)
 		return;
 
@@ -160,7 +160,7 @@ void SlicingSessionImplementation::handleMenuSelect(CreatureObject* pl, byte men
 	if (tangibleObject == NULL || player == NULL || player != pl)
 		return;
 
-	ManagedReference<SceneObject*> inventory = player->getSlottedObject("inventory");
+	ManagedReference<SceneObject*> inventory = player->getKnownSlottedObject(SlotIndex::INVENTORY);
 	if (inventory == NULL)
 		return;
 
@@ -272,7 +272,7 @@ bool SlicingSessionImplementation::hasPrecisionLaserKnife(bool removeItem) {
 	if (player == NULL)
 		return 0;
 
-	ManagedReference<SceneObject*> inventory = player->getSlottedObject("inventory");
+	ManagedReference<SceneObject*> inventory = player->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 	if (inventory == NULL)
 		return false;
@@ -308,7 +308,7 @@ bool SlicingSessionImplementation::hasWeaponUpgradeKit() {
 	if (player == NULL)
 		return false;
 
-	ManagedReference<SceneObject*> inventory = player->getSlottedObject("inventory");
+	ManagedReference<SceneObject*> inventory = player->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 	if (inventory == NULL)
 		return false;
@@ -338,7 +338,7 @@ bool SlicingSessionImplementation::hasArmorUpgradeKit() {
 	if (player == NULL)
 		return false;
 
-	ManagedReference<SceneObject*> inventory = player->getSlottedObject("inventory");
+	ManagedReference<SceneObject*> inventory = player->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 	if (inventory == NULL)
 		return false;
@@ -368,7 +368,7 @@ void SlicingSessionImplementation::useClampFromInventory(SlicingTool* clamp) {
 	if (clamp == NULL || clamp->getGameObjectType() != SceneObjectType::MOLECULARCLAMP)
 		return;
 
-	ManagedReference<SceneObject*> inventory = player->getSlottedObject("inventory");
+	ManagedReference<SceneObject*> inventory = player->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 	Locker locker(clamp);
 
@@ -391,7 +391,7 @@ void SlicingSessionImplementation::handleUseClamp() {
 	if (player == NULL || tangibleObject == NULL)
 		return;
 
-	ManagedReference<SceneObject*> inventory = player->getSlottedObject("inventory");
+	ManagedReference<SceneObject*> inventory = player->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 	Locker inventoryLocker(inventory);
 
@@ -422,7 +422,7 @@ void SlicingSessionImplementation::handleUseFlowAnalyzer() {
 	if (player == NULL || tangibleObject == NULL)
 		return;
 
-	ManagedReference<SceneObject*> inventory = player->getSlottedObject("inventory");
+	ManagedReference<SceneObject*> inventory = player->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 	Locker inventoryLocker(inventory);
 
@@ -691,7 +691,7 @@ void SlicingSessionImplementation::handleContainerSlice() {
 	if (tangibleObject == NULL || player == NULL)
 		return;
 
-	ManagedReference<SceneObject*> inventory = player->getSlottedObject("inventory");
+	ManagedReference<SceneObject*> inventory = player->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 	if (inventory == NULL)
 		return;
@@ -465,7 +465,7 @@ void CraftingSessionImplementation::addIngredient(TangibleObject* tano, int slot
 		return;
 	}
 
-	SceneObject* inventory = crafter->getSlottedObject("inventory");
+	SceneObject* inventory = crafter->getKnownSlottedObject(SlotIndex::INVENTORY);
 	if (inventory == NULL) {
 		sendSlotMessage(clientCounter, IngredientSlot::NOINVENTORY);
 		return;
@@ -534,7 +534,7 @@ void CraftingSessionImplementation::removeIngredient(TangibleObject* tano, int s
 		return;
 	}
 
-	SceneObject* inventory = crafter->getSlottedObject("inventory");
+	SceneObject* inventory = crafter->getKnownSlottedObject(SlotIndex::INVENTORY);
 	if (inventory == NULL) {
 		sendSlotMessage(clientCounter, IngredientSlot::NOINVENTORY);
 		return;
@@ -590,7 +590,7 @@ void CraftingSessionImplementation::nextCraftingStage(int clientCounter) {
 
 	Locker locker(manufactureSchematic);
 
-	ManagedReference<SceneObject*> craftingComponents = craftingTool->getSlottedObject("crafted_components");
+	ManagedReference<SceneObject*> craftingComponents = craftingTool->getKnownSlottedObject(SlotIndex::CRAFTED_COMPONENTS);
 
 	if(craftingComponents != NULL) {
 
@@ -1301,7 +1301,7 @@ void CraftingSessionImplementation::createManufactureSchematic(int clientCounter
 
 		crafter->sendMessage(objMsg);
 
-		ManagedReference<SceneObject*> datapad = crafter->getSlottedObject("datapad");
+		ManagedReference<SceneObject*> datapad = crafter->getKnownSlottedObject(SlotIndex::DATAPAD);
 
 		Locker prototypeLocker(prototype);
 
@@ -36,7 +36,7 @@ public:
 		ObjectManager* objectManager = crafter->getZoneServer()->getObjectManager();
 		objectManager->persistSceneObjectsRecursively(prototype, 1);
 
-		ManagedReference<SceneObject*> inventory = crafter->getSlottedObject("inventory");
+		ManagedReference<SceneObject*> inventory = crafter->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 		if (inventory != NULL && craftingTool->isASubChildOf(crafter) && !inventory->isContainerFullRecursive()) {
 
@@ -59,7 +59,7 @@ public:
 			return;
 		}
 
-		SceneObject* inventory = player->getSlottedObject("inventory");
+		SceneObject* inventory = player->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 		if (inventory == NULL) {
 			return;
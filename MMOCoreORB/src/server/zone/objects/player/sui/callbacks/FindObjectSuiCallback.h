@@ -66,7 +66,7 @@ public:
 			objectController->activateCommand(creature, STRING_HASHCODE("teleport"), 0, 0, arguments.toString());
 
 		} else {
-			Reference<PlayerObject*> ghost = creature->getSlottedObject("ghost").castTo<PlayerObject*>();
+			Reference<PlayerObject*> ghost = creature->getKnownSlottedObject(SlotIndex::GHOST).castTo<PlayerObject*>();
 			ManagedReference<WaypointObject*> obj = server->createObject(0xc456e788, 1).castTo<WaypointObject*>();
 
 			Locker locker(obj);
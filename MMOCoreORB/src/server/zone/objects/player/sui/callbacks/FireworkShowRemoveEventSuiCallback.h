@@ -53,7 +53,7 @@ public:
 
 		fireworkShowData->removeFirework(fireworkIndex);
 
-		ManagedReference<SceneObject*> inventory = player->getSlottedObject("inventory");
+		ManagedReference<SceneObject*> inventory = player->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 		inventory->transferObject(firework, -1, false);
 		firework->sendTo(player, true);
@@ -35,7 +35,7 @@ public:
 		}
 
 		// Generate new deed
-		SceneObject* inventory = player->getSlottedObject("inventory");
+		SceneObject* inventory = player->getKnownSlottedObject(SlotIndex::INVENTORY);
 		if(inventory == NULL) {
 			player->sendSystemMessage( "@veteran:flash_speeder_grant_failed" ); // "Flash Speeder deed grant has failed. This could be the result of being ineligible or not having enough credits to pay for the replacement fee."
 			return;
@@ -37,7 +37,7 @@ public:
 		if (deed == NULL)
 			return;
 
-		ManagedReference<SceneObject*> inventory = creature->getSlottedObject("inventory");
+		ManagedReference<SceneObject*> inventory = creature->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 		if (inventory == NULL || !deed->isASubChildOf(inventory)) //No longer in inventory.
 			return;
@@ -25,7 +25,7 @@ public:
 		if(player->isDead() || player->isIncapacitated())
 			return;
 
-		Reference<PlayerObject*> ghost = player->getSlottedObject("ghost").castTo<PlayerObject*>();
+		Reference<PlayerObject*> ghost = player->getKnownSlottedObject(SlotIndex::GHOST).castTo<PlayerObject*>();
 
 		if (ghost == NULL)
 			return;
@@ -13,22 +13,22 @@
 #include "server/ServerCore.h"
 #include "server/zone/managers/skill/SkillManager.h"
 
-bool AbilityList::contains(const String& element) {
-	String lowCase = element.toLowerCase();
-
-	for (int i = 0; i < vector.size(); ++i) {
-		Ability* ability = vector.get(i);
+AbilityList::AbilityList() {
+	abilityCRCs.setAllowDuplicateInsertPlan();
+}
 
-		if (ability == NULL)
-			continue;
+uint32 AbilityList::getAbilityCRC(Ability* ability) {
+	return ability->getAbilityName().toLowerCase().hashCode();
+}
 
-		String skill = ability->getAbilityName().toLowerCase();
+bool AbilityList::contains(const String& element) {
+	return contains(element.toLowerCase().hashCode());
+}
 
-		if (lowCase == skill)
-			return true;
-	}
+bool AbilityList::contains(uint32 abilityCRC) {
+	ReadLocker locker(getLock());
 
-	return false;
+	return abilityCRCs.find(abilityCRC) != -1;
 }
 
 void AbilityList::insertToMessage(BaseMessage* msg) {
@@ -89,6 +89,7 @@ void AbilityList::loadFromNames(Vector<String>& abilities) {
 			Logger::console.error(name + " is null when trying to load from database");
 		} else {
 			vector.add(ability);
+			abilityCRCs.put(getAbilityCRC(ability));
 		}
 	}
 }
@@ -97,8 +98,12 @@ bool AbilityList::add(Ability* ability, DeltaMessage* message, int updates) {
 	if (ability == NULL)
 		return false;
 
+	Locker locker(getLock());
+
 	bool val = vector.add(ability);
 
+	abilityCRCs.put(getAbilityCRC(ability));
+
 	if (message != NULL) {
 		if (updates != 0)
 			message->startList(updates, updateCounter += updates);
@@ -110,3 +115,57 @@ bool AbilityList::add(Ability* ability, DeltaMessage* message, int updates) {
 
 	return val;
 }
+
+Ability* AbilityList::set(int idx, Ability* const& newValue, DeltaMessage* message, int updates) {
+	Locker locker(getLock());
+
+	Ability* oldValue = vector.set(idx, newValue);
+
+	if (oldValue != NULL)
+		abilityCRCs.drop(getAbilityCRC(oldValue));
+
+	if (newValue != NULL)
+		abilityCRCs.put(getAbilityCRC(newValue));
+
+	if (message != NULL) {
+		if (updates != 0)
+			message->startList(updates, updateCounter += updates);
+
+		message->insertByte(2);
+		message->insertShort(idx);
+		newValue->toBinaryStream(message);
+	}
+
+	return oldValue;
+}
+
+Ability* AbilityList::remove(int index, DeltaMessage* message, int updates) {
+	Locker locker(getLock());
+
+	Ability* ability = vector.remove(index);
+
+	if (ability != NULL)
+		abilityCRCs.drop(getAbilityCRC(ability));
+
+	if (message != NULL) {
+		if (updates != 0)
+			message->startList(updates, updateCounter += updates);
+
+		message->insertByte(0);
+		message->insertShort((uint16)index);
+	}
+
+	return ability;
+}
+
+void AbilityList::removeAll(DeltaMessage* message) {
+	Locker locker(getLock());
+
+	vector.removeAll();
+	abilityCRCs.removeAll();
+
+	if (message != NULL) {
+		message->startList(1, ++updateCounter);
+		message->insertByte(4);
+	}
+}
@@ -15,16 +15,32 @@ class Ability;
 
 /**
  * The ability list is just a vector of strings that award the ability to perform specific actions.
+ * The crc of every lower case ability name is kept sorted alongside it for the lookups.
  */
 class AbilityList : public DeltaVector<Ability*> {
 private:
+	SortedVector<uint32> abilityCRCs;
+
 	void getStringList(Vector<String>& abilities);
 	void loadFromNames(Vector<String>& abilities);
 
+	static uint32 getAbilityCRC(Ability* ability);
+
 public:
+	AbilityList();
+
 	bool add(Ability* ability, DeltaMessage* message = NULL, int updates = 1);
+	Ability* set(int idx, Ability* const& newValue, DeltaMessage* message = NULL, int updates = 1);
+	Ability* remove(int index, DeltaMessage* message = NULL, int updates = 1);
+	void removeAll(DeltaMessage* message = NULL);
+
 	bool contains(const String& element);
 
+	/**
+	 * @param abilityCRC crc of the lower case ability name
+	 */
+	bool contains(uint32 abilityCRC);
+
 	bool toBinaryStream(ObjectOutputStream* stream);
 	bool parseFromBinaryStream(ObjectInputStream* stream);
 
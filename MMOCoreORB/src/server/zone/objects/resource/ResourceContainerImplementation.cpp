@@ -139,7 +139,7 @@ void ResourceContainerImplementation::split(int newStackSize) {
 
 void ResourceContainerImplementation::split(int newStackSize, CreatureObject* player) {
 
-	ManagedReference<SceneObject*> inventory = player->getSlottedObject("inventory");
+	ManagedReference<SceneObject*> inventory = player->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 	if (inventory == NULL)
 		return;
@@ -208,6 +208,19 @@ float ResourceSpawnImplementation::getDensityAt(const String& zoneName, float x,
 	return map.getDensityAt(x, y);
 }
 
+void ResourceSpawnImplementation::getDensityGrid(const String& zoneName, float x, float y, float spacing, int points, Vector<float>* densities) {
+	if (!spawnMaps.contains(zoneName) || !inShift()) {
+		for (int i = 0; i < points * points; ++i)
+			densities->add(0);
+
+		return;
+	}
+
+	SpawnDensityMap map = spawnMaps.get(zoneName);
+
+	map.getDensityGrid(x, y, spacing, points, densities);
+}
+
 String ResourceSpawnImplementation::getSpawnMapZone(int i) {
 	if (spawnMaps.size() > i)
 		return spawnMaps.elementAt(i).getKey();
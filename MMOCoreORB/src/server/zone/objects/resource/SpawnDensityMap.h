@@ -101,6 +101,25 @@ public:
 		return value * density;
 	}
 
+	/**
+	 * Adds the densities of a points x points grid to densities, row by row
+	 * \param x The x coordinate of the first point of every row, rising by spacing along a row
+	 * \param y The y coordinate of the first row, falling by spacing with every row
+	 */
+	void getDensityGrid(float x, float y, float spacing, int points, Vector<float>* densities) {
+		float noiseZ = seed * modifier;
+
+		for (int i = 0; i < points; ++i) {
+			float noiseY = (maxY - (y - i * spacing)) * modifier;
+
+			for (int j = 0; j < points; ++j) {
+				float value = SimplexNoise::noise((x + j * spacing - minX) * modifier, noiseY, noiseZ);
+
+				densities->add(value < 0 ? 0 : value * density);
+			}
+		}
+	}
+
 	void print() {
 		System::out << "Seed: " << seed << " Modifier: "
 				<< modifier << " Density: " << density << endl;
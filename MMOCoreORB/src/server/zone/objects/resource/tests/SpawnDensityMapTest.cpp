@@ -0,0 +1,92 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#include "gtest/gtest.h"
+
+#include "server/zone/objects/resource/SpawnDensityMap.h"
+
+class SpawnDensityMapTest : public ::testing::Test {
+public:
+	// largest survey tool grid
+	const static int POINTS = 6;
+
+	const static int SURVEYS = 20000;
+
+	float getStart(float spacing) {
+		return System::random(14000) - 7000 - ((POINTS - 1) / 2.0f) * spacing;
+	}
+};
+
+TEST_F(SpawnDensityMapTest, GridMatchesPointDensities) {
+	for (int concentration = 1; concentration <= 3; ++concentration) {
+		for (int ore = 0; ore < 2; ++ore) {
+			SpawnDensityMap map(ore, concentration, -8192, 8192, -8192, 8192);
+
+			for (int survey = 0; survey < 100; ++survey) {
+				float spacing = (System::random(1024 - 64) + 64) / float(POINTS - 1);
+				float x = getStart(spacing);
+				float y = getStart(spacing);
+
+				Vector<float> densities;
+				map.getDensityGrid(x, y, spacing, POINTS, &densities);
+
+				ASSERT_EQ(POINTS * POINTS, densities.size());
+
+				for (int i = 0; i < POINTS; ++i) {
+					for (int j = 0; j < POINTS; ++j) {
+						float pointX = x + j * spacing;
+						float pointY = y - i * spacing;
+
+						ASSERT_FLOAT_EQ(map.getDensityAt(pointX, pointY), densities.get(i * POINTS + j)) << pointX << " " << pointY;
+					}
+				}
+			}
+		}
+	}
+}
+
+TEST_F(SpawnDensityMapTest, GridAgainstPointDensitiesBenchmark) {
+	SpawnDensityMap map(false, 1, -8192, 8192, -8192, 8192);
+
+	float spacing = 320 / float(POINTS - 1);
+	float x = getStart(spacing);
+	float y = getStart(spacing);
+
+	float pointSum = 0;
+
+	Time start;
+
+	for (int survey = 0; survey < SURVEYS; ++survey) {
+		for (int i = 0; i < POINTS; ++i) {
+			for (int j = 0; j < POINTS; ++j) {
+				// the map copy every ResourceSpawn::getDensityAt call makes
+				SpawnDensityMap copy = map;
+				pointSum += copy.getDensityAt(x + j * spacing, y - i * spacing);
+			}
+		}
+	}
+
+	uint64 pointTime = start.miliDifference();
+
+	float gridSum = 0;
+
+	start.updateToCurrentTime();
+
+	for (int survey = 0; survey < SURVEYS; ++survey) {
+		SpawnDensityMap copy = map;
+
+		Vector<float> densities;
+		copy.getDensityGrid(x, y, spacing, POINTS, &densities);
+
+		for (int i = 0; i < densities.size(); ++i)
+			gridSum += densities.get(i);
+	}
+
+	uint64 gridTime = start.miliDifference();
+
+	EXPECT_NEAR(pointSum, gridSum, pointSum * 1e-5);
+
+	RecordProperty("point_ms", (int) pointTime);
+	RecordProperty("grid_ms", (int) gridTime);
+}
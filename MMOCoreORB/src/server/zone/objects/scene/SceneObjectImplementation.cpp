@@ -27,6 +27,7 @@
 #include "server/zone/managers/stringid/StringIdManager.h"
 #include "server/zone/packets/object/ObjectMenuResponse.h"
 #include "server/zone/packets/object/ShowFlyText.h"
+#include "server/zone/packets/BroadcastPacket.h"
 
 #include "server/zone/ZoneClientSession.h"
 #include "server/zone/Zone.h"
@@ -81,6 +82,17 @@ void SceneObjectImplementation::initializeTransientMembers() {
 
 	movementCounter = 0;
 
+	countableObjectsRecursive = -1;
+
+	Locker locker(&containerLock);
+
+	knownSlottedObjects.removeAll(SlotIndex::SIZE, 1);
+
+	for (int i = 0; i < SlotIndex::SIZE; ++i)
+		knownSlottedObjects.add(slottedObjects.get(SlotIndex::getSlotName(i)));
+
+	locker.release();
+
 	setGlobalLogging(true);
 	setLogging(false);
 
@@ -678,6 +690,8 @@ void SceneObjectImplementation::broadcastMessagePrivate(BasePacket* message, Sce
 		throw;
 	}
 
+	BroadcastPacket<SceneObject*> broadcast(message);
+
 	for (int i = 0; i < maxInRangeObjectCount; ++i) {
 		SceneObject* scno;
 
@@ -689,10 +703,10 @@ void SceneObjectImplementation::broadcastMessagePrivate(BasePacket* message, Sce
 		ManagedReference<ZoneClientSession*> client = scno->getClient();
 
 		if (scno->isVehicleObject() || client != NULL || scno->isMount())
-			scno->sendMessage(message->clone());
+			broadcast.sendTo(scno);
 	}
 
-	delete message;
+	broadcast.flush();
 
 	if (closeSceneObjects != NULL)
 		delete closeSceneObjects;	
@@ -770,6 +784,8 @@ void SceneObjectImplementation::broadcastMessagesPrivate(Vector<BasePacket*>* me
 		e.printStackTrace();
 	}
 
+	BroadcastPacket<SceneObject*> broadcast(messages);
+
 	for (int i = 0; i < maxInRangeObjectCount; ++i) {
 		SceneObject* scno = static_cast<SceneObject*>(closeSceneObjects.get(i).get());
 
@@ -778,17 +794,11 @@ void SceneObjectImplementation::broadcastMessagesPrivate(Vector<BasePacket*>* me
 
 		ManagedReference<ZoneClientSession*> client = scno->getClient();
 
-		if (scno->isVehicleObject() || client != NULL || scno->isMount()) {
-			for (int j = 0; j < messages->size(); ++j) {
-				BasePacket* msg = messages->get(j);
-				scno->sendMessage(msg->clone());
-			}
-		}
+		if (scno->isVehicleObject() || client != NULL || scno->isMount())
+			broadcast.sendTo(scno);
 	}
 
-	while (!messages->isEmpty()) {
-		delete messages->remove(0);
-	}
+	broadcast.flush();
 }
 
 void SceneObjectImplementation::broadcastMessages(Vector<BasePacket*>* messages, bool sendSelf) {
@@ -835,6 +845,9 @@ void SceneObjectImplementation::sendMessage(BasePacket* msg) {
 	delete msg;
 }
 
+void SceneObjectImplementation::sendSharedMessage(SharedPacket* packet) {
+}
+
 void SceneObjectImplementation::updateVehiclePosition(bool sendPackets) {
 	ManagedReference<SceneObject*> parent = getParent().get();
 
@@ -1399,16 +1412,44 @@ Reference<SceneObject*> SceneObjectImplementation::getSlottedObject(int idx) {
 	return obj;
 }
 
+Reference<SceneObject*> SceneObjectImplementation::getKnownSlottedObject(int slotIndex) {
+	ManagedReference<SceneObject*> obj = NULL;
+
+	ReadLocker locker(&containerLock);
+
+	if (slotIndex < knownSlottedObjects.size())
+		obj = knownSlottedObjects.get(slotIndex);
+	else
+		obj = slottedObjects.get(SlotIndex::getSlotName(slotIndex));
+
+	return obj;
+}
+
+void SceneObjectImplementation::refreshKnownSlottedObject(const String& slot) {
+	int slotIndex = SlotIndex::getIndex(slot);
+
+	if (slotIndex == -1 || slotIndex >= knownSlottedObjects.size())
+		return;
+
+	knownSlottedObjects.set(slotIndex, slottedObjects.get(slot));
+}
+
 void SceneObjectImplementation::dropSlottedObject(const String& arrengementDescriptor) {
 	Locker locker(&containerLock);
 
 	slottedObjects.drop(arrengementDescriptor);
+
+	refreshKnownSlottedObject(arrengementDescriptor);
 }
 
 void SceneObjectImplementation::removeSlottedObject(int index) {
 	Locker locker(&containerLock);
 
+	String slot = slottedObjects.elementAt(index).getKey();
+
 	slottedObjects.remove(index);
+
+	refreshKnownSlottedObject(slot);
 }
 
 void SceneObjectImplementation::setZone(Zone* zone) {
@@ -1488,15 +1529,15 @@ String SceneObjectImplementation::getDisplayedName() {
 	return StringIdManager::instance()->getStringId(objectName.getFullPath().hashCode()).toString();
 }
 
-bool SceneObjectImplementation::setTransformForCollisionMatrixIfNull(Matrix4* mat) {
-	return transformForCollisionMatrix.compareAndSet(NULL, mat);
-}
 
 int SceneObjectImplementation::getCountableObjectsRecursive() {
-	int count = 0;
-
 	Locker locker(&containerLock);
 
+	if (countableObjectsRecursive >= 0)
+		return countableObjectsRecursive;
+
+	int count = 0;
+
 	for (int i = 0; i < containerObjects.size(); ++i) {
 		ManagedReference<SceneObject*> obj = containerObjects.get(i);
 
@@ -1507,9 +1548,24 @@ int SceneObjectImplementation::getCountableObjectsRecursive() {
 		}
 	}
 
+	countableObjectsRecursive = count;
+
 	return count;
 }
 
+void SceneObjectImplementation::invalidateCountableObjectsRecursive() {
+	Locker locker(&containerLock);
+
+	countableObjectsRecursive = -1;
+
+	locker.release();
+
+	ManagedReference<SceneObject*> par = parent.get();
+
+	if (par != NULL)
+		par->invalidateCountableObjectsRecursive();
+}
+
 int SceneObjectImplementation::getContainedObjectsRecursive() {
 	int count = 0;
 
@@ -1607,7 +1663,7 @@ Reference<SceneObject*> SceneObjectImplementation::getCraftedComponentsSatchel()
 	if(zServer == NULL)
 		return NULL;
 	
-	ManagedReference<SceneObject*> craftingComponents = sceno->getSlottedObject("crafted_components");
+	ManagedReference<SceneObject*> craftingComponents = sceno->getKnownSlottedObject(SlotIndex::CRAFTED_COMPONENTS);
 	ManagedReference<SceneObject*> craftingComponentsSatchel = NULL;
 	
     
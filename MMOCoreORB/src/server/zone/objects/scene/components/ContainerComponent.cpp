@@ -197,6 +197,7 @@ bool ContainerComponent::transferObject(SceneObject* sceneObject, SceneObject* o
 
 			for (int i = 0; i < descriptors->size(); ++i)	{
 				 slottedObjects->put(descriptors->get(i), object);
+				 sceneObject->refreshKnownSlottedObject(descriptors->get(i));
 			}
 		} else {
 			return false;
@@ -220,6 +221,10 @@ bool ContainerComponent::transferObject(SceneObject* sceneObject, SceneObject* o
 		object->setParent(sceneObject);
 		object->setContainmentType(containmentType);
 
+		contLocker.release();
+
+		sceneObject->invalidateCountableObjectsRecursive();
+
 	} else {
 		sceneObject->error("unknown containment type " + String::valueOf(containmentType));
 		StackTrace::printStackTrace();
@@ -261,6 +266,10 @@ bool ContainerComponent::removeObject(SceneObject* sceneObject, SceneObject* obj
 
 		containerObjects->drop(object->getObjectID());
 
+		contLocker.release();
+
+		sceneObject->invalidateCountableObjectsRecursive();
+
 		if (objParent->hasObjectInContainer(object->getObjectID()) || objParent->hasObjectInSlottedContainer(object)) {
 			sceneObject->error("trying to remove an object that is in a different object");
 			objParent->info("i am the parent", true);
@@ -298,8 +307,10 @@ bool ContainerComponent::removeObject(SceneObject* sceneObject, SceneObject* obj
 		}
 
 		if (removeFromSlot) {
-			for (int i = 0; i < descriptors->size(); ++i)
+			for (int i = 0; i < descriptors->size(); ++i) {
 				slottedObjects->drop(descriptors->get(i));
+				sceneObject->refreshKnownSlottedObject(descriptors->get(i));
+			}
 		}
 	}
 
@@ -319,6 +330,8 @@ bool ContainerComponent::removeObject(SceneObject* sceneObject, SceneObject* obj
 	object->setParent(NULL);
 
 	contLocker.release();
+
+	sceneObject->invalidateCountableObjectsRecursive();
 	/*
 
 	} else {
@@ -168,14 +168,12 @@ void ZoneComponent::updateZone(SceneObject* sceneObject, bool lightUpdate, bool
 	if (parent != NULL && (parent->isVehicleObject() || parent->isMount()))
 		sceneObject->updateVehiclePosition(sendPackets);
 
-	Locker _locker(zone);
-
-	bool zoneUnlocked = false;
-
 	if (parent != NULL && parent->isCellObject()) {
 		//parent->removeObject(sceneObject, true);
 		//removeFromBuilding(sceneObject, dynamic_cast<BuildingObject*>(parent->getParent()));
 
+		Locker _locker(zone);
+
 		ManagedReference<SceneObject*> rootParent = parent->getRootParent().get();
 
 		if (rootParent == NULL)
@@ -184,16 +182,11 @@ void ZoneComponent::updateZone(SceneObject* sceneObject, bool lightUpdate, bool
 		zone = rootParent->getZone();
 
 		zone->transferObject(sceneObject, -1, false);
-
-		zone->unlock();
-		zoneUnlocked = true;
 	} else {
+		// the zone spatial index locks its own shards, moving in the open world doesn't need the zone lock
 		if (sceneObject->getLocalZone() != NULL) {
 			zone->update(sceneObject);
 
-			zone->unlock();
-			zoneUnlocked = true;
-
 			try {
 				zone->inRange(sceneObject, ZoneServer::CLOSEOBJECTRANGE);
 			} catch (Exception& e) {
@@ -201,9 +194,6 @@ void ZoneComponent::updateZone(SceneObject* sceneObject, bool lightUpdate, bool
 				e.printStackTrace();
 			}
 		} else if (parent != NULL) {
-			zone->unlock();
-			zoneUnlocked = true;
-
 			updateInRangeObjectsOnMount(sceneObject);
 		}
 	}
@@ -240,9 +230,6 @@ void ZoneComponent::updateZone(SceneObject* sceneObject, bool lightUpdate, bool
 		sceneObject->error(e.getMessage());
 		e.printStackTrace();
 	}
-
-	if (zoneUnlocked)
-		zone->wlock();
 }
 
 void ZoneComponent::updateZoneWithParent(SceneObject* sceneObject, SceneObject* newParent, bool lightUpdate, bool sendPackets) const {
@@ -0,0 +1,100 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#ifndef COLLISIONTRANSFORM_H_
+#define COLLISIONTRANSFORM_H_
+
+#include "engine/engine.h"
+
+#include <atomic>
+
+/**
+ * World to model space matrix of a SceneObject, kept inline in the object.
+ * The matrix remembers the position and direction it was built for, so
+ * moving or rotating the object makes it stale without any notification.
+ * Readers never lock, a sequence number odd while the matrix is being
+ * rewritten tells them to retry or build their own copy.
+ */
+namespace server {
+ namespace zone {
+  namespace objects {
+   namespace scene {
+    namespace variables {
+
+    class CollisionTransform {
+    public:
+    	const static int KEYSIZE = 7;
+
+    protected:
+    	AtomicInteger sequence;
+
+    	// position x, z, y and direction w, x, y, z
+    	float key[KEYSIZE];
+    	bool built;
+
+    	Matrix4 worldToModel;
+
+    public:
+    	CollisionTransform() : built(false) {
+    		for (int i = 0; i < KEYSIZE; ++i)
+    			key[i] = 0;
+    	}
+
+    	/**
+    	 * Copies the matrix into matrix if it was built for currentKey
+    	 * @return false if the matrix is stale or being rewritten
+    	 */
+    	bool read(const float* currentKey, Matrix4& matrix) {
+    		uint32 before = sequence.get();
+
+    		if (before & 1)
+    			return false;
+
+    		std::atomic_thread_fence(std::memory_order_acquire);
+
+    		if (!built)
+    			return false;
+
+    		for (int i = 0; i < KEYSIZE; ++i) {
+    			if (key[i] != currentKey[i])
+    				return false;
+    		}
+
+    		matrix = worldToModel;
+
+    		std::atomic_thread_fence(std::memory_order_acquire);
+
+    		return sequence.get() == before;
+    	}
+
+    	/**
+    	 * Stores matrix built for newKey unless another thread is storing one right now
+    	 */
+    	void write(const float* newKey, const Matrix4& matrix) {
+    		uint32 current = sequence.get();
+
+    		if ((current & 1) || !sequence.compareAndSet(current, current + 1))
+    			return;
+
+    		for (int i = 0; i < KEYSIZE; ++i)
+    			key[i] = newKey[i];
+
+    		worldToModel = matrix;
+    		built = true;
+
+    		std::atomic_thread_fence(std::memory_order_release);
+
+    		sequence.increment();
+    	}
+    };
+
+    }
+   }
+  }
+ }
+}
+
+using namespace server::zone::objects::scene::variables;
+
+#endif /* COLLISIONTRANSFORM_H_ */
@@ -127,7 +127,7 @@ public:
 		return obj;
 	}
 
-	E remove(int index, DeltaMessage* message = NULL, int updates = 1) {
+	virtual E remove(int index, DeltaMessage* message = NULL, int updates = 1) {
 		Locker locker(getLock());
 
 		E object = vector.remove(index);
@@ -143,7 +143,7 @@ public:
 		return object;
 	}
 
-	void removeAll(DeltaMessage* message = NULL) {
+	virtual void removeAll(DeltaMessage* message = NULL) {
 		Locker locker(getLock());
 
 		vector.removeAll();
@@ -0,0 +1,79 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#ifndef SLOTINDEX_H_
+#define SLOTINDEX_H_
+
+#include "engine/engine.h"
+
+/**
+ * Fixed indices for the slots looked up on hot paths. SceneObject mirrors
+ * the objects in these slots in a small array so getKnownSlottedObject
+ * doesn't have to build a String and binary search slottedObjects.
+ * The names must match entries in slot_definitions.iff.
+ */
+namespace server {
+ namespace zone {
+  namespace objects {
+   namespace scene {
+    namespace variables {
+
+    class SlotIndex {
+    public:
+    	const static int INVENTORY = 0;
+    	const static int GHOST = 1;
+    	const static int DATAPAD = 2;
+    	const static int RIDER = 3;
+    	const static int BANK = 4;
+    	const static int DEFAULT_WEAPON = 5;
+    	const static int HOLD_R = 6;
+    	const static int CRAFTED_COMPONENTS = 7;
+
+    	const static int SIZE = 8;
+
+    	static const char* getSlotName(int index) {
+    		switch (index) {
+    		case INVENTORY:
+    			return "inventory";
+    		case GHOST:
+    			return "ghost";
+    		case DATAPAD:
+    			return "datapad";
+    		case RIDER:
+    			return "rider";
+    		case BANK:
+    			return "bank";
+    		case DEFAULT_WEAPON:
+    			return "default_weapon";
+    		case HOLD_R:
+    			return "hold_r";
+    		case CRAFTED_COMPONENTS:
+    			return "crafted_components";
+    		default:
+    			return "";
+    		}
+    	}
+
+    	/**
+    	 * @return the known index of slot or -1 if it isn't one of them
+    	 */
+    	static int getIndex(const String& slot) {
+    		for (int i = 0; i < SIZE; ++i) {
+    			if (slot == getSlotName(i))
+    				return i;
+    		}
+
+    		return -1;
+    	}
+    };
+
+    }
+   }
+  }
+ }
+}
+
+using namespace server::zone::objects::scene::variables;
+
+#endif /* SLOTINDEX_H_ */
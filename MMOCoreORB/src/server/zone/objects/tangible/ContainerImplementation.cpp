@@ -185,8 +185,8 @@ int ContainerImplementation::canAddObject(SceneObject* object, int containmentTy
 			// It has room. Check if it's not equipped and on a player.
 			ManagedReference<WearableContainerObject*> wearable = cast<WearableContainerObject*>(wearableParent.get());
 			if (!wearable->isEquipped() && playerParent != NULL) {
-				SceneObject* inventory = playerParent->getSlottedObject("inventory");
-				SceneObject* bank = playerParent->getSlottedObject("bank");
+				SceneObject* inventory = playerParent->getKnownSlottedObject(SlotIndex::INVENTORY);
+				SceneObject* bank = playerParent->getKnownSlottedObject(SlotIndex::BANK);
 				SceneObject* parentOfWearableParent = wearable->getParent().get();
 
 				// Return if it's in a player inventory which doesn't have room
@@ -213,8 +213,8 @@ int ContainerImplementation::canAddObject(SceneObject* object, int containmentTy
 				if (pack != NULL && !pack->isEquipped()) {
 				// This is a wearable container, and it's not equipped.
 					if (playerParent != NULL ) {
-						SceneObject* inventory = playerParent->getSlottedObject("inventory");
-						SceneObject* bank = playerParent->getSlottedObject("bank");
+						SceneObject* inventory = playerParent->getKnownSlottedObject(SlotIndex::INVENTORY);
+						SceneObject* bank = playerParent->getKnownSlottedObject(SlotIndex::BANK);
 						SceneObject* thisParent = getParent().get();
 
 						// Return if the container is in a player inventory without room
@@ -237,8 +237,8 @@ int ContainerImplementation::canAddObject(SceneObject* object, int containmentTy
 			} else {
 				// This is a non-wearable container.
 				if (playerParent != NULL ) {
-					SceneObject* inventory = playerParent->getSlottedObject("inventory");
-					SceneObject* bank = playerParent->getSlottedObject("bank");
+					SceneObject* inventory = playerParent->getKnownSlottedObject(SlotIndex::INVENTORY);
+					SceneObject* bank = playerParent->getKnownSlottedObject(SlotIndex::BANK);
 					SceneObject* thisParent = getParent().get();
 
 					// Return if the container is in a player inventory without room
@@ -297,7 +297,7 @@ int ContainerImplementation::canAddObject(SceneObject* object, int containmentTy
 				AiAgent* ai = dynamic_cast<AiAgent*>(otherParent.get());
 
 				if (ai != NULL) {
-					SceneObject* creatureInventory = ai->getSlottedObject("inventory");
+					SceneObject* creatureInventory = ai->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 					if (creatureInventory != NULL) {
 						uint64 lootOwnerID = creatureInventory->getContainerPermissions()->getOwnerID();
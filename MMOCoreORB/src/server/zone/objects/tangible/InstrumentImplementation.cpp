@@ -104,14 +104,14 @@ int InstrumentImplementation::handleObjectMenuSelect(CreatureObject* player, byt
 			player->executeObjectControllerAction(STRING_HASHCODE("stopmusic"), getObjectID(), "");
 		} else {
 
-			Reference<Instrument*> instrument = player->getSlottedObject("hold_r").castTo<Instrument*>();
+			Reference<Instrument*> instrument = player->getKnownSlottedObject(SlotIndex::HOLD_R).castTo<Instrument*>();
 
 			if (instrument != NULL) {
 				player->sendSystemMessage("@performance:music_must_unequip");
 				return 1;
 			}
 
-			Reference<PlayerObject*> ghost = player->getSlottedObject("ghost").castTo<PlayerObject*>();
+			Reference<PlayerObject*> ghost = player->getKnownSlottedObject(SlotIndex::GHOST).castTo<PlayerObject*>();
 
 			if (ghost == NULL)
 				return 1;
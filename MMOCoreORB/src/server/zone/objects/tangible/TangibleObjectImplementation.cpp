@@ -788,7 +788,7 @@ bool TangibleObjectImplementation::canRepair(CreatureObject* player) {
 	if (player == NULL || !isASubChildOf(player))
 		return false;
 
-	SceneObject* inventory = player->getSlottedObject("inventory");
+	SceneObject* inventory = player->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 	if (inventory == NULL)
 		return false;
@@ -834,7 +834,7 @@ void TangibleObjectImplementation::repair(CreatureObject* player) {
 		return;
 	}
 
-	SceneObject* inventory = player->getSlottedObject("inventory");
+	SceneObject* inventory = player->getKnownSlottedObject(SlotIndex::INVENTORY);
 	if(inventory == NULL)
 		return;
 
@@ -38,7 +38,7 @@ void DroidComponentImplementation::fillAttributeList(AttributeListMessage* alm,
 		ComponentImplementation::fillAttributeList(alm,object);
 		// if this is a cluster module, add the cluter items
 		if (isSocketCluster()) {
-			ManagedReference<SceneObject*> craftingComponents = getSlottedObject("crafted_components");
+			ManagedReference<SceneObject*> craftingComponents = getKnownSlottedObject(SlotIndex::CRAFTED_COMPONENTS);
 			if(craftingComponents != NULL) {
 				SceneObject* satchel = craftingComponents->getContainerObject(0);
 				// remove all items form satchel and add int he new items
@@ -124,8 +124,8 @@ int LightsaberCrystalComponentImplementation::handleObjectMenuSelect(CreatureObj
 
 bool LightsaberCrystalComponentImplementation::hasPlayerAsParent(CreatureObject* player) {
 	ManagedReference<SceneObject*> wearableParent = getParentRecursively(SceneObjectType::WEARABLECONTAINER);
-	SceneObject* inventory = player->getSlottedObject("inventory");
-	SceneObject* bank = player->getSlottedObject("bank");
+	SceneObject* inventory = player->getKnownSlottedObject(SlotIndex::INVENTORY);
+	SceneObject* bank = player->getKnownSlottedObject(SlotIndex::BANK);
 
 	// Check if crystal is inside a wearable container in bank or inventory
 	if (wearableParent != NULL) {
@@ -239,7 +239,7 @@ int LightsaberCrystalComponentImplementation::inflictDamage(TangibleObject* atta
 
 				if (weapon->isEquipped()) {
 					ManagedReference<CreatureObject*> parent = cast<CreatureObject*>(weapon->getParent().get().get());
-					ManagedReference<SceneObject*> inventory = parent->getSlottedObject("inventory");
+					ManagedReference<SceneObject*> inventory = parent->getKnownSlottedObject(SlotIndex::INVENTORY);
 					inventory->transferObject(weapon, -1, true, true);
 					parent->sendSystemMessage("@jedi_spam:lightsaber_no_color"); //That lightsaber can not be used until it has a color-modifying Force crystal installed.
 				}
@@ -100,7 +100,7 @@ int BankTerminalMenuComponent::handleObjectMenuSelect(SceneObject* sceneObject,
 			// JOIN BANK
 			ghost->setBankLocation(playerZone->getZoneName());
 			//creature->transferObject(bank, 4);
-			SceneObject* bank = creature->getSlottedObject("bank");
+			SceneObject* bank = creature->getKnownSlottedObject(SlotIndex::BANK);
 			bank->sendTo(creature, true);
 			creature->sendSystemMessage("@system_msg:succesfully_joined_bank");
 		} else if (planet == playerZone->getZoneName()) {
@@ -114,7 +114,7 @@ int BankTerminalMenuComponent::handleObjectMenuSelect(SceneObject* sceneObject,
 		return 0;
 	} else if (selectedID == QUIT) {
 
-		SceneObject* bank = creature->getSlottedObject("bank");
+		SceneObject* bank = creature->getKnownSlottedObject(SlotIndex::BANK);
 
 		ZoneServer* server = creature->getZoneServer();
 
@@ -142,7 +142,7 @@ int BankTerminalMenuComponent::handleObjectMenuSelect(SceneObject* sceneObject,
 
 		if (planet == playerZone->getZoneName() || GLOBALSAFETYDEPOSIT) {
 
-			ManagedReference<SceneObject*> bank = creature->getSlottedObject("bank");
+			ManagedReference<SceneObject*> bank = creature->getKnownSlottedObject(SlotIndex::BANK);
 			bank->openContainerTo(creature);
 		} else {
 			creature->sendSystemMessage("@newbie_tutorial/system_messages:bank_info_2");
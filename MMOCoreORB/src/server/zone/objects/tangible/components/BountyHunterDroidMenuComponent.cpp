@@ -91,7 +91,7 @@ bool BountyHunterDroidMenuComponent::isSeekerDroid(SceneObject* droidObject) con
 }
 
 bool BountyHunterDroidMenuComponent::droidIsInPlayerInventory(SceneObject* droidObject, CreatureObject* player) const {
-	ManagedReference<SceneObject*> inventory = player->getSlottedObject("inventory");
+	ManagedReference<SceneObject*> inventory = player->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 	return droidObject->getParent() == inventory;
 }
@@ -87,7 +87,7 @@ int CampKitMenuComponent::handleObjectMenuSelect(SceneObject* sceneObject,
 
 
 		/// Get Ghost
-		Reference<PlayerObject*> ghost = player->getSlottedObject("ghost").castTo<PlayerObject*>();
+		Reference<PlayerObject*> ghost = player->getKnownSlottedObject(SlotIndex::GHOST).castTo<PlayerObject*>();
 		if (ghost == NULL) {
 			error("PlayerCreature has no ghost: " + String::valueOf(player->getObjectID()));
 			return 0;
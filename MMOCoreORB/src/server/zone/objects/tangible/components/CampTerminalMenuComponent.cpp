@@ -39,7 +39,7 @@ void CampTerminalMenuComponent::fillObjectMenuResponse(SceneObject* sceneObject,
 			menuResponse, player);
 
 	/// Get Ghost
-	Reference<PlayerObject*> ghost = player->getSlottedObject("ghost").castTo<PlayerObject*>();
+	Reference<PlayerObject*> ghost = player->getKnownSlottedObject(SlotIndex::GHOST).castTo<PlayerObject*>();
 	if (ghost == NULL) {
 		error("PlayerCreature has no ghost: " + String::valueOf(player->getObjectID()));
 		return;
@@ -263,7 +263,7 @@ void CampTerminalMenuComponent::showCampStatus(SceneObject* sceneObject,
 		return;
 	}
 	/// Get Ghost
-	Reference<PlayerObject*> ghost = player->getSlottedObject("ghost").castTo<PlayerObject*>();
+	Reference<PlayerObject*> ghost = player->getKnownSlottedObject(SlotIndex::GHOST).castTo<PlayerObject*>();
 	if (ghost == NULL) {
 		error("PlayerCreature has no ghost in CampTerminalMenuComponent::showCampStatus: " + String::valueOf(player->getObjectID()));
 		return;
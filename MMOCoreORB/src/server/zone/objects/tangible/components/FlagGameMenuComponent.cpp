@@ -141,7 +141,7 @@ int FlagGameMenuComponent::handleObjectMenuSelect(SceneObject* sceneObject, Crea
 		player->sendSystemMessage(params);
 		return 0;
 	} else if (selectedID == 128) {
-		ManagedReference<SceneObject*> inventory = player->getSlottedObject("inventory");
+		ManagedReference<SceneObject*> inventory = player->getKnownSlottedObject(SlotIndex::INVENTORY);
 		PlayerObject* ghost = player->getPlayerObject();
 
 		if (inventory == NULL || inventory->isContainerFullRecursive()) {
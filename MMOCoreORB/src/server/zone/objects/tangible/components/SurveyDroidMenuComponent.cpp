@@ -32,7 +32,7 @@ int SurveyDroidMenuComponent::handleObjectMenuSelect(SceneObject* droidObject, C
 
 	if (selectedID == 20) { // Use radial menu
 		// check for inventory
-		ManagedReference<SceneObject*> inventory = player->getSlottedObject("inventory");
+		ManagedReference<SceneObject*> inventory = player->getKnownSlottedObject(SlotIndex::INVENTORY);
 		if (inventory == NULL)
 			return 0;
 		PlayerObject* playerObject = player->getPlayerObject();
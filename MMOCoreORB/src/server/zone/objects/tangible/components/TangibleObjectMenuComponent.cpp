@@ -24,7 +24,7 @@ void TangibleObjectMenuComponent::fillObjectMenuResponse(SceneObject* sceneObjec
 	if(tano->isSliceable() && !tano->isSecurityTerminal()) { // Check to see if the player has the correct skill level
 
 		bool hasSkill = true;
-		ManagedReference<SceneObject*> inventory = player->getSlottedObject("inventory");
+		ManagedReference<SceneObject*> inventory = player->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 		if ((gameObjectType == SceneObjectType::PLAYERLOOTCRATE) && !player->hasSkill("combat_smuggler_novice"))
 			hasSkill = false;
@@ -43,7 +43,7 @@ void TangibleObjectMenuComponent::fillObjectMenuResponse(SceneObject* sceneObjec
 
 	if(player->getPlayerObject() != NULL && player->getPlayerObject()->isPrivileged()) {
 		/// Viewing components used to craft item, for admins
-		ManagedReference<SceneObject*> container = tano->getSlottedObject("crafted_components");
+		ManagedReference<SceneObject*> container = tano->getKnownSlottedObject(SlotIndex::CRAFTED_COMPONENTS);
 		if(container != NULL) {
 
 			if(container->getContainerObjectsSize() > 0) {
@@ -84,7 +84,7 @@ int TangibleObjectMenuComponent::handleObjectMenuSelect(SceneObject* sceneObject
 	} else if (selectedID == 79) { // See components (admin)
 		if(player->getPlayerObject() != NULL && player->getPlayerObject()->isPrivileged()) {
 
-			SceneObject* container = tano->getSlottedObject("crafted_components");
+			SceneObject* container = tano->getKnownSlottedObject(SlotIndex::CRAFTED_COMPONENTS);
 			if(container != NULL) {
 
 				if(container->getContainerObjectsSize() > 0) {
@@ -115,7 +115,7 @@ void DroidDataStorageModuleDataComponent::initialize(DroidObject* droid) {
 		return;
 	}
 
-	ManagedReference<SceneObject*> droidInvorty = droid->getSlottedObject("datapad");
+	ManagedReference<SceneObject*> droidInvorty = droid->getKnownSlottedObject(SlotIndex::DATAPAD);
 	if (droidInvorty) {
 		droid->removeObject(droidInvorty, NULL, true);
 		droidInvorty->destroyObjectFromDatabase(true);
@@ -140,7 +140,7 @@ int DroidDataStorageModuleDataComponent::handleObjectMenuSelect(CreatureObject*
 		Locker dlock (droid, player);
 
 		// open the inventory slot of the droid
-		ManagedReference<SceneObject*> inventory = droid->getSlottedObject("datapad");
+		ManagedReference<SceneObject*> inventory = droid->getKnownSlottedObject(SlotIndex::DATAPAD);
 
 		if (inventory != NULL) {
 			inventory->openContainerTo(player);
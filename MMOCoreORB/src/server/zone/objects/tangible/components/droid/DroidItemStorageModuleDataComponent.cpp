@@ -115,7 +115,7 @@ void DroidItemStorageModuleDataComponent::initialize(DroidObject* droid) {
 		return;
 	}
 
-	ManagedReference<SceneObject*> droidInvorty = droid->getSlottedObject("inventory");
+	ManagedReference<SceneObject*> droidInvorty = droid->getKnownSlottedObject(SlotIndex::INVENTORY);
 	if (droidInvorty) {
 		droid->removeObject(droidInvorty, NULL, true);
 		droidInvorty->destroyObjectFromDatabase(true);
@@ -139,7 +139,7 @@ int DroidItemStorageModuleDataComponent::handleObjectMenuSelect(CreatureObject*
 		Locker dlock(droid, player);
 
 		// open the inventory slot of the droid
-		ManagedReference<SceneObject*> inventory = droid->getSlottedObject("inventory");
+		ManagedReference<SceneObject*> inventory = droid->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 		if (inventory != NULL) {
 			inventory->openContainerTo(player);
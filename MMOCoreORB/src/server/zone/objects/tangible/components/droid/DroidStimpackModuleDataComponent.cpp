@@ -135,7 +135,7 @@ StimPack* DroidStimpackModuleDataComponent::compatibleStimpack(float power) {
 
 	Locker dlock(droid);
 
-	ManagedReference<SceneObject*> craftingComponents = droidComponent->getSlottedObject("crafted_components");
+	ManagedReference<SceneObject*> craftingComponents = droidComponent->getKnownSlottedObject(SlotIndex::CRAFTED_COMPONENTS);
 
 	if (craftingComponents != NULL) {
 		SceneObject* satchel = craftingComponents->getContainerObject(0);
@@ -177,7 +177,7 @@ void DroidStimpackModuleDataComponent::countUses() {
 
 	Locker dlock(droid);
 
-	ManagedReference<SceneObject*> craftingComponents = droidComponent->getSlottedObject("crafted_components");
+	ManagedReference<SceneObject*> craftingComponents = droidComponent->getKnownSlottedObject(SlotIndex::CRAFTED_COMPONENTS);
 	if (craftingComponents == NULL) {
 		return;
 	}
@@ -245,7 +245,7 @@ int DroidStimpackModuleDataComponent::handleObjectMenuSelect(CreatureObject* pla
 	if (selectedID == LOAD_STIMPACK) {
 		Locker crossLoker(droid, player);
 		
-		ManagedReference<SceneObject*> inventory = player->getSlottedObject("inventory");
+		ManagedReference<SceneObject*> inventory = player->getKnownSlottedObject(SlotIndex::INVENTORY);
 		if (inventory == NULL) {
 			player->sendSystemMessage("@pet/droid_modules:no_stimpacks");
 			return 0;
@@ -305,7 +305,7 @@ int DroidStimpackModuleDataComponent::handleObjectMenuSelect(CreatureObject* pla
 }
 
 void DroidStimpackModuleDataComponent::sendLoadUI(CreatureObject* player) {
-	ManagedReference<SceneObject* > inventory = player->getSlottedObject("inventory");
+	ManagedReference<SceneObject* > inventory = player->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 	if (inventory == NULL)
 		return;
@@ -356,7 +356,7 @@ StimPack* DroidStimpackModuleDataComponent::findStimPack() {
 	if (container == NULL)
 		return NULL;
 
-	ManagedReference<SceneObject*> craftingComponents = container->getSlottedObject("crafted_components");
+	ManagedReference<SceneObject*> craftingComponents = container->getKnownSlottedObject(SlotIndex::CRAFTED_COMPONENTS);
 
 	if (craftingComponents != NULL) {
 		SceneObject* satchel = craftingComponents->getContainerObject(0);
@@ -420,7 +420,7 @@ void DroidStimpackModuleDataComponent::handleInsertStimpack(CreatureObject* play
 		return;
 	}
 
-	ManagedReference<SceneObject*> craftingComponents = droidComponent->getSlottedObject("crafted_components");
+	ManagedReference<SceneObject*> craftingComponents = droidComponent->getKnownSlottedObject(SlotIndex::CRAFTED_COMPONENTS);
 
 	if (craftingComponents == NULL) {
 		return;
@@ -37,7 +37,7 @@ int ArtCrateMenuComponent::handleObjectMenuSelect(SceneObject* sceneObject, Crea
 		if (lootManager == NULL)
 			return 0;
 
-		ManagedReference<SceneObject*> inventory = player->getSlottedObject("inventory");
+		ManagedReference<SceneObject*> inventory = player->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 		lootManager->createLoot(inventory, "death_watch_bunker_art", 1);
 
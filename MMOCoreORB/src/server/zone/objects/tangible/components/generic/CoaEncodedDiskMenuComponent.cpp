@@ -34,7 +34,7 @@ int CoaEncodedDiskMenuComponent::handleObjectMenuSelect(SceneObject* sceneObject
 		return 0;
 	}
 
-	SceneObject* inventory = player->getSlottedObject("inventory");
+	SceneObject* inventory = player->getKnownSlottedObject(SlotIndex::INVENTORY);
 	if (inventory == NULL) {
 		return 0;
 	}
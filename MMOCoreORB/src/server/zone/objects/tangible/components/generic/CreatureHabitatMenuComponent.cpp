@@ -52,7 +52,7 @@ void CreatureHabitatMenuComponent::fillObjectMenuResponse(SceneObject* sceneObje
 
 ManagedReference<TangibleObject*> CreatureHabitatMenuComponent::getLiveCreatures(TangibleObject* creatureHabitat) const {
 
-	ManagedReference<SceneObject*> craftedContainer = creatureHabitat->getSlottedObject("crafted_components");
+	ManagedReference<SceneObject*> craftedContainer = creatureHabitat->getKnownSlottedObject(SlotIndex::CRAFTED_COMPONENTS);
 	if(craftedContainer == NULL || craftedContainer->getContainerObjectsSize() == 0)
 		return NULL;
 
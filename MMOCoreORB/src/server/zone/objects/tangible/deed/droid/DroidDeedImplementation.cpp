@@ -216,7 +216,7 @@ void DroidDeedImplementation::updateCraftingValues(CraftingValues* values, bool
 			if (component != NULL) {
 				if (component->isSocketCluster()) {
 					// pull out the objects
-					ManagedReference<SceneObject*> craftingComponents = component->getSlottedObject("crafted_components");
+					ManagedReference<SceneObject*> craftingComponents = component->getKnownSlottedObject(SlotIndex::CRAFTED_COMPONENTS);
 					if(craftingComponents != NULL) {
 						SceneObject* satchel = craftingComponents->getContainerObject(0);
 						for (int i = 0; i < satchel->getContainerObjectsSize(); ++i) {
@@ -273,7 +273,7 @@ int DroidDeedImplementation::handleObjectMenuSelect(CreatureObject* player, byte
 			return 1;
 		}
 
-		ManagedReference<SceneObject*> datapad = player->getSlottedObject("datapad");
+		ManagedReference<SceneObject*> datapad = player->getKnownSlottedObject(SlotIndex::DATAPAD);
 
 		if (datapad == NULL) {
 			player->sendSystemMessage("Datapad doesn't exist when trying to generate droid");
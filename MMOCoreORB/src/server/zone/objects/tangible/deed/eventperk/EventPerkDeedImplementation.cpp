@@ -120,7 +120,7 @@ int EventPerkDeedImplementation::handleObjectMenuSelect(CreatureObject* player,
 		int nearbyPerks = 0;
 
 		TerrainManager* terrainManager = planetManager->getTerrainManager();
-		if ( terrainManager == NULL || terrainManager->getHighestHeightDifference(x - 10, y - 10, x + 10, y + 10) > 15.0) {
+		if ( terrainManager == NULL || !terrainManager->isHeightDifferenceWithin(x - 10, y - 10, x + 10, y + 10, 15.0)) {
 			player->sendSystemMessage("@event_perk:bad_area"); // This rental could not be deployed due to the surrounding terrain. Please move to another area and try again.
 			return 1;
 		}
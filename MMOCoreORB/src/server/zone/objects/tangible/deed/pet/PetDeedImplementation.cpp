@@ -349,7 +349,7 @@ int PetDeedImplementation::handleObjectMenuSelect(CreatureObject* player, byte s
 			return 1;
 		}
 
-		ManagedReference<SceneObject*> datapad = player->getSlottedObject("datapad");
+		ManagedReference<SceneObject*> datapad = player->getKnownSlottedObject(SlotIndex::DATAPAD);
 
 		if (datapad == NULL) {
 			player->sendSystemMessage("Datapad doesn't exist when trying to call pet");
@@ -65,7 +65,7 @@ int VehicleDeedImplementation::handleObjectMenuSelect(CreatureObject* player, by
 			return 1;
 		}
 
-		ManagedReference<SceneObject*> datapad = player->getSlottedObject("datapad");
+		ManagedReference<SceneObject*> datapad = player->getKnownSlottedObject(SlotIndex::DATAPAD);
 
 		if (datapad == NULL) {
 			player->sendSystemMessage("Datapad doesn't exist when trying to create vehicle");
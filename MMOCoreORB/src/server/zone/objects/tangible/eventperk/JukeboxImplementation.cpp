@@ -103,7 +103,7 @@ int JukeboxImplementation::handleObjectMenuSelect(CreatureObject* player, byte s
 			} else {
 				stopPlaying();
 
-				ManagedReference<SceneObject*> inventory = player->getSlottedObject("inventory");
+				ManagedReference<SceneObject*> inventory = player->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 				if (inventory == NULL)
 					return 0;
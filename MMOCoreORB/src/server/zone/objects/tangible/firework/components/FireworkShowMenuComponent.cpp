@@ -129,7 +129,7 @@ void FireworkShowMenuComponent::addEvent(CreatureObject* player, FireworkObject*
 	suiBox->setCancelButton(true, "@cancel");
 	suiBox->setUsingObject(fireworkShow);
 
-	ManagedReference<SceneObject*> inventory = player->getSlottedObject("inventory");
+	ManagedReference<SceneObject*> inventory = player->getKnownSlottedObject(SlotIndex::INVENTORY);
 	SceneObject* sceneObject = NULL;
 
 	for (int i = 0; i < inventory->getContainerObjectsSize(); i++) {
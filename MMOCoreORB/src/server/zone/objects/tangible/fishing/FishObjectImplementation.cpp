@@ -36,7 +36,7 @@ void FishObjectImplementation::fillObjectMenuResponse(ObjectMenuResponse* menuRe
 
 void FishObjectImplementation::filet(CreatureObject* player) {
 	if (getContainerObjectsSize() > 0) {
-		ManagedReference<SceneObject*> inventory = player->getSlottedObject("inventory");
+		ManagedReference<SceneObject*> inventory = player->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 		if ((inventory->isContainerFullRecursive()) || ((inventory->getCountableObjectsRecursive() + getContainerObjectsSize()) > 80)) {
 			StringIdChatParameter body("fishing","units_inventory");
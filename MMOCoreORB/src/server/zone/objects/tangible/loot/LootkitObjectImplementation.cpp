@@ -105,7 +105,7 @@ void LootkitObjectImplementation::createItem() {
 	ManagedReference<CreatureObject*>  player = getPlayer();
 	if (player != NULL) {
 
-		ManagedReference<SceneObject*> inventory = player->getSlottedObject("inventory");
+		ManagedReference<SceneObject*> inventory = player->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 		if (inventory == NULL) {
 			return;
@@ -139,7 +139,7 @@ int LootkitObjectImplementation::canAddObject(SceneObject* object, int containme
 	ManagedReference<CreatureObject*>  player = getPlayer();
 	if (components.contains(object->getServerObjectCRC())) {
 		if (!components.get(object->getServerObjectCRC()) && player != NULL) {
-			ManagedReference<SceneObject*> inventory = player->getSlottedObject("inventory");
+			ManagedReference<SceneObject*> inventory = player->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 			if (inventory->isContainerFullRecursive()) {
 				errorDescription = "@error_message:inv_full";
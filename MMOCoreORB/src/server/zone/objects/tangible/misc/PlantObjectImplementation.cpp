@@ -69,7 +69,7 @@ int PlantObjectImplementation::handleObjectMenuSelect(CreatureObject* player, by
 		if (fruitCount < 1)
 			return 0;
 
-		ManagedReference<SceneObject*> inventory = player->getSlottedObject("inventory");
+		ManagedReference<SceneObject*> inventory = player->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 		if(inventory->isContainerFullRecursive()){
 			player->sendSystemMessage("@plant_grow:no_inventory"); // You do not have any inventory space.
@@ -162,7 +162,7 @@ void PlantObjectImplementation::sendResourceSUI(CreatureObject* player, int type
 	suiBox->setUsingObject(_this.getReferenceUnsafeStaticCast());
 	suiBox->setForceCloseDistance(32.f);
 
-	ManagedReference<SceneObject*> inventory = player->getSlottedObject("inventory");
+	ManagedReference<SceneObject*> inventory = player->getKnownSlottedObject(SlotIndex::INVENTORY);
 	ManagedReference<SceneObject*> sceneObject = NULL;
 
 	for (int i=0; i< inventory->getContainerObjectsSize(); i++) {
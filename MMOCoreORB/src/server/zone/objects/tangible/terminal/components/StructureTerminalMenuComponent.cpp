@@ -75,7 +75,7 @@ void StructureTerminalMenuComponent::fillObjectMenuResponse(SceneObject* sceneOb
 
 		menuResponse->addRadialMenuItemToRadialID(118, 50, 3, "@player_structure:management_name_structure"); //Name Structure
 
-		ManagedReference<SceneObject*> datapad = creature->getSlottedObject("datapad");
+		ManagedReference<SceneObject*> datapad = creature->getKnownSlottedObject(SlotIndex::DATAPAD);
 		if(datapad != NULL) {
 			for (int i = 0; i < datapad->getContainerObjectsSize(); ++i) {
 				ManagedReference<SceneObject*> object = datapad->getContainerObject(i);
@@ -73,7 +73,7 @@ int CraftingToolImplementation::handleObjectMenuSelect(
 				return 0;
 
 			ManagedReference<TangibleObject *> prototype = getPrototype();
-			ManagedReference<SceneObject*> inventory = playerCreature->getSlottedObject("inventory");
+			ManagedReference<SceneObject*> inventory = playerCreature->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 			if (prototype == NULL) {
 				while (getContainerObjectsSize() > 0) {
@@ -151,7 +151,7 @@ void CraftingToolImplementation::disperseItems() {
 
 	Locker locker(_this.getReferenceUnsafeStaticCast());
 
-	ManagedReference<SceneObject*> craftedComponents = getSlottedObject("crafted_components");
+	ManagedReference<SceneObject*> craftedComponents = getKnownSlottedObject(SlotIndex::CRAFTED_COMPONENTS);
 	ManagedReference<SceneObject*> prototype = NULL;
 
 	if(getContainerObjectsSize() > 0)
@@ -162,7 +162,7 @@ void CraftingToolImplementation::disperseItems() {
 		if(prototype == NULL)
 			return;
 
-		craftedComponents = prototype->getSlottedObject("crafted_components");
+		craftedComponents = prototype->getKnownSlottedObject(SlotIndex::CRAFTED_COMPONENTS);
 	}
 
 	if(craftedComponents != NULL  && craftedComponents->getContainerObjectsSize() > 0) {
@@ -41,7 +41,7 @@ int AntiDecayKitImplementation::handleObjectMenuSelect(CreatureObject* player, b
 
 void AntiDecayKitImplementation::doApplyAntiDecay(CreatureObject* player)
 {
-	ManagedReference<SceneObject*> inventory = player->getSlottedObject("inventory");
+	ManagedReference<SceneObject*> inventory = player->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 	if(inventory == NULL || getContainerObjectsSize() < 1)
 		return;
@@ -77,7 +77,7 @@ void AntiDecayKitImplementation::doApplyAntiDecay(CreatureObject* player)
 
 void AntiDecayKitImplementation::doRetrieveItem(CreatureObject* player)
 {
-	ManagedReference<SceneObject*> inventory = player->getSlottedObject("inventory");
+	ManagedReference<SceneObject*> inventory = player->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 	if(inventory == NULL || getContainerObjectsSize() < 1)
 		return;
@@ -109,7 +109,7 @@ int AntiDecayKitImplementation::canAddObject(SceneObject* object, int containmen
 		return TransferErrorCode::MUSTBEINPLAYERINVENTORY;
 	}
 
-	SceneObject* inventory = parent->getSlottedObject("inventory");
+	SceneObject* inventory = parent->getKnownSlottedObject(SlotIndex::INVENTORY);
 	if (inventory == NULL || !inventory->hasObjectInContainer(getObjectID())){
 		errorDescription = "@veteran_new:error_kit_not_in_player_inventory"; // This Anti Decay Kit can only be used when it is in your inventory.
 		return TransferErrorCode::MUSTBEINPLAYERINVENTORY;
@@ -137,7 +137,7 @@ int AntiDecayKitImplementation::canAddObject(SceneObject* object, int containmen
 		return TransferErrorCode::INVALIDTYPE;
 	}
 
-	if (parent->getSlottedObject("inventory")->isContainerFullRecursive()) {
+	if (parent->getKnownSlottedObject(SlotIndex::INVENTORY)->isContainerFullRecursive()) {
 		errorDescription = "@error_message:inv_full"; // Your inventory is full.
 		return TransferErrorCode::CONTAINERFULL;
 	}
@@ -43,7 +43,7 @@ public:
 
 		Locker locker(player);
 
-		inventory = player->getSlottedObject("inventory");
+		inventory = player->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 		if (inventory == NULL) {
 			return;
@@ -38,9 +38,9 @@ public:
 		if (parent == NULL)
 			return TransferErrorCode::MUSTBEINPLAYERINVENTORY;
 
-		int containerObjects = parent->getSlottedObject("inventory")->getContainerObjectsSize();
+		int containerObjects = parent->getKnownSlottedObject(SlotIndex::INVENTORY)->getContainerObjectsSize();
 
-		if (containerObjects >= parent->getSlottedObject("inventory")->getContainerVolumeLimit()) {
+		if (containerObjects >= parent->getKnownSlottedObject(SlotIndex::INVENTORY)->getContainerVolumeLimit()) {
 			errorDescription = "@error_message:inv_full"; // Your inventory is full.
 
 			return TransferErrorCode::CONTAINERFULL;
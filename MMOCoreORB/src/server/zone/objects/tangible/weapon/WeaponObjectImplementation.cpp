@@ -729,7 +729,7 @@ String WeaponObjectImplementation::repairAttempt(int repairChance) {
 }
 
 void WeaponObjectImplementation::decay(CreatureObject* user) {
-	if (_this.getReferenceUnsafeStaticCast() == user->getSlottedObject("default_weapon") || user->isAiAgent() || hasAntiDecayKit()) {
+	if (_this.getReferenceUnsafeStaticCast() == user->getKnownSlottedObject(SlotIndex::DEFAULT_WEAPON) || user->isAiAgent() || hasAntiDecayKit()) {
 		return;
 	}
 
@@ -0,0 +1,70 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#ifndef BROADCASTPACKET_H_
+#define BROADCASTPACKET_H_
+
+#include "engine/engine.h"
+
+#include "SharedPacket.h"
+
+/**
+ * Fans packets out to many recipients. Recipients are handed the shared
+ * packets through sendSharedMessage and only those with a client session
+ * copy them, every other recipient drops them without a copy. The original
+ * packets go to the last recipient instead of being copied and deleted.
+ */
+template<class R>
+class BroadcastPacket {
+	Vector<Reference<SharedPacket*> > packets;
+	R pending;
+
+public:
+	BroadcastPacket(BasePacket* pack) : pending(NULL) {
+		if (pack != NULL)
+			packets.add(new SharedPacket(pack));
+	}
+
+	/**
+	 * Takes over the packets in messages, they are sent in order
+	 */
+	BroadcastPacket(Vector<BasePacket*>* messages) : pending(NULL) {
+		while (!messages->isEmpty())
+			packets.add(new SharedPacket(messages->remove(0)));
+	}
+
+	~BroadcastPacket() {
+		flush();
+	}
+
+	/**
+	 * Queues recipient, the previously queued one gets the packets now
+	 */
+	void sendTo(R recipient) {
+		if (packets.isEmpty())
+			return;
+
+		if (pending != NULL) {
+			for (int i = 0; i < packets.size(); ++i)
+				pending->sendSharedMessage(packets.get(i));
+		}
+
+		pending = recipient;
+	}
+
+	/**
+	 * Hands the original packets to the last recipient, they are released with the shared ones if nobody was in range
+	 */
+	void flush() {
+		for (int i = 0; i < packets.size(); ++i) {
+			if (pending != NULL)
+				pending->sendMessage(packets.get(i)->takePacket());
+		}
+
+		packets.removeAll();
+		pending = NULL;
+	}
+};
+
+#endif /* BROADCASTPACKET_H_ */
@@ -0,0 +1,50 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#ifndef SHAREDPACKET_H_
+#define SHAREDPACKET_H_
+
+#include "engine/engine.h"
+
+/**
+ * Finished packet body shared by every recipient of a broadcast. It is never
+ * written to once it is shared; the client proxy writes sequence numbers and
+ * encrypts into the buffer it sends, so a session takes its own framed copy
+ * only when it actually sends the packet. Recipients that turn out to have no
+ * session don't copy anything.
+ */
+class SharedPacket : public Object {
+	BasePacket* packet;
+
+public:
+	SharedPacket(BasePacket* pack) : packet(pack) {
+	}
+
+	~SharedPacket() {
+		delete packet;
+	}
+
+	/**
+	 * @return copy of the packet for one session to frame and send
+	 */
+	BasePacket* createPacket() {
+		return packet->clone();
+	}
+
+	/**
+	 * Takes the packet itself out, for the last recipient once nobody else is sending it
+	 */
+	BasePacket* takePacket() {
+		BasePacket* pack = packet;
+		packet = NULL;
+
+		return pack;
+	}
+
+	inline int getSize() {
+		return packet == NULL ? 0 : packet->size();
+	}
+};
+
+#endif /* SHAREDPACKET_H_ */
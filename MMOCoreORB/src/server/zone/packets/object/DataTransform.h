@@ -14,6 +14,7 @@
 #include "server/zone/managers/collision/CollisionManager.h"
 #include "server/zone/managers/collision/IntersectionResults.h"
 #include "server/zone/Zone.h"
+#include "server/zone/managers/player/MovementQueueManager.h"
 
 class DataTransform : public ObjectControllerMessage {
 public:
@@ -45,8 +46,10 @@ class DataTransformCallback : public MessageCallback {
 	float parsedSpeed;
 
 	ObjectControllerMessageCallback* objectControllerMain;
+
+	// index of taskqueue in the MovementQueueManager, released with it
+	int movementQueueIndex;
 	
-//	taskqueue = 3;
 public:
 	DataTransformCallback(ObjectControllerMessageCallback* objectControllerCallback) :
 		MessageCallback(objectControllerCallback->getClient(), objectControllerCallback->getServer()) {
@@ -62,25 +65,20 @@ public:
 		parsedSpeed = 0;
 
 		objectControllerMain = objectControllerCallback;
-		
-		taskqueue = 3;
-		
+
 		ManagedReference<CreatureObject*> player = client->getPlayer();
-		
-		if (player != NULL) {
-			Zone* zone = player->getLocalZone();
-			
-			if (zone != NULL) {
-				String zoneName = zone->getZoneName();
-			
-				if (zoneName == "corellia")
-					taskqueue = 4;
-				else if (zoneName == "tatooine")
-					taskqueue = 5;
-				else if (zoneName == "naboo")
-					taskqueue = 6;
-			}
-		}
+
+		Zone* zone = player != NULL ? player->getZone() : NULL;
+		float x = player != NULL ? player->getWorldPositionX() : 0;
+
+		MovementQueueManager* queueManager = MovementQueueManager::instance();
+
+		movementQueueIndex = queueManager->acquireTaskQueue(client, zone, x);
+		taskqueue = queueManager->getTaskQueue(movementQueueIndex);
+	}
+
+	~DataTransformCallback() {
+		MovementQueueManager::instance()->releaseTaskQueue(client, movementQueueIndex);
 	}
 
 	void parse(Message* message) {
@@ -189,7 +187,7 @@ public:
 
 		IntersectionResults intersections;
 
-		CollisionManager::getWorldFloorCollisions(positionX, positionY, object->getZone(), &intersections, (CloseObjectsVector*) object->getCloseObjects());
+		CollisionManager::getWorldFloorCollisions(positionX, positionY, object->getZone(), &intersections);
 
 		float z = planetManager->findClosestWorldFloor(positionX, positionY, positionZ, object->getSwimHeight(), &intersections, (CloseObjectsVector*) object->getCloseObjects());
 
@@ -201,7 +199,7 @@ public:
 		pos.update(object);
 
 		if (!ghost->hasGodMode()) {
-			SceneObject* inventory = object->getSlottedObject("inventory");
+			SceneObject* inventory = object->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 			if (inventory != NULL && inventory->getCountableObjectsRecursive() > inventory->getContainerVolumeLimit() + 1) {
 				object->sendSystemMessage("Inventory Overloaded - Cannot Move");
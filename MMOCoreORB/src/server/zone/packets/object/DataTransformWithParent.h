@@ -16,6 +16,7 @@
 #include "server/zone/objects/player/PlayerObject.h"
 #include "server/zone/objects/cell/CellObject.h"
 #include "server/zone/Zone.h"
+#include "server/zone/managers/player/MovementQueueManager.h"
 
 class DataTransformWithParent : public ObjectControllerMessage {
 public:
@@ -51,7 +52,9 @@ class DataTransformWithParentCallback : public MessageCallback {
 
 	ObjectControllerMessageCallback* objectControllerMain;
 
-	//	taskqueue = 3;
+	// index of taskqueue in the MovementQueueManager, released with it
+	int movementQueueIndex;
+
 public:
 	DataTransformWithParentCallback(ObjectControllerMessageCallback* objectControllerCallback) :
 		MessageCallback(objectControllerCallback->getClient(), objectControllerCallback->getServer()) {
@@ -69,25 +72,19 @@ public:
 
 		objectControllerMain = objectControllerCallback;
 
-
-		taskqueue = 3;
-
 		ManagedReference<CreatureObject*> player = client->getPlayer();
 
-		if (player != NULL) {
-			Zone* zone = player->getLocalZone();
+		Zone* zone = player != NULL ? player->getZone() : NULL;
+		float x = player != NULL ? player->getWorldPositionX() : 0;
 
-			if (zone != NULL) {
-				String zoneName = zone->getZoneName();
+		MovementQueueManager* queueManager = MovementQueueManager::instance();
 
-				if (zoneName == "corellia")
-					taskqueue = 4;
-				else if (zoneName == "tatooine")
-					taskqueue = 5;
-				else if (zoneName == "naboo")
-					taskqueue = 6;
-			}
-		}
+		movementQueueIndex = queueManager->acquireTaskQueue(client, zone, x);
+		taskqueue = queueManager->getTaskQueue(movementQueueIndex);
+	}
+
+	~DataTransformWithParentCallback() {
+		MovementQueueManager::instance()->releaseTaskQueue(client, movementQueueIndex);
 	}
 
 	void parse(Message* message) {
@@ -239,7 +236,7 @@ public:
 		pos.update(object);
 
 		if (!ghost->hasGodMode()) {
-			SceneObject* inventory = object->getSlottedObject("inventory");
+			SceneObject* inventory = object->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 			if (inventory != NULL && inventory->getCountableObjectsRecursive() > inventory->getContainerVolumeLimit() + 1) {
 				object->sendSystemMessage("Inventory Overloaded - Cannot Move");
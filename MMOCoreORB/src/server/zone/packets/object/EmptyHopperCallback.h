@@ -76,7 +76,7 @@ public:
 				return;
 			}
 
-			SceneObject* inventory = player->getSlottedObject("inventory");
+			SceneObject* inventory = player->getKnownSlottedObject(SlotIndex::INVENTORY);
 
 			ManagedReference<ResourceSpawn*> resourceSpawn = server->getZoneServer()->getObject(resourceId).castTo<ResourceSpawn*>();
 
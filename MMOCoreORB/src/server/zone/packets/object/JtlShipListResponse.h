@@ -25,7 +25,7 @@ public:
 		insertInt(0); // size
 
 
-		SceneObject* datapad = creo->getSlottedObject("datapad");
+		SceneObject* datapad = creo->getKnownSlottedObject(SlotIndex::DATAPAD);
 
 		//int offs = getOffset();
 
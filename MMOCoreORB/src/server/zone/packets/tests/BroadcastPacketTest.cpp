@@ -0,0 +1,185 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#include "gtest/gtest.h"
+
+#include "server/zone/packets/BroadcastPacket.h"
+
+/**
+ * Recipient that keeps what it is sent if it has a session, the way CreatureObject does
+ */
+class TestRecipient {
+public:
+	bool hasSession;
+	Vector<BasePacket*> received;
+	int bytesCopied;
+
+	TestRecipient(bool session) : hasSession(session), bytesCopied(0) {
+	}
+
+	~TestRecipient() {
+		for (int i = 0; i < received.size(); ++i)
+			delete received.get(i);
+	}
+
+	void sendMessage(BasePacket* msg) {
+		if (hasSession)
+			received.add(msg);
+		else
+			delete msg;
+	}
+
+	void sendSharedMessage(SharedPacket* packet) {
+		if (!hasSession)
+			return;
+
+		bytesCopied += packet->getSize();
+		received.add(packet->createPacket());
+	}
+};
+
+class CountedPacket : public BasePacket {
+	AtomicInteger* deleted;
+
+public:
+	CountedPacket(AtomicInteger* counter, int value) : deleted(counter) {
+		insertInt(value);
+	}
+
+	~CountedPacket() {
+		deleted->increment();
+	}
+};
+
+class BroadcastPacketTest : public ::testing::Test {
+public:
+	AtomicInteger deleted;
+	Vector<TestRecipient*> recipients;
+
+	void TearDown() {
+		for (int i = 0; i < recipients.size(); ++i)
+			delete recipients.get(i);
+
+		recipients.removeAll();
+	}
+
+	TestRecipient* addRecipient(bool hasSession) {
+		TestRecipient* recipient = new TestRecipient(hasSession);
+		recipients.add(recipient);
+
+		return recipient;
+	}
+};
+
+TEST_F(BroadcastPacketTest, RecipientsWithoutSessionCopyNothing) {
+	BasePacket* packet = new CountedPacket(&deleted, 7);
+
+	TestRecipient* first = addRecipient(false);
+	TestRecipient* second = addRecipient(false);
+	TestRecipient* last = addRecipient(true);
+
+	{
+		BroadcastPacket<TestRecipient*> broadcast(packet);
+
+		for (int i = 0; i < recipients.size(); ++i)
+			broadcast.sendTo(recipients.get(i));
+	}
+
+	EXPECT_EQ(0, first->received.size() + second->received.size());
+	EXPECT_EQ(0, first->bytesCopied + second->bytesCopied);
+
+	// the last one gets the original
+	ASSERT_EQ(1, last->received.size());
+	EXPECT_EQ(packet, last->received.get(0));
+	EXPECT_EQ(0, deleted.get());
+}
+
+TEST_F(BroadcastPacketTest, RecipientsGetPacketsInOrder) {
+	Vector<BasePacket*> messages;
+
+	for (int i = 0; i < 3; ++i)
+		messages.add(new CountedPacket(&deleted, i));
+
+	BasePacket* firstMessage = messages.get(0);
+
+	for (int i = 0; i < 4; ++i)
+		addRecipient(true);
+
+	BroadcastPacket<TestRecipient*> broadcast(&messages);
+	EXPECT_EQ(0, messages.size());
+
+	for (int i = 0; i < recipients.size(); ++i)
+		broadcast.sendTo(recipients.get(i));
+
+	broadcast.flush();
+
+	for (int i = 0; i < recipients.size(); ++i) {
+		TestRecipient* recipient = recipients.get(i);
+
+		ASSERT_EQ(3, recipient->received.size());
+
+		for (int j = 0; j < 3; ++j)
+			EXPECT_EQ(j, recipient->received.get(j)->parseInt(0));
+
+		// copies are the session's own to write into
+		if (i < recipients.size() - 1)
+			EXPECT_NE(firstMessage, recipient->received.get(0));
+	}
+
+	EXPECT_EQ(firstMessage, recipients.get(recipients.size() - 1)->received.get(0));
+	EXPECT_EQ(0, deleted.get());
+}
+
+TEST_F(BroadcastPacketTest, PacketsReleasedWithoutRecipients) {
+	{
+		BroadcastPacket<TestRecipient*> broadcast(new CountedPacket(&deleted, 1));
+	}
+
+	EXPECT_EQ(1, deleted.get());
+
+	TestRecipient* recipient = addRecipient(false);
+
+	{
+		BroadcastPacket<TestRecipient*> broadcast(new CountedPacket(&deleted, 2));
+		broadcast.sendTo(recipient);
+	}
+
+	EXPECT_EQ(2, deleted.get());
+	EXPECT_EQ(0, recipient->received.size());
+}
+
+TEST_F(BroadcastPacketTest, CrowdCopiesOnlyForSessions) {
+	const int crowd = 200;
+
+	BasePacket* packet = new CountedPacket(&deleted, 1);
+	int packetSize = packet->size();
+
+	// a crowd of creatures, vehicles and players, every fourth one has a client
+	for (int i = 0; i < crowd; ++i)
+		addRecipient(i % 4 == 0);
+
+	{
+		BroadcastPacket<TestRecipient*> broadcast(packet);
+
+		for (int i = 0; i < recipients.size(); ++i)
+			broadcast.sendTo(recipients.get(i));
+	}
+
+	int bytesCopied = 0;
+	int copies = 0;
+
+	for (int i = 0; i < recipients.size(); ++i) {
+		bytesCopied += recipients.get(i)->bytesCopied;
+		copies += recipients.get(i)->received.size();
+	}
+
+	// the original went to the last recipient, which has no session
+	EXPECT_EQ(crowd / 4, copies);
+	EXPECT_EQ(1, deleted.get());
+	EXPECT_EQ(copies * packetSize, bytesCopied);
+
+	RecordProperty("clone_copies", crowd - 1);
+	RecordProperty("shared_copies", copies);
+	RecordProperty("shared_bytes_copied", bytesCopied);
+}
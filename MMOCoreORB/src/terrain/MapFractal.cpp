@@ -32,6 +32,8 @@ MapFractal::MapFractal() {
 
 	unkown = false;
 
+	updateExponents();
+
 	setSeed(0);
 }
 
@@ -61,7 +63,7 @@ float MapFractal::getNoise(float x, float y, int i, int j) {
 	}
 
 	if (bias) {
-		result = pow(result, log(biasValue) / log05);
+		result = pow(result, biasExponent);
 	}
 
 	if (gainType) {
@@ -77,7 +79,7 @@ float MapFractal::getNoise(float x, float y, int i, int j) {
 			return result;
 		}
 
-		double v40 = log(1.0 - gainValue) / log05;
+		double v40 = gainExponent;
 
 		if (result < 0.5) {
 			result = pow(result * 2, v40) * 0.5;
@@ -99,7 +101,7 @@ float MapFractal::getNoise(float x, int i, int j) {
 	result = calculateCombination1(v39);
 
 	if (bias) {
-		result = pow(result, log(biasValue) / log05);
+		result = pow(result, biasExponent);
 	}
 
 	if (gainType) {
@@ -115,7 +117,7 @@ float MapFractal::getNoise(float x, int i, int j) {
 			return result;
 		}
 
-		double v40 = log(1.0 - gainValue) / log05;
+		double v40 = gainExponent;
 
 		if (result < 0.5) {
 			result = pow(result * 2, v40) * 0.5;
@@ -129,6 +131,145 @@ float MapFractal::getNoise(float x, int i, int j) {
 	return result;
 }
 
+void MapFractal::getNoise(const float* x, const float* y, float* results, int count, bool approximateCurves) {
+	double coordX[BATCHSIZE], coordY[BATCHSIZE];
+	float octave[BATCHSIZE], sum[BATCHSIZE];
+
+	for (int offset = 0; offset < count; offset += BATCHSIZE) {
+		int size = MIN(BATCHSIZE, count - offset);
+
+		const float* batchX = x + offset;
+		const float* batchY = y + offset;
+
+		for (int i = 0; i < size; ++i)
+			sum[i] = 0;
+
+		float v48 = 1.0;
+		float v47 = 1.0;
+
+		// same float and double steps as calculateCombination so the noise matches
+		for (int j = 0; j < octaves; ++j) {
+			for (int i = 0; i < size; ++i) {
+				float v39 = batchX[i] * xFrequency;
+				float v41 = batchY[i] * yFrequency;
+
+				float v36 = v39 + xOffset;
+				float v42 = v41 + zOffset;
+
+				coordX[i] = v36 * v48;
+				coordY[i] = v42 * v48;
+			}
+
+			noise->noise2(coordX, coordY, octave, size);
+
+			for (int i = 0; i < size; ++i) {
+				float value = octave[i];
+
+				switch (combination) {
+				case 2:
+					sum[i] = (1.0 - fabs(value)) * v47 + sum[i];
+					break;
+				case 3:
+					sum[i] = fabs(value) * v47 + sum[i];
+					break;
+				case 4:
+					sum[i] = (1.0 - MIN(MAX(value, 0.f), 1.f)) * v47 + sum[i];
+					break;
+				case 5:
+					sum[i] = MIN(MAX(value, 0.f), 1.f) * v47 + sum[i];
+					break;
+				default:
+					sum[i] = value * v47 + sum[i];
+					break;
+				}
+			}
+
+			v48 = v48 * octavesParam;
+			v47 = v47 * amplitude;
+		}
+
+		for (int i = 0; i < size; ++i) {
+			float v34 = sum[i];
+
+			if (unkown)
+				v34 = sin(v34 + batchX[i] * xFrequency);
+
+			double result = 0;
+
+			switch (combination) {
+			case 0:
+			case 1:
+				result = (v34 * offset32 + 1.0) * 0.5;
+				break;
+			case 2:
+			case 3:
+			case 4:
+			case 5:
+				result = v34 * offset32;
+				break;
+			}
+
+			results[offset + i] = applyCurves(result, approximateCurves);
+		}
+	}
+}
+
+double MapFractal::applyCurves(double result, bool approximate) {
+	if (bias)
+		result = approximate ? approximatePow(result, biasExponent) : pow(result, biasExponent);
+
+	if (gainType) {
+		if (result < 0.001)
+			return 0;
+
+		if (result > 0.999)
+			return 1.0;
+
+		if (result < 0.5)
+			return (approximate ? approximatePow(result * 2, gainExponent) : pow(result * 2, gainExponent)) * 0.5;
+
+		result = 1.0 - (approximate ? approximatePow((1.0 - result) * 2, gainExponent) : pow((1.0 - result) * 2, gainExponent)) * 0.5;
+	}
+
+	return result;
+}
+
+double MapFractal::approximatePow(double value, double exponent) {
+	if (value <= 0)
+		return pow(value, exponent);
+
+	// log2 of value = m * 2^k, m in [sqrt(1/2), sqrt(2)), from the atanh series of log(m)
+	int k;
+	double m = frexp(value, &k);
+
+	if (m < M_SQRT1_2) {
+		m *= 2;
+		--k;
+	}
+
+	double s = (m - 1) / (m + 1);
+	double s2 = s * s;
+
+	double log2Value = k + s * (2.8853900817779268 + s2 * (0.96179669392597555 + s2 * (0.57707801635558531
+			+ s2 * (0.41219858311113239 + s2 * 0.3205988979753252))));
+
+	double power = exponent * log2Value;
+
+	if (power < -1022)
+		return 0;
+
+	// 2^power = 2^n * e^(f ln 2), f in [-0.5, 0.5], from the taylor series of e^x
+	double n = floor(power + 0.5);
+	double z = (power - n) * M_LN2;
+
+	double result = 1.0;
+
+	for (int i = 8; i > 0; --i)
+		result = 1.0 + z / i * result;
+
+	return ldexp(result, (int) n);
+}
+
 void MapFractal::parseFromIffStream(engine::util::IffStream* iffStream) {
 	uint32 version = iffStream->getNextFormType();
 
@@ -179,6 +320,8 @@ void MapFractal::parseFromIffStream(engine::util::IffStream* iffStream, Version<
 	zOffset = iffStream->getFloat();
 	combination = iffStream->getUnsignedInt();
 
+	updateExponents();
+
 	iffStream->closeChunk('DATA');
 }
 
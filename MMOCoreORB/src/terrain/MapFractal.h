@@ -13,6 +13,11 @@
 #include "PerlinNoise.h"
 
 class MapFractal : public TemplateVariable<'MFRC'> {
+public:
+	// points evaluated together by the batch getNoise
+	const static int BATCHSIZE = 64;
+
+protected:
 	PerlinNoise* noise;
 	trn::ptat::Random* rand;
 
@@ -33,8 +38,25 @@ class MapFractal : public TemplateVariable<'MFRC'> {
 
 	static double log05;
 
+	// exponents of the bias and gain curves
+	double biasExponent;
+	double gainExponent;
+
 	float offset32;
 
+	void updateExponents() {
+		biasExponent = log(biasValue) / log05;
+		gainExponent = log(1.0 - gainValue) / log05;
+	}
+
+	double applyCurves(double result, bool approximate);
+
+	/**
+	 * pow of a value in [0, 1] from polynomials, within 1e-6 of pow for
+	 * exponents under 64
+	 */
+	static double approximatePow(double value, double exponent);
+
 public:
 	MapFractal();
 
@@ -52,6 +74,12 @@ public:
 	float getNoise(float x, float y, int i = 0, int  j = 0);
 	float getNoise(float x, int i = 0, int j = 0);
 
+	/**
+	 * Noise of count points at once, matches the single point getNoise
+	 * unless approximateCurves has bias and gain approximated within 1e-6
+	 */
+	void getNoise(const float* x, const float* y, float* results, int count, bool approximateCurves = false);
+
 	double calculateCombination1(float v39);
 	double calculateCombination1(float xfreq, float yfreq);
 	double calculateCombination2(float xfreq, float yfreq);
@@ -67,6 +95,8 @@ public:
 
 	inline void setBiasValue(float value) {
 		biasValue = value; // bias value
+
+		updateExponents();
 	}
 
 	inline void setGainType(int type) {
@@ -75,6 +105,8 @@ public:
 
 	inline void setGainValue(float val) {
 		gainValue = val; // gain value
+
+		updateExponents();
 	}
 
 	inline void setOctaves(int octaves) {
@@ -8,6 +8,7 @@
 #include "ProceduralTerrainAppearance.h"
 #include "TerrainGenerator.h"
 #include "TerrainMaps.h"
+#include "TerrainProgram.h"
 #include "layer/boundaries/Boundary.h"
 #include "layer/affectors/AffectorHeightConstant.h"
 #include "PerlinNoise.h"
@@ -181,6 +182,9 @@ void ProceduralTerrainAppearance::parseFromIffStream(engine::util::IffStream* if
 
 	terrainGenerator->readObject(iffStream);
 
+	if (!terrainGenerator->compilePrograms())
+		error("could not compile the layers of " + terrainFile + ", walking them instead");
+
 	terrainMaps->readObject(iffStream);
 
 	// TODO: some other stuff down here for version 0015 (everything else is the same)
@@ -256,33 +260,7 @@ Layer* ProceduralTerrainAppearance::getLayer(float x, float y) {
 }
 
 float ProceduralTerrainAppearance::calculateFeathering(float value, int featheringType) {
-	/* 1: x^2
-	 * 2: sqrt(x)
-	 * 3: x^2 * (3 - 2x)
-	 */
-
-
-	float result = value;
-
-	switch (featheringType) {
-	case 1:
-		result = result * result;
-		break;
-	case 2:
-		result = sqrt(result);
-		break;
-	case 3:
-		result = result * result * (3 - 2 * result);
-		break;
-	case 0:
-		//result = result;
-		break;
-	default:
-		result = 0;
-		break;
-	}
-
-	return result;
+	return TerrainProgram::calculateFeathering(value, featheringType);
 }
 
 float ProceduralTerrainAppearance::processTerrain(Layer* layer, float x, float y, float& baseValue, float affectorTransformValue, int affectorType) {
@@ -394,31 +372,34 @@ float ProceduralTerrainAppearance::processTerrain(Layer* layer, float x, float y
 	return transformValue;
 }
 
-int ProceduralTerrainAppearance::getEnvironmentID(float x, float y) {
-	ReadLocker locker(&guard);
+void ProceduralTerrainAppearance::processLayers(TerrainGenerator* terrain, float x, float y, float& baseValue, int affectorType, bool useProgram) {
+	if (useProgram && terrain->isCompiled()) {
+		TerrainProgram* program = affectorType == AffectorProceduralRule::ENVIRONMENT ? terrain->getEnvironmentProgram() : terrain->getHeightProgram();
 
-	float affectorTransform = 1.0;
+		program->process(x, y, baseValue, terrainGenerator);
 
-	float transformValue = 0;
-	float fullTraverse = 0;
+		return;
+	}
 
-	int count = 0;
-	TerrainGenerator* terrain = terrainGenerator;
+	Vector<Layer*>* layers = terrain->getLayersGroup()->getLayers();
+
+	for (int i = 0; i < layers->size(); ++i) {
+		Layer* layer = layers->get(i);
 
-	do {
-		LayersGroup* layersGroup = terrain->getLayersGroup();
+		if (layer->isEnabled())
+			processTerrain(layer, x, y, baseValue, 1.0, affectorType);
+	}
+}
 
-		Vector<Layer*>* layers = layersGroup->getLayers();
+int ProceduralTerrainAppearance::getEnvironmentID(float x, float y) {
+	ReadLocker locker(&guard);
 
-		for (int i = 0; i < layers->size(); ++i) {
-			Layer* layer = layers->get(i);
+	float fullTraverse = 0;
 
-			if (layer->isEnabled())
-				transformValue = processTerrain(layer, x, y, fullTraverse, affectorTransform, AffectorProceduralRule::ENVIRONMENT);
-		}
-	} while (count < customTerrain.size() && (terrain = customTerrain.get(count++)));
+	processLayers(terrainGenerator, x, y, fullTraverse, AffectorProceduralRule::ENVIRONMENT, true);
 
-	//info("full traverse height ... is " + String::valueOf(fullTraverse) + " in mili:" + String::valueOf(start.miliDifference()), true);
+	for (int i = 0; i < customTerrain.size(); ++i)
+		processLayers(customTerrain.get(i), x, y, fullTraverse, AffectorProceduralRule::ENVIRONMENT, true);
 
 	return fullTraverse;
 }
@@ -426,28 +407,65 @@ int ProceduralTerrainAppearance::getEnvironmentID(float x, float y) {
 float ProceduralTerrainAppearance::getHeight(float x, float y) {
 	ReadLocker locker(&guard);
 
-	float affectorTransform = 1.0;
+	return processHeight(x, y, true, true);
+}
+
+float ProceduralTerrainAppearance::getBaseHeight(float x, float y) {
+	ReadLocker locker(&guard);
+
+	return processHeight(x, y, false, true);
+}
 
-	float transformValue = 0;
-	float fullTraverse = 0;
+float ProceduralTerrainAppearance::getWalkedHeight(float x, float y) {
+	ReadLocker locker(&guard);
 
-	int count = 0;
-	TerrainGenerator* terrain = terrainGenerator;
+	return processHeight(x, y, true, false);
+}
 
-	do {
-		LayersGroup* layersGroup = terrain->getLayersGroup();
+void ProceduralTerrainAppearance::getHeights(const float* x, const float* y, float* heights, int count) {
+	ReadLocker locker(&guard);
 
-		Vector<Layer*>* layers = layersGroup->getLayers();
+	processHeights(x, y, heights, count, true);
+}
 
-		for (int i = 0; i < layers->size(); ++i) {
-			Layer* layer = layers->get(i);
+void ProceduralTerrainAppearance::getBaseHeights(const float* x, const float* y, float* heights, int count) {
+	ReadLocker locker(&guard);
 
-			if (layer->isEnabled())
-				transformValue = processTerrain(layer, x, y, fullTraverse, affectorTransform, AffectorProceduralRule::HEIGHTTYPE);
-		}
-	} while (count < customTerrain.size() && (terrain = customTerrain.get(count++)));
+	processHeights(x, y, heights, count, false);
+}
+
+void ProceduralTerrainAppearance::processHeights(const float* x, const float* y, float* heights, int count, bool includeCustomTerrain) {
+	for (int i = 0; i < count; ++i)
+		heights[i] = 0;
 
-	//info("full traverse height ... is " + String::valueOf(fullTraverse) + " in mili:" + String::valueOf(start.miliDifference()), true);
+	processHeightLayers(terrainGenerator, x, y, heights, count);
+
+	if (includeCustomTerrain) {
+		for (int i = 0; i < customTerrain.size(); ++i)
+			processHeightLayers(customTerrain.get(i), x, y, heights, count);
+	}
+}
+
+void ProceduralTerrainAppearance::processHeightLayers(TerrainGenerator* terrain, const float* x, const float* y, float* heights, int count) {
+	if (terrain->isCompiled()) {
+		terrain->getHeightProgram()->process(x, y, heights, count, terrainGenerator);
+
+		return;
+	}
+
+	for (int i = 0; i < count; ++i)
+		processLayers(terrain, x[i], y[i], heights[i], AffectorProceduralRule::HEIGHTTYPE, false);
+}
+
+float ProceduralTerrainAppearance::processHeight(float x, float y, bool includeCustomTerrain, bool useProgram) {
+	float fullTraverse = 0;
+
+	processLayers(terrainGenerator, x, y, fullTraverse, AffectorProceduralRule::HEIGHTTYPE, useProgram);
+
+	if (includeCustomTerrain) {
+		for (int i = 0; i < customTerrain.size(); ++i)
+			processLayers(customTerrain.get(i), x, y, fullTraverse, AffectorProceduralRule::HEIGHTTYPE, useProgram);
+	}
 
 	return fullTraverse;
 }
@@ -522,6 +540,9 @@ TerrainGenerator* ProceduralTerrainAppearance::addTerrainModification(engine::ut
 		}
 	}
 
+	if (!terrain->compilePrograms())
+		error("could not compile terrain modification " + String::valueOf(objectid) + ", walking its layers instead");
+
 	Locker locker(&guard);
 
 	TerrainGenerator* oldLayer = terrainModifications.put(objectid, terrain);
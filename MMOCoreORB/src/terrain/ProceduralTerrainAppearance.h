@@ -76,6 +76,12 @@ protected:
 	Layer* getLayerRecursive(float x, float y, Layer* rootParent);
 	Layer* getLayer(float x, float y);
 
+	// guard must be read locked
+	float processHeight(float x, float y, bool includeCustomTerrain, bool useProgram);
+	void processLayers(TerrainGenerator* terrain, float x, float y, float& baseValue, int affectorType, bool useProgram);
+	void processHeights(const float* x, const float* y, float* heights, int count, bool includeCustomTerrain);
+	void processHeightLayers(TerrainGenerator* terrain, const float* x, const float* y, float* heights, int count);
+
 	void translateBoundaries(Layer* layer, float x, float y);
 	void setHeight(Layer* layer, float height);
 
@@ -104,6 +110,25 @@ public:
 
 	bool getWater(float x, float y, float& waterHeight);
 	float getHeight(float x, float y);
+
+	/**
+	 * Returns the height of the terrain file alone, ignoring terrain modifications.
+	 */
+	float getBaseHeight(float x, float y);
+
+	/**
+	 * Heights of count points taken under a single read lock, the compiled
+	 * programs run on them in batches
+	 */
+	void getHeights(const float* x, const float* y, float* heights, int count);
+	void getBaseHeights(const float* x, const float* y, float* heights, int count);
+
+	/**
+	 * Returns the height by walking the layer trees instead of running their
+	 * compiled programs, to check the programs against.
+	 */
+	float getWalkedHeight(float x, float y);
+
 	int getEnvironmentID(float x, float y);
 
 	float getGlobalWaterTableHeight() {
@@ -145,10 +145,22 @@ void TerrainGenerator::parseFromIffStream(engine::util::IffStream* iffStream, Ve
 
 }
 
+bool TerrainGenerator::compilePrograms() {
+	Vector<Layer*>* layerVector = layers.getLayers();
+
+	compiled = heightProgram.compile(layerVector) && environmentProgram.compile(layerVector);
+
+	return compiled;
+}
+
 void TerrainGenerator::addLayer(Layer* layer) {
 	layers.getLayers()->add(layer);
+
+	compiled = false;
 }
 
 void TerrainGenerator::removeLayer(Layer* layer) {
 	layers.getLayers()->removeElement(layer);
+
+	compiled = false;
 }
@@ -17,6 +17,7 @@
 #include "LayersGroup.h"
 #include "layer/Layer.h"
 #include "BitmapGroup.h"
+#include "TerrainProgram.h"
 
 class ProceduralTerrainAppearance;
 
@@ -31,8 +32,13 @@ class TerrainGenerator : public TemplateVariable<'TGEN'> {
 	BitmapGroup bitmapGroup;
 	LayersGroup layers;
 
+	TerrainProgram heightProgram;
+	TerrainProgram environmentProgram;
+	bool compiled;
+
 public:
-	TerrainGenerator(ProceduralTerrainAppearance* ptat) {
+	TerrainGenerator(ProceduralTerrainAppearance* ptat) : heightProgram(AffectorProceduralRule::HEIGHTTYPE),
+			environmentProgram(AffectorProceduralRule::ENVIRONMENT), compiled(false) {
 		terrain = ptat;
 	}
 
@@ -42,6 +48,13 @@ public:
 	void parseFromIffStream(engine::util::IffStream* iffStream);
 	void parseFromIffStream(engine::util::IffStream* iffStream, Version<'0000'>);
 
+	/**
+	 * Compiles the layers into the height and environment programs, which
+	 * has to happen again whenever boundaries are moved
+	 * @return false if the layers can't be compiled and have to be walked instead
+	 */
+	bool compilePrograms();
+
 	void addLayer(Layer* layer);
 	void removeLayer(Layer* layer);
 
@@ -57,6 +70,18 @@ public:
 		return &layers;
 	}
 
+	inline bool isCompiled() const {
+		return compiled;
+	}
+
+	inline TerrainProgram* getHeightProgram() {
+		return &heightProgram;
+	}
+
+	inline TerrainProgram* getEnvironmentProgram() {
+		return &environmentProgram;
+	}
+
 	inline BitmapGroup* getBitmapGroup() {
 		return &bitmapGroup;
 	}
@@ -0,0 +1,435 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#include "TerrainProgram.h"
+#include "TerrainGenerator.h"
+
+template<class E> static void shrink(Vector<E>& vector, int size) {
+	while (vector.size() > size)
+		vector.remove(vector.size() - 1);
+}
+
+TerrainProgram::TerrainProgram(int affectorType) : affectorType(affectorType), tooDeep(false) {
+}
+
+bool TerrainProgram::compile(Vector<Layer*>* roots) {
+	layers.removeAll();
+	boundaries.removeAll();
+	filters.removeAll();
+	affectors.removeAll();
+
+	tooDeep = false;
+
+	for (int i = 0; i < roots->size(); ++i) {
+		Layer* layer = roots->get(i);
+
+		if (layer->isEnabled())
+			compileLayer(layer, 0);
+	}
+
+	if (tooDeep) {
+		layers.removeAll();
+		boundaries.removeAll();
+		filters.removeAll();
+		affectors.removeAll();
+
+		return false;
+	}
+
+	return true;
+}
+
+bool TerrainProgram::compileLayer(Layer* layer, int depth) {
+	if (depth >= MAXDEPTH) {
+		tooDeep = true;
+		return false;
+	}
+
+	int index = layers.size();
+	int boundaryCount = boundaries.size();
+	int filterCount = filters.size();
+	int affectorCount = affectors.size();
+
+	LayerOp op;
+	op.depth = depth;
+	op.invertBoundaries = layer->invertBoundaries();
+	op.invertFilters = layer->invertFilters();
+
+	Vector<Boundary*>* layerBoundaries = layer->getBoundaries();
+
+	op.firstBoundary = boundaries.size();
+
+	for (int i = 0; i < layerBoundaries->size(); ++i) {
+		Boundary* boundary = layerBoundaries->get(i);
+
+		if (!boundary->isEnabled())
+			continue;
+
+		BoundaryOp boundaryOp;
+		boundaryOp.boundary = boundary;
+		boundaryOp.minX = boundary->getMinX();
+		boundaryOp.minY = boundary->getMinY();
+		boundaryOp.maxX = boundary->getMaxX();
+		boundaryOp.maxY = boundary->getMaxY();
+		boundaryOp.featheringType = boundary->getFeatheringType();
+
+		op.minX = MIN(op.minX, boundaryOp.minX);
+		op.minY = MIN(op.minY, boundaryOp.minY);
+		op.maxX = MAX(op.maxX, boundaryOp.maxX);
+		op.maxY = MAX(op.maxY, boundaryOp.maxY);
+		op.hasBoundaries = true;
+
+		boundaries.add(boundaryOp);
+	}
+
+	op.lastBoundary = boundaries.size();
+
+	Vector<FilterProceduralRule*>* layerFilters = layer->getFilters();
+
+	op.firstFilter = filters.size();
+
+	for (int i = 0; i < layerFilters->size(); ++i) {
+		FilterProceduralRule* filter = layerFilters->get(i);
+
+		if (!filter->isEnabled())
+			continue;
+
+		FilterOp filterOp;
+		filterOp.filter = filter;
+		filterOp.featheringType = filter->getFeatheringType();
+
+		filters.add(filterOp);
+	}
+
+	op.lastFilter = filters.size();
+
+	Vector<AffectorProceduralRule*>* layerAffectors = layer->getAffectors();
+
+	op.firstAffector = affectors.size();
+
+	for (int i = 0; i < layerAffectors->size(); ++i) {
+		AffectorProceduralRule* affector = layerAffectors->get(i);
+
+		if (affector->isEnabled() && (affector->getAffectorType() & affectorType))
+			affectors.add(affector);
+	}
+
+	op.lastAffector = affectors.size();
+
+	layers.add(op);
+
+	bool affects = op.lastAffector > op.firstAffector;
+
+	Vector<Layer*>* children = layer->getChildren();
+
+	for (int i = 0; i < children->size(); ++i) {
+		Layer* child = children->get(i);
+
+		if (child->isEnabled() && compileLayer(child, depth + 1))
+			affects = true;
+	}
+
+	// boundaries and filters only decide where affectors apply, the layer can go
+	if (!affects) {
+		shrink(layers, index);
+		shrink(boundaries, boundaryCount);
+		shrink(filters, filterCount);
+		shrink(affectors, affectorCount);
+
+		return false;
+	}
+
+	layers.get(index).end = layers.size();
+
+	return true;
+}
+
+void TerrainProgram::process(float x, float y, float& baseValue, TerrainGenerator* terrainGenerator) {
+	// end and affector transform value of the layers whose children are running
+	int ends[MAXDEPTH];
+	float transforms[MAXDEPTH];
+	int depth = 0;
+
+	float affectorTransformValue = 1.0;
+
+	int count = layers.size();
+	int i = 0;
+
+	while (i < count) {
+		while (depth > 0 && i >= ends[depth - 1])
+			affectorTransformValue = transforms[--depth];
+
+		LayerOp& op = layers.get(i);
+
+		// every boundary of the layer would return 0
+		if (op.hasBoundaries && !op.invertBoundaries && !op.contains(x, y)) {
+			i = op.end;
+			continue;
+		}
+
+		FilterRectangle rect;
+		rect.minX = FLT_MAX, rect.maxX = -FLT_MAX, rect.minY = FLT_MAX, rect.maxY = -FLT_MAX;
+
+		float transformValue = processBoundaries(op, x, y, rect);
+
+		if (transformValue != 0)
+			transformValue = processFilters(op, x, y, transformValue, baseValue, terrainGenerator, rect);
+
+		if (transformValue == 0) {
+			i = op.end;
+			continue;
+		}
+
+		for (int j = op.firstAffector; j < op.lastAffector; ++j)
+			affectors.get(j)->process(x, y, transformValue * affectorTransformValue, baseValue, terrainGenerator);
+
+		if (op.end > i + 1) {
+			ends[depth] = op.end;
+			transforms[depth++] = affectorTransformValue;
+
+			affectorTransformValue *= transformValue;
+		}
+
+		++i;
+	}
+}
+
+void TerrainProgram::process(const float* x, const float* y, float* baseValues, int count, TerrainGenerator* terrainGenerator) {
+	for (int i = 0; i < count; i += BATCHSIZE)
+		processBatch(x + i, y + i, baseValues + i, MIN(BATCHSIZE, count - i), terrainGenerator);
+}
+
+void TerrainProgram::processBatch(const float* x, const float* y, float* baseValues, int count, TerrainGenerator* terrainGenerator) {
+	// affector transform value each point passes on to the children of the layers at each depth
+	float transforms[MAXDEPTH + 1][BATCHSIZE];
+
+	// op each point skips to, past the children of the last layer it failed
+	int skips[BATCHSIZE];
+
+	// points running the current op, packed so the rules can take them as one batch
+	int points[BATCHSIZE];
+	float opX[BATCHSIZE], opY[BATCHSIZE], opTransforms[BATCHSIZE], opBaseValues[BATCHSIZE], opAffectorTransforms[BATCHSIZE];
+	FilterRectangle rects[BATCHSIZE];
+
+	float minX = FLT_MAX, minY = FLT_MAX, maxX = -FLT_MAX, maxY = -FLT_MAX;
+
+	for (int k = 0; k < count; ++k) {
+		transforms[0][k] = 1.0;
+		skips[k] = 0;
+
+		minX = MIN(minX, x[k]);
+		minY = MIN(minY, y[k]);
+		maxX = MAX(maxX, x[k]);
+		maxY = MAX(maxY, y[k]);
+	}
+
+	int size = layers.size();
+	int i = 0;
+
+	while (i < size) {
+		LayerOp& op = layers.get(i);
+
+		bool bounded = op.hasBoundaries && !op.invertBoundaries;
+
+		if (bounded && !op.overlaps(minX, minY, maxX, maxY)) {
+			i = op.end;
+			continue;
+		}
+
+		float* affectorTransformValues = transforms[op.depth];
+		float* childTransformValues = transforms[op.depth + 1];
+
+		int running = 0;
+
+		for (int k = 0; k < count; ++k) {
+			if (skips[k] > i)
+				continue;
+
+			if (bounded && !op.contains(x[k], y[k])) {
+				skips[k] = op.end;
+				continue;
+			}
+
+			FilterRectangle& rect = rects[running];
+			rect.minX = FLT_MAX, rect.maxX = -FLT_MAX, rect.minY = FLT_MAX, rect.maxY = -FLT_MAX;
+
+			float transformValue = processBoundaries(op, x[k], y[k], rect);
+
+			if (transformValue == 0) {
+				skips[k] = op.end;
+				continue;
+			}
+
+			points[running] = k;
+			opX[running] = x[k];
+			opY[running] = y[k];
+			opTransforms[running] = transformValue;
+			opBaseValues[running] = baseValues[k];
+
+			++running;
+		}
+
+		if (running > 0)
+			processFilters(op, opX, opY, opTransforms, opBaseValues, rects, running, terrainGenerator);
+
+		int applied = 0;
+
+		for (int m = 0; m < running; ++m) {
+			int k = points[m];
+
+			if (opTransforms[m] == 0) {
+				skips[k] = op.end;
+				continue;
+			}
+
+			points[applied] = k;
+			opX[applied] = opX[m];
+			opY[applied] = opY[m];
+			opTransforms[applied] = opTransforms[m];
+			opBaseValues[applied] = opBaseValues[m];
+			opAffectorTransforms[applied] = opTransforms[m] * affectorTransformValues[k];
+
+			++applied;
+		}
+
+		for (int j = op.firstAffector; j < op.lastAffector; ++j)
+			affectors.get(j)->processBatch(opX, opY, opAffectorTransforms, opBaseValues, terrainGenerator, applied);
+
+		for (int m = 0; m < applied; ++m) {
+			int k = points[m];
+
+			baseValues[k] = opBaseValues[m];
+			childTransformValues[k] = affectorTransformValues[k] * opTransforms[m];
+		}
+
+		i = applied > 0 ? i + 1 : op.end;
+	}
+}
+
+float TerrainProgram::processBoundaries(LayerOp& op, float x, float y, FilterRectangle& rect) {
+	float transformValue = 0;
+
+	if (!op.hasBoundaries)
+		transformValue = 1.0;
+
+	for (int i = op.firstBoundary; i < op.lastBoundary; ++i) {
+		BoundaryOp& boundaryOp = boundaries.get(i);
+
+		// boundaries return 0 outside their bounds, which every feathering keeps at 0
+		if (!boundaryOp.contains(x, y))
+			continue;
+
+		float result = boundaryOp.boundary->process(x, y);
+
+		if (result != 0.0) {
+			rect.minX = MIN(rect.minX, boundaryOp.minX);
+			rect.maxX = MAX(rect.maxX, boundaryOp.maxX);
+			rect.minY = MIN(rect.minY, boundaryOp.minY);
+			rect.maxY = MAX(rect.maxY, boundaryOp.maxY);
+		}
+
+		result = calculateFeathering(result, boundaryOp.featheringType);
+
+		if (result > transformValue)
+			transformValue = result;
+
+		if (transformValue >= 1)
+			break;
+	}
+
+	if (op.invertBoundaries)
+		transformValue = 1.0 - transformValue;
+
+	return transformValue;
+}
+
+float TerrainProgram::processFilters(LayerOp& op, float x, float y, float transformValue, float& baseValue, TerrainGenerator* terrainGenerator, FilterRectangle& rect) {
+	for (int i = op.firstFilter; i < op.lastFilter; ++i) {
+		FilterOp& filterOp = filters.get(i);
+
+		float result = filterOp.filter->process(x, y, transformValue, baseValue, terrainGenerator, &rect);
+
+		result = calculateFeathering(result, filterOp.featheringType);
+
+		if (transformValue > result)
+			transformValue = result;
+
+		if (transformValue == 0)
+			break;
+	}
+
+	if (op.invertFilters)
+		transformValue = 1.0 - transformValue;
+
+	return transformValue;
+}
+
+void TerrainProgram::processFilters(LayerOp& op, const float* x, const float* y, float* transformValues, float* baseValues, FilterRectangle* rects, int count, TerrainGenerator* terrainGenerator) {
+	// points whose transform value hasn't reached 0 yet, packed for the next filter
+	int points[BATCHSIZE];
+	float filterX[BATCHSIZE], filterY[BATCHSIZE], filterTransforms[BATCHSIZE], filterBaseValues[BATCHSIZE], results[BATCHSIZE];
+	FilterRectangle filterRects[BATCHSIZE];
+
+	int running = count;
+
+	for (int k = 0; k < count; ++k)
+		points[k] = k;
+
+	for (int i = op.firstFilter; i < op.lastFilter && running > 0; ++i) {
+		FilterOp& filterOp = filters.get(i);
+
+		for (int m = 0; m < running; ++m) {
+			int k = points[m];
+
+			filterX[m] = x[k];
+			filterY[m] = y[k];
+			filterTransforms[m] = transformValues[k];
+			filterBaseValues[m] = baseValues[k];
+			filterRects[m] = rects[k];
+		}
+
+		filterOp.filter->processBatch(filterX, filterY, filterTransforms, filterBaseValues, terrainGenerator, filterRects, results, running);
+
+		int remaining = 0;
+
+		for (int m = 0; m < running; ++m) {
+			int k = points[m];
+
+			float result = calculateFeathering(results[m], filterOp.featheringType);
+
+			if (transformValues[k] > result)
+				transformValues[k] = result;
+
+			if (transformValues[k] != 0)
+				points[remaining++] = k;
+		}
+
+		running = remaining;
+	}
+
+	if (op.invertFilters) {
+		for (int k = 0; k < count; ++k)
+			transformValues[k] = 1.0 - transformValues[k];
+	}
+}
+
+float TerrainProgram::calculateFeathering(float value, int featheringType) {
+	/* 1: x^2
+	 * 2: sqrt(x)
+	 * 3: x^2 * (3 - 2x)
+	 */
+
+	switch (featheringType) {
+	case 0:
+		return value;
+	case 1:
+		return value * value;
+	case 2:
+		return sqrt(value);
+	case 3:
+		return value * value * (3 - 2 * value);
+	default:
+		return 0;
+	}
+}
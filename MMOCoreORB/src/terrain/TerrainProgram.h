@@ -0,0 +1,150 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#ifndef TERRAINPROGRAM_H_
+#define TERRAINPROGRAM_H_
+
+#include "engine/engine.h"
+
+#include "layer/Layer.h"
+
+class TerrainGenerator;
+
+/**
+ * Layer tree of a terrain generator flattened into one array of layer ops
+ * in the order ProceduralTerrainAppearance::processTerrain visits them.
+ * Each op carries the bounds of its boundaries so points outside of them
+ * skip the layer and its children without calling into the rules, and
+ * layers with no affector of the program type anywhere below them aren't
+ * compiled at all.
+ *
+ * Programs keep pointers to the rules of the layers they were compiled
+ * from and have to be compiled again after the boundaries move.
+ */
+class TerrainProgram {
+public:
+	const static int MAXDEPTH = 32;
+
+	// points the batch process runs through each op together
+	const static int BATCHSIZE = 64;
+
+protected:
+	class LayerOp {
+	public:
+		// union of the bounds of the enabled boundaries
+		float minX, minY, maxX, maxY;
+
+		bool hasBoundaries;
+		bool invertBoundaries;
+		bool invertFilters;
+
+		// ranges of the rules of the layer in the rule arrays
+		int firstBoundary, lastBoundary;
+		int firstFilter, lastFilter;
+		int firstAffector, lastAffector;
+
+		// index past the last op of the children of the layer
+		int end;
+
+		// number of layers above the layer
+		int depth;
+
+		LayerOp() : minX(FLT_MAX), minY(FLT_MAX), maxX(-FLT_MAX), maxY(-FLT_MAX),
+				hasBoundaries(false), invertBoundaries(false), invertFilters(false),
+				firstBoundary(0), lastBoundary(0), firstFilter(0), lastFilter(0),
+				firstAffector(0), lastAffector(0), end(0), depth(0) {
+		}
+
+		inline bool contains(float x, float y) const {
+			return x >= minX && x <= maxX && y >= minY && y <= maxY;
+		}
+
+		inline bool overlaps(float minX, float minY, float maxX, float maxY) const {
+			return maxX >= this->minX && minX <= this->maxX && maxY >= this->minY && minY <= this->maxY;
+		}
+	};
+
+	class BoundaryOp {
+	public:
+		Boundary* boundary;
+		float minX, minY, maxX, maxY;
+		int featheringType;
+
+		BoundaryOp() : boundary(NULL), minX(0), minY(0), maxX(0), maxY(0), featheringType(0) {
+		}
+
+		inline bool contains(float x, float y) const {
+			return x >= minX && x <= maxX && y >= minY && y <= maxY;
+		}
+	};
+
+	class FilterOp {
+	public:
+		FilterProceduralRule* filter;
+		int featheringType;
+
+		FilterOp() : filter(NULL), featheringType(0) {
+		}
+	};
+
+	Vector<LayerOp> layers;
+	Vector<BoundaryOp> boundaries;
+	Vector<FilterOp> filters;
+	Vector<AffectorProceduralRule*> affectors;
+
+	// affectors whose type shares a bit with it are part of the program
+	int affectorType;
+
+	// set while compiling a tree nested deeper than MAXDEPTH
+	bool tooDeep;
+
+public:
+	TerrainProgram(int affectorType);
+
+	/**
+	 * Replaces the program with the enabled layers in roots
+	 * @return false, leaving the program empty, if the layers nest deeper than MAXDEPTH
+	 */
+	bool compile(Vector<Layer*>* roots);
+
+	/**
+	 * Runs the affectors of the program at x, y on baseValue, same as
+	 * processTerrain does for every enabled root layer
+	 */
+	void process(float x, float y, float& baseValue, TerrainGenerator* terrainGenerator);
+
+	/**
+	 * Same as process for count points, running each op on a batch of points
+	 * before moving on to the next one. A layer whose bounds miss the whole
+	 * batch is skipped with its children in a single check, and filters and
+	 * affectors take the points of the batch the op applies to at once.
+	 */
+	void process(const float* x, const float* y, float* baseValues, int count, TerrainGenerator* terrainGenerator);
+
+	inline int size() const {
+		return layers.size();
+	}
+
+	static float calculateFeathering(float value, int featheringType);
+
+protected:
+	/**
+	 * Appends the ops of layer and its children
+	 * @return false if nothing below layer affects the program type
+	 */
+	bool compileLayer(Layer* layer, int depth);
+
+	void processBatch(const float* x, const float* y, float* baseValues, int count, TerrainGenerator* terrainGenerator);
+
+	float processBoundaries(LayerOp& op, float x, float y, FilterRectangle& rect);
+	float processFilters(LayerOp& op, float x, float y, float transformValue, float& baseValue, TerrainGenerator* terrainGenerator, FilterRectangle& rect);
+
+	/**
+	 * processFilters for count points, each filter runs once for the points
+	 * whose transform value it hasn't taken to 0 yet
+	 */
+	void processFilters(LayerOp& op, const float* x, const float* y, float* transformValues, float* baseValues, FilterRectangle* rects, int count, TerrainGenerator* terrainGenerator);
+};
+
+#endif /* TERRAINPROGRAM_H_ */
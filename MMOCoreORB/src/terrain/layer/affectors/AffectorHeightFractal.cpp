@@ -8,21 +8,22 @@
 #include "AffectorHeightFractal.h"
 #include "../../TerrainGenerator.h"
 
-void AffectorHeightFractal::process(float x, float y, float transformValue, float& baseValue, TerrainGenerator* terrainGenerator) {
-	if (transformValue == 0)
-		return;
-
+bool AffectorHeightFractal::loadFractal(TerrainGenerator* terrainGenerator) {
 	if (mfrc == NULL) {
 		mfrc = terrainGenerator->getMfrc(fractalId);
 
 		if (mfrc == NULL) {
 			System::out << "error out of bounds fractal id for affector " << informationHeader.getDescription() << endl;
 
-			return;
+			return false;
 		}
 	}
 
-	float noiseResult = mfrc->getNoise(x, y, 0, 0) * height;
+	return true;
+}
+
+float AffectorHeightFractal::apply(float noise, float transformValue, float baseValue) {
+	float noiseResult = noise * height;
 
 	//System::out << "noiseResult " << noiseResult << " height:" << height << endl;
 
@@ -46,7 +47,35 @@ void AffectorHeightFractal::process(float x, float y, float transformValue, floa
 		break;
 	}
 
-	baseValue = result;
+	return result;
+}
+
+void AffectorHeightFractal::process(float x, float y, float transformValue, float& baseValue, TerrainGenerator* terrainGenerator) {
+	if (transformValue == 0)
+		return;
+
+	if (!loadFractal(terrainGenerator))
+		return;
+
+	baseValue = apply(mfrc->getNoise(x, y, 0, 0), transformValue, baseValue);
+}
+
+void AffectorHeightFractal::processBatch(const float* x, const float* y, const float* transformValues, float* baseValues, TerrainGenerator* terrainGenerator, int count) {
+	if (!loadFractal(terrainGenerator))
+		return;
+
+	float noise[MapFractal::BATCHSIZE];
+
+	for (int offset = 0; offset < count; offset += MapFractal::BATCHSIZE) {
+		int size = MIN(MapFractal::BATCHSIZE, count - offset);
+
+		mfrc->getNoise(x + offset, y + offset, noise, size);
+
+		for (int i = 0; i < size; ++i) {
+			if (transformValues[offset + i] != 0)
+				baseValues[offset + i] = apply(noise[i], transformValues[offset + i], baseValues[offset + i]);
+		}
+	}
 }
 
 void AffectorHeightFractal::parseFromIffStream(engine::util::IffStream* iffStream) {
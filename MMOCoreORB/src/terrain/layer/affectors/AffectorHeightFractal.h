@@ -19,12 +19,17 @@ class AffectorHeightFractal : public ProceduralRule<'AHFR'>, public AffectorProc
 	float height;
 	MapFractal* mfrc;
 
+	bool loadFractal(TerrainGenerator* terrainGenerator);
+
+	float apply(float noise, float transformValue, float baseValue);
+
 public:
 	AffectorHeightFractal() : fractalId(0), operationType(0), height(0), mfrc(NULL) {
 		affectorType = HEIGHTFRACTAL;
 	}
 
 	void process(float x, float y, float transformValue, float& baseValue, TerrainGenerator* terrainGenerator);
+	void processBatch(const float* x, const float* y, const float* transformValues, float* baseValues, TerrainGenerator* terrainGenerator, int count);
 
 	void parseFromIffStream(engine::util::IffStream* iffStream);
 	void parseFromIffStream(engine::util::IffStream* iffStream, Version<'0003'>);
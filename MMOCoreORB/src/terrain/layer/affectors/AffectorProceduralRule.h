@@ -34,6 +34,14 @@ public:
 
 	}
 
+	/**
+	 * process for count points
+	 */
+	virtual void processBatch(const float* x, const float* y, const float* transformValues, float* baseValues, TerrainGenerator* terrainGenerator, int count) {
+		for (int i = 0; i < count; ++i)
+			process(x[i], y[i], transformValues[i], baseValues[i], terrainGenerator);
+	}
+
 	inline bool isHeightTypeAffector() {
 		return affectorType & HEIGHTTYPE;
 	}
@@ -10,18 +10,22 @@
 #include "../../TerrainGenerator.h"
 
 
-float FilterFractal::process(float x, float y, float transformValue, float& baseValue, TerrainGenerator* terrainGenerator, FilterRectangle* rect) {
+bool FilterFractal::loadFractal(TerrainGenerator* terrainGenerator) {
 	if (mfrc == NULL) {
 		mfrc = terrainGenerator->getMfrc(fractalId);
 
 		if (mfrc == NULL) {
 			System::out << "error out of bounds fractal id for filter " << informationHeader.getDescription() << endl;
 
-			return 1;
+			return false;
 		}
 	}
 
-	float noiseResult = mfrc->getNoise(x, y, 0, 0) * var6;
+	return true;
+}
+
+float FilterFractal::getResult(float noise) {
+	float noiseResult = noise * var6;
 	float result = 0;
 
 	if (noiseResult > min && noiseResult < max) {
@@ -40,6 +44,27 @@ float FilterFractal::process(float x, float y, float transformValue, float& base
 	return result;
 }
 
+float FilterFractal::process(float x, float y, float transformValue, float& baseValue, TerrainGenerator* terrainGenerator, FilterRectangle* rect) {
+	if (!loadFractal(terrainGenerator))
+		return 1;
+
+	return getResult(mfrc->getNoise(x, y, 0, 0));
+}
+
+void FilterFractal::processBatch(const float* x, const float* y, const float* transformValues, float* baseValues, TerrainGenerator* terrainGenerator, FilterRectangle* rects, float* results, int count) {
+	if (!loadFractal(terrainGenerator)) {
+		for (int i = 0; i < count; ++i)
+			results[i] = 1;
+
+		return;
+	}
+
+	mfrc->getNoise(x, y, results, count);
+
+	for (int i = 0; i < count; ++i)
+		results[i] = getResult(results[i]);
+}
+
 void FilterFractal::parseFromIffStream(engine::util::IffStream* iffStream) {
 	uint32 version = iffStream->getNextFormType();
 
@@ -22,6 +22,10 @@ class FilterFractal : public ProceduralRule<'FFRA'>, public FilterProceduralRule
 	float var6; // Scale/Stepping?
 	MapFractal* mfrc;
 
+	bool loadFractal(TerrainGenerator* terrainGenerator);
+
+	float getResult(float noise);
+
 public:
 	FilterFractal() : FilterProceduralRule(1), fractalId(0), min(0), max(0), var6(0), mfrc(NULL) {
 		filterType = HEIGHTTYPE;
@@ -31,6 +35,7 @@ public:
 	void parseFromIffStream(engine::util::IffStream* iffStream, Version<'0005'>);
 
 	float process(float x, float y, float transformValue, float& baseValue, TerrainGenerator* terrainGenerator, FilterRectangle* rect);
+	void processBatch(const float* x, const float* y, const float* transformValues, float* baseValues, TerrainGenerator* terrainGenerator, FilterRectangle* rects, float* results, int count);
 
 	bool isEnabled() {
 		return informationHeader.isEnabled();
@@ -47,6 +47,14 @@ public:
 		return 0;
 	}
 
+	/**
+	 * process for count points, results get the result of each point
+	 */
+	virtual void processBatch(const float* x, const float* y, const float* transformValues, float* baseValues, TerrainGenerator* terrainGenerator, FilterRectangle* rects, float* results, int count) {
+		for (int i = 0; i < count; ++i)
+			results[i] = process(x[i], y[i], transformValues[i], baseValues[i], terrainGenerator, &rects[i]);
+	}
+
 	virtual bool isEnabled() {
 		return false;
 	}
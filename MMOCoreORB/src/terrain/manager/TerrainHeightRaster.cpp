@@ -0,0 +1,254 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#include "TerrainHeightRaster.h"
+#include "terrain/ProceduralTerrainAppearance.h"
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+TerrainHeightRaster::TerrainHeightRaster(float originX, float originY, float size, float spacing) : Logger("TerrainHeightRaster"),
+		originX(originX), originY(originY), spacing(spacing), invSpacing(1.f / spacing), errorBound(0), heights(NULL), ownedHeights(NULL),
+		mapping(NULL), mappingSize(0) {
+
+	width = (int) ceil(size / spacing) + 1;
+
+	blocksPerRow = (int) ceil(size / BLOCKSIZE) + 1;
+	modifiedBlocks = new AtomicInteger[blocksPerRow * blocksPerRow];
+}
+
+TerrainHeightRaster::~TerrainHeightRaster() {
+	unmap();
+
+	delete[] ownedHeights;
+	delete[] modifiedBlocks;
+}
+
+void TerrainHeightRaster::build(ProceduralTerrainAppearance* terrain) {
+	// readers never lock, the heights can't change once they are published
+	if (isReady())
+		return;
+
+	float* samples = new float[width * width];
+
+	float* rowX = new float[width];
+	float* rowY = new float[width];
+
+	for (int x = 0; x < width; ++x)
+		rowX[x] = originX + x * spacing;
+
+	Time start;
+
+	for (int y = 0; y < width; ++y) {
+		float sampleY = originY + y * spacing;
+
+		for (int x = 0; x < width; ++x)
+			rowY[x] = sampleY;
+
+		terrain->getBaseHeights(rowX, rowY, samples + y * width, width);
+
+		if ((y + 1) % 512 == 0)
+			info("sampled " + String::valueOf((y + 1) * 100 / width) + "% of the height raster");
+	}
+
+	ownedHeights = samples;
+	heights = samples;
+
+	// the cell centers are as far from the grid points as it gets
+	float* exact = new float[width];
+	float maxError = 0;
+
+	for (int x = 0; x < width - 1; ++x)
+		rowX[x] = originX + (x + 0.5f) * spacing;
+
+	for (int y = 0; y < width - 1; ++y) {
+		float sampleY = originY + (y + 0.5f) * spacing;
+
+		for (int x = 0; x < width - 1; ++x)
+			rowY[x] = sampleY;
+
+		terrain->getBaseHeights(rowX, rowY, exact, width - 1);
+
+		for (int x = 0; x < width - 1; ++x)
+			maxError = MAX(maxError, fabs(getHeight(rowX[x], sampleY) - exact[x]));
+	}
+
+	delete[] exact;
+	delete[] rowX;
+	delete[] rowY;
+
+	errorBound = maxError * ERRORMARGIN;
+
+	info("sampled " + String::valueOf(width) + "x" + String::valueOf(width) + " heights in " + String::valueOf(start.miliDifference()) + " ms, error bound "
+			+ String::valueOf(errorBound) + " m", true);
+
+	ready.increment();
+}
+
+bool TerrainHeightRaster::map(const String& path, uint64 terrainHash) {
+	if (isReady())
+		return false;
+
+	int fd = ::open(path.toCharArray(), O_RDONLY);
+
+	if (fd == -1)
+		return false;
+
+	size_t expectedSize = sizeof(FileHeader) + sizeof(float) * width * width;
+
+	struct stat fileStat;
+
+	if (fstat(fd, &fileStat) != 0 || (size_t) fileStat.st_size != expectedSize) {
+		::close(fd);
+		return false;
+	}
+
+	void* data = ::mmap(NULL, expectedSize, PROT_READ, MAP_SHARED, fd, 0);
+
+	::close(fd);
+
+	if (data == MAP_FAILED)
+		return false;
+
+	const FileHeader* header = static_cast<const FileHeader*>(data);
+
+	if (header->magic != MAGIC || header->version != VERSION || header->terrainHash != terrainHash
+			|| header->originX != originX || header->originY != originY || header->spacing != spacing || header->width != width) {
+		::munmap(data, expectedSize);
+		return false;
+	}
+
+	mapping = data;
+	mappingSize = expectedSize;
+	errorBound = header->errorBound;
+	heights = reinterpret_cast<float*>(static_cast<char*>(data) + sizeof(FileHeader));
+
+	ready.increment();
+
+	return true;
+}
+
+bool TerrainHeightRaster::save(const String& path, uint64 terrainHash) {
+	if (ownedHeights == NULL)
+		return false;
+
+	// written aside and renamed so an interrupted boot never leaves a truncated raster behind
+	String tempPath = path + ".tmp";
+
+	FILE* fp = fopen(tempPath.toCharArray(), "wb");
+
+	if (!fp) {
+		error("could not write " + tempPath);
+		return false;
+	}
+
+	FileHeader header;
+	header.magic = MAGIC;
+	header.version = VERSION;
+	header.terrainHash = terrainHash;
+	header.originX = originX;
+	header.originY = originY;
+	header.spacing = spacing;
+	header.width = width;
+	header.errorBound = errorBound;
+
+	bool written = fwrite(&header, sizeof(FileHeader), 1, fp) == 1
+			&& fwrite(ownedHeights, sizeof(float) * width, width, fp) == (size_t) width;
+
+	written = (fclose(fp) == 0) && written;
+
+	if (!written || ::rename(tempPath.toCharArray(), path.toCharArray()) != 0) {
+		error("could not write " + path);
+		::remove(tempPath.toCharArray());
+
+		return false;
+	}
+
+	return true;
+}
+
+void TerrainHeightRaster::unmap() {
+	if (mapping == NULL)
+		return;
+
+	::munmap(mapping, mappingSize);
+
+	mapping = NULL;
+	mappingSize = 0;
+}
+
+void TerrainHeightRaster::addModification(float centerX, float centerY, float radius) {
+	updateBlocks(centerX, centerY, radius, 1);
+}
+
+void TerrainHeightRaster::removeModification(float centerX, float centerY, float radius) {
+	updateBlocks(centerX, centerY, radius, -1);
+}
+
+bool TerrainHeightRaster::isModified(float x0, float y0, float x1, float y1) {
+	if (unboundedModifications.get() != 0)
+		return true;
+
+	int minX = MAX((int) floor((x0 - originX) / BLOCKSIZE), 0);
+	int minY = MAX((int) floor((y0 - originY) / BLOCKSIZE), 0);
+	int maxX = MIN((int) floor((x1 - originX) / BLOCKSIZE), blocksPerRow - 1);
+	int maxY = MIN((int) floor((y1 - originY) / BLOCKSIZE), blocksPerRow - 1);
+
+	for (int y = minY; y <= maxY; ++y) {
+		for (int x = minX; x <= maxX; ++x) {
+			if (modifiedBlocks[y * blocksPerRow + x].get() != 0)
+				return true;
+		}
+	}
+
+	return false;
+}
+
+void TerrainHeightRaster::getHeightRange(float x0, float y0, float x1, float y1, float& minHeight, float& maxHeight) const {
+	int minX = MAX((int) floor((MIN(x0, x1) - originX) * invSpacing), 0);
+	int minY = MAX((int) floor((MIN(y0, y1) - originY) * invSpacing), 0);
+	int maxX = MIN((int) ceil((MAX(x0, x1) - originX) * invSpacing), width - 1);
+	int maxY = MIN((int) ceil((MAX(y0, y1) - originY) * invSpacing), width - 1);
+
+	minHeight = FLT_MAX;
+	maxHeight = -FLT_MAX;
+
+	for (int y = minY; y <= maxY; ++y) {
+		const float* row = heights + y * width;
+
+		for (int x = minX; x <= maxX; ++x) {
+			minHeight = MIN(minHeight, row[x]);
+			maxHeight = MAX(maxHeight, row[x]);
+		}
+	}
+}
+
+void TerrainHeightRaster::updateBlocks(float centerX, float centerY, float radius, int delta) {
+	int minX = MAX((int) floor((centerX - radius - originX) / BLOCKSIZE), 0);
+	int minY = MAX((int) floor((centerY - radius - originY) / BLOCKSIZE), 0);
+	int maxX = MIN((int) floor((centerX + radius - originX) / BLOCKSIZE), blocksPerRow - 1);
+	int maxY = MIN((int) floor((centerY + radius - originY) / BLOCKSIZE), blocksPerRow - 1);
+
+	for (int y = minY; y <= maxY; ++y) {
+		for (int x = minX; x <= maxX; ++x) {
+			if (delta > 0)
+				modifiedBlocks[y * blocksPerRow + x].increment();
+			else
+				modifiedBlocks[y * blocksPerRow + x].decrement();
+		}
+	}
+}
+
+uint64 TerrainHeightRaster::hashData(const byte* data, int size) {
+	uint64 hash = 14695981039346656037ULL;
+
+	for (int i = 0; i < size; ++i) {
+		hash ^= data[i];
+		hash *= 1099511628211ULL;
+	}
+
+	return hash;
+}
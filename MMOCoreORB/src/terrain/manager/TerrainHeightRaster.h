@@ -0,0 +1,202 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#ifndef TERRAINHEIGHTRASTER_H_
+#define TERRAINHEIGHTRASTER_H_
+
+#include "engine/engine.h"
+
+class ProceduralTerrainAppearance;
+
+/**
+ * Heights of the unmodified terrain sampled on a regular grid and answered
+ * with bilinear interpolation. The grid is generated once and kept in a file
+ * that is memory mapped on later boots.
+ *
+ * Bilinear heights can be meters off the procedural ones on rough terrain, so
+ * the raster only bounds heights: a box whose grid heights, widened by the
+ * error measured while sampling, are within a height difference is known to
+ * pass an exact check of that difference.
+ *
+ * Terrain modifications aren't part of the grid, the blocks they touch are
+ * counted so callers know to ask the procedural terrain there instead.
+ */
+class TerrainHeightRaster : public Object, public Logger {
+public:
+	const static uint32 MAGIC = 'HRST';
+	const static uint32 VERSION = 2;
+
+	// side of the squares terrain modifications are tracked in
+	const static int BLOCKSIZE = 64;
+
+	// error bound over the largest error measured at the cell centers
+	const static int ERRORMARGIN = 2;
+
+protected:
+	struct FileHeader {
+		uint32 magic;
+		uint32 version;
+		uint64 terrainHash;
+		float originX;
+		float originY;
+		float spacing;
+		int32 width;
+		float errorBound;
+	};
+
+	float originX, originY;
+	float spacing, invSpacing;
+
+	// most bilinear heights are off the procedural ones by
+	float errorBound;
+
+	// samples per row and column
+	int width;
+
+	// sample row y, column x is heights[y * width + x]
+	float* heights;
+	float* ownedHeights;
+
+	void* mapping;
+	size_t mappingSize;
+
+	int blocksPerRow;
+	AtomicInteger* modifiedBlocks;
+	AtomicInteger unboundedModifications;
+
+	AtomicInteger ready;
+
+public:
+	/**
+	 * Raster covering the square of side size starting at originX, originY
+	 */
+	TerrainHeightRaster(float originX, float originY, float size, float spacing);
+	~TerrainHeightRaster();
+
+	/**
+	 * Samples the base height of terrain at every grid point. Like map, it
+	 * does nothing once the raster is ready.
+	 */
+	void build(ProceduralTerrainAppearance* terrain);
+
+	/**
+	 * Maps a file written by save for the same terrain and grid
+	 * @return false if there is no such file
+	 */
+	bool map(const String& path, uint64 terrainHash);
+	bool save(const String& path, uint64 terrainHash);
+
+	void addModification(float centerX, float centerY, float radius);
+	void removeModification(float centerX, float centerY, float radius);
+
+	/**
+	 * Marks the whole raster modified for a modification without known bounds
+	 */
+	void addUnboundedModification() {
+		unboundedModifications.increment();
+	}
+
+	void removeUnboundedModification() {
+		unboundedModifications.decrement();
+	}
+
+	inline bool isReady() {
+		return ready.get() != 0;
+	}
+
+	inline bool contains(float x, float y) const {
+		float max = (width - 1) * spacing;
+		float dx = x - originX;
+		float dy = y - originY;
+
+		return dx >= 0 && dy >= 0 && dx < max && dy < max;
+	}
+
+	inline bool isModified(float x, float y) {
+		if (unboundedModifications.get() != 0)
+			return true;
+
+		int bx = (int) ((x - originX) / BLOCKSIZE);
+		int by = (int) ((y - originY) / BLOCKSIZE);
+
+		return modifiedBlocks[by * blocksPerRow + bx].get() != 0;
+	}
+
+	/**
+	 * @return true if any block overlapping the box x0, y0 - x1, y1 is modified
+	 */
+	bool isModified(float x0, float y0, float x1, float y1);
+
+	/**
+	 * Lowest and highest samples of the grid cells overlapping the box
+	 * x0, y0 - x1, y1, which bound the bilinear heights inside it
+	 */
+	void getHeightRange(float x0, float y0, float x1, float y1, float& minHeight, float& maxHeight) const;
+
+	/**
+	 * Prefilter for exact height difference checks, never true for a box
+	 * an exact check rejects
+	 * @return true if the heights in the box x0, y0 - x1, y1 differ by at most maxDifference,
+	 * false if only an exact check can tell
+	 */
+	bool isHeightDifferenceWithin(float x0, float y0, float x1, float y1, float maxDifference) const {
+		float minHeight, maxHeight;
+
+		getHeightRange(x0, y0, x1, y1, minHeight, maxHeight);
+
+		return maxHeight - minHeight + 2 * errorBound <= maxDifference;
+	}
+
+	/**
+	 * Bilinear height at x, y, which must be contained in the raster
+	 */
+	inline float getHeight(float x, float y) const {
+		float fx = (x - originX) * invSpacing;
+		float fy = (y - originY) * invSpacing;
+
+		int ix = MIN((int) fx, width - 2);
+		int iy = MIN((int) fy, width - 2);
+
+		float tx = fx - ix;
+		float ty = fy - iy;
+
+		const float* row = heights + iy * width + ix;
+
+		float h0 = row[0] + (row[1] - row[0]) * tx;
+		float h1 = row[width] + (row[width + 1] - row[width]) * tx;
+
+		return h0 + (h1 - h0) * ty;
+	}
+
+	/**
+	 * Height stored for the grid point in column x, row y
+	 */
+	inline float getSample(int x, int y) const {
+		return heights[y * width + x];
+	}
+
+	inline int getWidth() const {
+		return width;
+	}
+
+	inline float getSpacing() const {
+		return spacing;
+	}
+
+	inline float getErrorBound() const {
+		return errorBound;
+	}
+
+	/**
+	 * FNV-1a hash of data, used to tell rasters of different terrain files apart
+	 */
+	static uint64 hashData(const byte* data, int size);
+
+protected:
+	void unmap();
+
+	void updateBlocks(float centerX, float centerY, float radius, int delta);
+};
+
+#endif /* TERRAINHEIGHTRASTER_H_ */
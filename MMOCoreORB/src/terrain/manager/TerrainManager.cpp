@@ -7,12 +7,17 @@
 
 #include "TerrainManager.h"
 #include "templates/manager/TemplateManager.h"
+#include "templates/manager/DataArchiveStore.h"
+#include "conf/ConfigManager.h"
 #include "terrain/ProceduralTerrainAppearance.h"
 #include "terrain/TerrainGenerator.h"
 #include "terrain/SpaceTerrainAppearance.h"
 
 #define USE_CACHED_HEIGHT
 
+// Builds the height rasters of planets booting for the first time
+const String TerrainManager::RasterQueue = "TerrainHeightRaster";
+
 TerrainManager::TerrainManager() : Logger("TerrainManager") {
 	heightCache = NULL;
 
@@ -48,9 +53,50 @@ bool TerrainManager::initialize(const String& terrainFile) {
 	min = getMin();
 	max = getMax();
 
+	heightRaster = NULL;
+
+	int rasterSpacing = ConfigManager::instance()->getTerrainRasterSpacing();
+
+	if (val && rasterSpacing > 0 && getProceduralTerrainAppearance() != NULL)
+		initializeHeightRaster(terrainFile, rasterSpacing);
+
 	return val;
 }
 
+void TerrainManager::initializeHeightRaster(const String& terrainFile, float spacing) {
+	int size = 0;
+	byte* data = DataArchiveStore::instance()->getData(terrainFile, size);
+
+	if (data == NULL)
+		return;
+
+	uint64 terrainHash = TerrainHeightRaster::hashData(data, size);
+
+	delete [] data;
+
+	Reference<TerrainHeightRaster*> raster = new TerrainHeightRaster(min, min, max - min, spacing);
+	raster->setLoggingName("TerrainHeightRaster " + terrainFile);
+
+	heightRaster = raster;
+
+	String path = terrainFile.subString(0, terrainFile.lastIndexOf('.')) + ".hraster";
+
+	if (raster->map(path, terrainHash)) {
+		info("mapped " + path);
+		return;
+	}
+
+	// sampling a whole planet takes minutes, the raster is skipped until it is done
+	Reference<TerrainAppearance*> terrain = terrainData;
+
+	Core::getTaskManager()->executeTask([raster, terrain, path, terrainHash] {
+		raster->info("building " + path, true);
+
+		raster->build(dynamic_cast<ProceduralTerrainAppearance*>(terrain.get()));
+		raster->save(path, terrainHash);
+	}, "BuildTerrainHeightRaster", RasterQueue.toCharArray());
+}
+
 /**
  *  	|----------------| x1,y1
  *  	|----------------| <- stepping
@@ -98,6 +144,18 @@ float TerrainManager::getHighestHeightDifference(float x0, float y0, float x1, f
 	return getHighestHeight(x0, y0, x1, y1, stepping) - getLowestHeight(x0, y0, x1, y1, stepping);
 }
 
+bool TerrainManager::isHeightDifferenceWithin(float x0, float y0, float x1, float y1, float maxDifference, int stepping) {
+	TerrainHeightRaster* raster = heightRaster;
+
+	// flat boxes pass on the raster alone, the rest get the exact check
+	if (raster != NULL && raster->isReady() && raster->contains(x0, y0) && raster->contains(x1, y1)
+			&& !raster->isModified(MIN(x0, x1), MIN(y0, y1), MAX(x0, x1), MAX(y0, y1))
+			&& raster->isHeightDifferenceWithin(x0, y0, x1, y1, maxDifference))
+		return true;
+
+	return getHighestHeightDifference(x0, y0, x1, y1, stepping) <= maxDifference;
+}
+
 void TerrainManager::addTerrainModification(float x, float y, const String& terrainModificationFilename, uint64 objectid) {
 	ProceduralTerrainAppearance* ptat = dynamic_cast<ProceduralTerrainAppearance*>(terrainData.get());
 
@@ -122,6 +180,7 @@ void TerrainManager::addTerrainModification(float x, float y, const String& terr
 	}
 
 	clearCache(generator);
+	updateHeightRaster(generator, true);
 
 	locker.release();
 
@@ -145,11 +204,30 @@ void TerrainManager::removeTerrainModification(uint64 objectid) {
 
 	if (generator != NULL) {
 		clearCache(generator);
+		updateHeightRaster(generator, false);
 
 		delete generator;
 	}
 }
 
+void TerrainManager::updateHeightRaster(TerrainGenerator* generator, bool add) {
+	if (heightRaster == NULL)
+		return;
+
+	float centerX, centerY, radius;
+
+	if (!generator->getFullBoundaryCircle(centerX, centerY, radius)) {
+		if (add)
+			heightRaster->addUnboundedModification();
+		else
+			heightRaster->removeUnboundedModification();
+	} else if (add) {
+		heightRaster->addModification(centerX, centerY, radius);
+	} else {
+		heightRaster->removeModification(centerX, centerY, radius);
+	}
+}
+
 ProceduralTerrainAppearance* TerrainManager::getProceduralTerrainAppearance() {
 	return dynamic_cast<ProceduralTerrainAppearance*>(terrainData.get());
 }
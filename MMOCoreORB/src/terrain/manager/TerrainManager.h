@@ -14,6 +14,7 @@
 #include "engine/util/lru/SynchronizedLRUCache.h"
 #include "gmock/gmock.h"
 #include "TerrainCache.h"
+#include "TerrainHeightRaster.h"
 
 class ProceduralTerrainAppearance;
 
@@ -22,11 +23,23 @@ class TerrainManager : public Logger, public Object {
 
 	TerrainCache* heightCache;
 
+	Reference<TerrainHeightRaster*> heightRaster;
+
 	float min, max;
 
 protected:
 	void clearCache(TerrainGenerator* generator);
 
+	/**
+	 * Maps the height raster of terrainFile or builds it in the background
+	 */
+	void initializeHeightRaster(const String& terrainFile, float spacing);
+
+	/**
+	 * Tracks the area of generator in the height raster after it was added or removed
+	 */
+	void updateHeightRaster(TerrainGenerator* generator, bool add);
+
 public:
 	TerrainManager();
 
@@ -49,16 +62,29 @@ public:
 	float getLowestHeight(float x0, float y0, float x1, float y1, int stepping = 1);
 	float getHighestHeightDifference(float x0, float y0, float x1, float y1, int stepping = 1);
 
+	/**
+	 * Same as getHighestHeightDifference(x0, y0, x1, y1, stepping) <= maxDifference, boxes
+	 * the height raster shows to be flat enough skip sampling the terrain
+	 */
+	bool isHeightDifferenceWithin(float x0, float y0, float x1, float y1, float maxDifference, int stepping = 1);
+
 	void addTerrainModification(float x, float y, const String& terrainModificationFilename, uint64 objectid);
 	void removeTerrainModification(uint64 objectid);
 
 	ProceduralTerrainAppearance* getProceduralTerrainAppearance();
 
 	float getCachedHeight(float x, float y);
+
+	TerrainHeightRaster* getHeightRaster() {
+		return heightRaster;
+	}
 	float getUnCachedHeight(float x, float y);
 
 	virtual float getHeight(float x, float y);
 
+	// Initialized once by the zone server, before the planets load
+	static const String RasterQueue;
+
 	float getMin() {
 		if (terrainData) {
 			return terrainData->getSize() / 2 * -1;
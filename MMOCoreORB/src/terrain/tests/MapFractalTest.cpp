@@ -0,0 +1,69 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#include "gtest/gtest.h"
+
+#include "terrain/MapFractal.h"
+
+// bias and gain curves of the batch noise are polynomial approximations
+static const float CURVEERROR = 1e-6f;
+
+class MapFractalTest : public ::testing::Test {
+public:
+	// not a multiple of the vector width or of the batch size
+	const static int SAMPLES = 1001;
+
+	float x[SAMPLES], y[SAMPLES];
+
+	MapFractalTest() {
+		for (int i = 0; i < SAMPLES; ++i) {
+			x[i] = System::random(1600000) / 100.f - 8000;
+			y[i] = System::random(1600000) / 100.f - 8000;
+		}
+	}
+
+	void setupFractal(MapFractal& fractal, int combination, bool bias, bool gain) {
+		fractal.setSeed(combination * 31 + 7);
+		fractal.setCombination(combination);
+		fractal.setOctaves(4);
+		fractal.setOctavesParam(2.1);
+		fractal.setAmplitude(0.45);
+		fractal.setXFreq(0.013);
+		fractal.setYFreq(0.009);
+		fractal.setBias(bias);
+		fractal.setBiasValue(0.3);
+		fractal.setGainType(gain);
+		fractal.setGainValue(0.8);
+	}
+};
+
+TEST_F(MapFractalTest, BatchNoiseMatchesSinglePointNoise) {
+	for (int combination = 0; combination <= 5; ++combination) {
+		for (int curves = 0; curves < 4; ++curves) {
+			MapFractal fractal;
+			setupFractal(fractal, combination, curves & 1, curves & 2);
+
+			float results[SAMPLES];
+			fractal.getNoise(x, y, results, SAMPLES);
+
+			for (int i = 0; i < SAMPLES; ++i)
+				ASSERT_FLOAT_EQ(fractal.getNoise(x[i], y[i], 0, 0), results[i]) << "combination " << combination << " curves " << curves << " at " << x[i] << " " << y[i];
+		}
+	}
+}
+
+TEST_F(MapFractalTest, BatchCurvesAreWithinErrorBound) {
+	for (int combination = 0; combination <= 5; ++combination) {
+		for (int curves = 1; curves < 4; ++curves) {
+			MapFractal fractal;
+			setupFractal(fractal, combination, curves & 1, curves & 2);
+
+			float results[SAMPLES];
+			fractal.getNoise(x, y, results, SAMPLES, true);
+
+			for (int i = 0; i < SAMPLES; ++i)
+				ASSERT_NEAR(fractal.getNoise(x[i], y[i], 0, 0), results[i], CURVEERROR) << "combination " << combination << " curves " << curves;
+		}
+	}
+}
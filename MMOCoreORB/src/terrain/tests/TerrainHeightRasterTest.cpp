@@ -0,0 +1,155 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#include "gtest/gtest.h"
+
+#include "templates/manager/DataArchiveStore.h"
+#include "terrain/ProceduralTerrainAppearance.h"
+#include "terrain/manager/TerrainHeightRaster.h"
+#include "conf/ConfigManager.h"
+
+class TerrainHeightRasterTest : public ::testing::Test {
+public:
+	// side of the squares sampled on every planet, a full planet takes minutes
+	const static int AREASIZE = 512;
+	const static int SAMPLES = 2048;
+	const static int BOXES = 16;
+
+	// half side of the boxes placement checks look at
+	const static int BOXSIZE = 10;
+
+	TerrainHeightRasterTest() {
+		ConfigManager::instance()->loadConfigData();
+		DataArchiveStore::instance()->loadTres(ConfigManager::instance()->getTrePath(), ConfigManager::instance()->getTreFiles());
+	}
+
+	float getSpacing() {
+		int spacing = ConfigManager::instance()->getTerrainRasterSpacing();
+
+		return spacing > 0 ? spacing : 4;
+	}
+
+	// what TerrainManager::getHighestHeightDifference samples with a stepping of 1
+	float getHeightDifference(ProceduralTerrainAppearance& terrain, int x0, int y0, int x1, int y1) {
+		float minHeight = FLT_MAX, maxHeight = -FLT_MAX;
+
+		for (int y = y0; y < y1; ++y) {
+			for (int x = x0; x < x1; ++x) {
+				float height = terrain.getHeight(x, y);
+
+				minHeight = MIN(minHeight, height);
+				maxHeight = MAX(maxHeight, height);
+			}
+		}
+
+		return maxHeight - minHeight;
+	}
+};
+
+TEST_F(TerrainHeightRasterTest, RasterBoundsProceduralHeightsOnEveryPlanet) {
+	const char* planets[] = { "corellia", "dantooine", "dathomir", "endor", "lok", "naboo", "rori", "talus", "tatooine", "yavin4" };
+
+	// the center and the corners of the middle half of each planet, in fractions of its size
+	const float areas[][2] = { { 0, 0 }, { -0.25f, -0.25f }, { 0.25f, -0.25f }, { -0.25f, 0.25f }, { 0.25f, 0.25f } };
+
+	// height differences placement checks use
+	const float limits[] = { 2.f, 5.f, 15.f };
+
+	for (const char* planet : planets) {
+		String terrainFile = "terrain/" + String(planet) + ".trn";
+
+		IffStream* stream = DataArchiveStore::instance()->openIffFile(terrainFile);
+
+		ASSERT_TRUE(stream != NULL) << terrainFile.toCharArray();
+
+		ProceduralTerrainAppearance terrain;
+		terrain.readObject(stream);
+
+		delete stream;
+
+		float spacing = getSpacing();
+		float maxError = 0;
+		float maxErrorBound = 0;
+		int prefiltered = 0;
+
+		for (const auto& area : areas) {
+			float originX = area[0] * terrain.getSize() - AREASIZE / 2;
+			float originY = area[1] * terrain.getSize() - AREASIZE / 2;
+
+			Reference<TerrainHeightRaster*> raster = new TerrainHeightRaster(originX, originY, AREASIZE, spacing);
+			raster->build(&terrain);
+
+			ASSERT_TRUE(raster->isReady());
+
+			// grid points hold the procedural value itself
+			for (int i = 0; i < 16; ++i) {
+				int x = System::random(raster->getWidth() - 2);
+				int y = System::random(raster->getWidth() - 2);
+
+				EXPECT_FLOAT_EQ(raster->getHeight(originX + x * spacing, originY + y * spacing), terrain.getBaseHeight(originX + x * spacing, originY + y * spacing));
+			}
+
+			for (int i = 0; i < SAMPLES; ++i) {
+				float x = originX + System::random(AREASIZE * 100 - 1) / 100.f;
+				float y = originY + System::random(AREASIZE * 100 - 1) / 100.f;
+
+				ASSERT_TRUE(raster->contains(x, y));
+
+				float error = fabs(raster->getHeight(x, y) - terrain.getHeight(x, y));
+
+				EXPECT_LE(error, raster->getErrorBound()) << planet << " at " << x << ", " << y;
+
+				maxError = MAX(maxError, error);
+			}
+
+			maxErrorBound = MAX(maxErrorBound, raster->getErrorBound());
+
+			// boxes the raster lets through must pass the exact check, including boxes across cell borders
+			for (int i = 0; i < BOXES; ++i) {
+				int x = (int) originX + BOXSIZE + 1 + System::random(AREASIZE - 2 * BOXSIZE - 2);
+				int y = (int) originY + BOXSIZE + 1 + System::random(AREASIZE - 2 * BOXSIZE - 2);
+
+				float difference = getHeightDifference(terrain, x - BOXSIZE, y - BOXSIZE, x + BOXSIZE, y + BOXSIZE);
+
+				for (float limit : limits) {
+					if (!raster->isHeightDifferenceWithin(x - BOXSIZE, y - BOXSIZE, x + BOXSIZE, y + BOXSIZE, limit))
+						continue;
+
+					++prefiltered;
+
+					EXPECT_LE(difference, limit) << planet << " box at " << x << ", " << y;
+				}
+			}
+		}
+
+		RecordProperty((String(planet) + "_max_error_mm").toCharArray(), (int) (maxError * 1000));
+		RecordProperty((String(planet) + "_error_bound_mm").toCharArray(), (int) (maxErrorBound * 1000));
+		RecordProperty((String(planet) + "_prefiltered").toCharArray(), prefiltered);
+	}
+}
+
+TEST_F(TerrainHeightRasterTest, ModificationsAreTrackedPerBlock) {
+	Reference<TerrainHeightRaster*> raster = new TerrainHeightRaster(-512, -512, 1024, getSpacing());
+
+	EXPECT_FALSE(raster->isModified(0, 0));
+
+	raster->addModification(0, 0, 20);
+	raster->addModification(10, 10, 20);
+
+	EXPECT_TRUE(raster->isModified(0, 0));
+	EXPECT_TRUE(raster->isModified(-15, 15));
+	EXPECT_FALSE(raster->isModified(300, 300));
+
+	raster->removeModification(0, 0, 20);
+
+	EXPECT_TRUE(raster->isModified(10, 10));
+
+	raster->removeModification(10, 10, 20);
+
+	EXPECT_FALSE(raster->isModified(0, 0));
+
+	raster->addUnboundedModification();
+
+	EXPECT_TRUE(raster->isModified(300, 300));
+}
@@ -0,0 +1,86 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#include "gtest/gtest.h"
+
+#include "templates/manager/DataArchiveStore.h"
+#include "terrain/ProceduralTerrainAppearance.h"
+#include "conf/ConfigManager.h"
+
+class TerrainProgramTest : public ::testing::Test {
+public:
+	const static int SAMPLES = 2000;
+
+	TerrainProgramTest() {
+		ConfigManager::instance()->loadConfigData();
+		DataArchiveStore::instance()->loadTres(ConfigManager::instance()->getTrePath(), ConfigManager::instance()->getTreFiles());
+	}
+};
+
+TEST_F(TerrainProgramTest, CompiledHeightMatchesLayerWalkOnEveryPlanet) {
+	const char* planets[] = { "corellia", "dantooine", "dathomir", "endor", "lok", "naboo", "rori", "talus", "tatooine", "yavin4" };
+
+	uint64 walkTotal = 0, batchTotal = 0;
+
+	for (const char* planet : planets) {
+		String terrainFile = "terrain/" + String(planet) + ".trn";
+
+		IffStream* stream = DataArchiveStore::instance()->openIffFile(terrainFile);
+
+		ASSERT_TRUE(stream != NULL) << terrainFile.toCharArray();
+
+		ProceduralTerrainAppearance terrain;
+		terrain.readObject(stream);
+
+		delete stream;
+
+		float size = terrain.getSize();
+
+		float x[SAMPLES], y[SAMPLES];
+		float walked[SAMPLES], compiled[SAMPLES], batched[SAMPLES];
+
+		// nearby points, the way the raster and area checks ask for them
+		float originX = System::random((int) size - 1024) - size / 2;
+		float originY = System::random((int) size - 1024) - size / 2;
+
+		for (int i = 0; i < SAMPLES; ++i) {
+			x[i] = originX + System::random(10240) / 10.f;
+			y[i] = originY + System::random(10240) / 10.f;
+		}
+
+		Time start;
+
+		for (int i = 0; i < SAMPLES; ++i)
+			walked[i] = terrain.getWalkedHeight(x[i], y[i]);
+
+		uint64 walkTime = Time().getMikroTime() - start.getMikroTime();
+
+		start.updateToCurrentTime();
+
+		for (int i = 0; i < SAMPLES; ++i)
+			compiled[i] = terrain.getHeight(x[i], y[i]);
+
+		uint64 programTime = Time().getMikroTime() - start.getMikroTime();
+
+		start.updateToCurrentTime();
+
+		terrain.getHeights(x, y, batched, SAMPLES);
+
+		uint64 batchTime = Time().getMikroTime() - start.getMikroTime();
+
+		for (int i = 0; i < SAMPLES; ++i) {
+			ASSERT_FLOAT_EQ(walked[i], compiled[i]) << planet << " " << x[i] << " " << y[i];
+			ASSERT_FLOAT_EQ(compiled[i], batched[i]) << planet << " " << x[i] << " " << y[i];
+		}
+
+		walkTotal += walkTime;
+		batchTotal += batchTime;
+
+		RecordProperty((String(planet) + "_walk_us").toCharArray(), (int) walkTime);
+		RecordProperty((String(planet) + "_program_us").toCharArray(), (int) programTime);
+		RecordProperty((String(planet) + "_batch_us").toCharArray(), (int) batchTime);
+	}
+
+	EXPECT_LT(batchTotal, walkTotal);
+}